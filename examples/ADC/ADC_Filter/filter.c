@@ -0,0 +1,154 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Fixed-point FIR and biquad block filters of the ADC_Filter example (see filter.h).
+ */
+
+#include "filter.h"
+
+static inline int16 SatQ15(int32 value)
+{
+    if(value > 32767)
+    {
+        return 32767;
+    }
+    if(value < -32768)
+    {
+        return -32768;
+    }
+    return (int16)value;
+}
+
+static inline int32 SatQ31(int64 value)
+{
+    if(value > 2147483647LL)
+    {
+        return 2147483647L;
+    }
+    if(value < -2147483647LL - 1)
+    {
+        return -2147483647L - 1;
+    }
+    return (int32)value;
+}
+
+// Convert unsigned 12-bit ADC results (ADCRESULT0 >> 4) to signed Q15 centered on mid-scale
+void AdcToQ15Block(const Uint16 *adc, int16 *out, Uint16 length)
+{
+    Uint16 i;
+
+    for(i = 0; i < length; i++)
+    {
+        out[i] = (int16)(((int16)adc[i] - 2048) * 16);
+    }
+}
+
+void FirQ15Init(FirQ15 *fir, const int16 *coeffs, int16 *delay, Uint16 numTaps)
+{
+    Uint16 i;
+
+    fir->coeffs = coeffs;
+    fir->delay = delay;
+    fir->numTaps = numTaps;
+    fir->index = 0;
+    for(i = 0; i < 2 * numTaps; i++)
+    {
+        delay[i] = 0;
+    }
+}
+
+/*
+ * The delay line holds every sample twice (at index and index + numTaps), so the window
+ * x[n], x[n-1], ... x[n-numTaps+1] is always contiguous and the MAC loop needs no wrap check.
+ * The sum of |h[k]| must stay below 2.0 so the Q30 accumulator cannot overflow.
+ */
+void FirQ15Block(FirQ15 *fir, const int16 *in, int16 *out, Uint16 length)
+{
+    const int16 *h = fir->coeffs;
+    const int16 *x;
+    Uint16 numTaps = fir->numTaps;
+    Uint16 index = fir->index;
+    Uint16 n, k;
+    int32 acc;
+
+    for(n = 0; n < length; n++)
+    {
+        index = (index == 0) ? numTaps - 1 : index - 1; // Circular decrement
+        fir->delay[index] = in[n];
+        fir->delay[index + numTaps] = in[n];
+        x = &fir->delay[index];
+
+        acc = 1L << 14; // Rounding constant
+        for(k = 0; k + 4 <= numTaps; k += 4) // Unrolled by 4 for the common tap counts (8, 16, 32, ...)
+        {
+            acc += (int32)h[k] * x[k];
+            acc += (int32)h[k + 1] * x[k + 1];
+            acc += (int32)h[k + 2] * x[k + 2];
+            acc += (int32)h[k + 3] * x[k + 3];
+        }
+        for(; k < numTaps; k++) // Remaining taps
+        {
+            acc += (int32)h[k] * x[k];
+        }
+        out[n] = SatQ15(acc >> 15);
+    }
+
+    fir->index = index;
+}
+
+void BiquadQ31Init(BiquadQ31 *biquad, const BiquadCoeffsQ30 *coeffs, int32 *state, Uint16 numStages)
+{
+    Uint16 i;
+
+    biquad->coeffs = coeffs;
+    biquad->state = state;
+    biquad->numStages = numStages;
+    for(i = 0; i < 4 * numStages; i++)
+    {
+        state[i] = 0;
+    }
+}
+
+// Direct form I cascade; in and out may point to the same buffer
+void BiquadQ31Block(BiquadQ31 *biquad, const int32 *in, int32 *out, Uint16 length)
+{
+    const BiquadCoeffsQ30 *c = biquad->coeffs;
+    int32 *s = biquad->state;
+    const int32 *src = in;
+    Uint16 stage, n;
+    int32 x1, x2, y1, y2, x0, y0;
+    int64 acc;
+
+    for(stage = 0; stage < biquad->numStages; stage++)
+    {
+        x1 = s[0];
+        x2 = s[1];
+        y1 = s[2];
+        y2 = s[3];
+
+        for(n = 0; n < length; n++)
+        {
+            x0 = src[n];
+            acc = (int64)c->b0 * x0 + (int64)c->b1 * x1 + (int64)c->b2 * x2
+                - (int64)c->a1 * y1 - (int64)c->a2 * y2;
+            y0 = SatQ31((acc + (1LL << 29)) >> 30); // Q61 -> Q31 with rounding
+            x2 = x1;
+            x1 = x0;
+            y2 = y1;
+            y1 = y0;
+            out[n] = y0;
+        }
+
+        s[0] = x1;
+        s[1] = x2;
+        s[2] = y1;
+        s[3] = y2;
+        s += 4;
+        c++;
+        src = out; // Following stages filter in place
+    }
+}
@@ -0,0 +1,56 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Fixed-point block filters for the ADC_Filter example: a Q15 FIR filter with a 32-bit accumulator and a cascade of
+ * Q31 direct form I biquad sections with Q30 coefficients and a 64-bit accumulator.
+ *
+ * Q15: int16 in [-1, 1), Q31: int32 in [-1, 1), Q30 coefficients: int32 in [-2, 2).
+ * None of the functions touch peripheral registers. host/filter_test.c compares them against a double-precision
+ * reference and measures their cost per sample.
+ */
+
+#ifndef FILTER_H
+#define FILTER_H
+
+#ifdef __TMS320C2000__
+#include "F2802x_Device.h"
+#else
+#include <stdint.h>
+typedef uint16_t Uint16;
+typedef int16_t int16;
+typedef int32_t int32;
+typedef int64_t int64;
+#endif
+
+typedef struct
+{
+    const int16 *coeffs; // Q15 coefficients h[0] .. h[numTaps - 1]
+    int16 *delay;        // Delay line of 2 * numTaps samples
+    Uint16 numTaps;      // Number of coefficients
+    Uint16 index;        // Position of the newest sample in the delay line
+} FirQ15;
+
+typedef struct
+{
+    int32 b0, b1, b2; // Feed-forward coefficients (Q30)
+    int32 a1, a2;     // Feedback coefficients (Q30), y[n] = b0 x[n] + b1 x[n-1] + b2 x[n-2] - a1 y[n-1] - a2 y[n-2]
+} BiquadCoeffsQ30;
+
+typedef struct
+{
+    const BiquadCoeffsQ30 *coeffs; // One coefficient set per stage
+    int32 *state;                  // 4 words per stage: x[n-1], x[n-2], y[n-1], y[n-2] (Q31)
+    Uint16 numStages;              // Number of cascaded sections
+} BiquadQ31;
+
+void AdcToQ15Block(const Uint16 *adc, int16 *out, Uint16 length);
+void FirQ15Init(FirQ15 *fir, const int16 *coeffs, int16 *delay, Uint16 numTaps);
+void FirQ15Block(FirQ15 *fir, const int16 *in, int16 *out, Uint16 length);
+void BiquadQ31Init(BiquadQ31 *biquad, const BiquadCoeffsQ30 *coeffs, int32 *state, Uint16 numStages);
+void BiquadQ31Block(BiquadQ31 *biquad, const int32 *in, int32 *out, Uint16 length);
+
+#endif // FILTER_H
@@ -0,0 +1,314 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Runs the ADC_Filter fixed-point filters (filter.c) on a Linux host against a double-precision reference.
+ *
+ * The FIR filter must match the reference bit for bit: every product of Q15 values and their sum are exact in a
+ * double, so the reference applies the same rounding and saturation and any difference is a bug (a wrong delay line
+ * index, a lost sample between blocks, a broken unrolled loop or tail). This is checked for several tap counts,
+ * including odd ones that use the tail loop, random block lengths, in-place filtering and saturating input.
+ * The biquad cascade has a feedback path, so its rounding errors cannot be reproduced in a double; it is checked
+ * against an unquantised double-precision filter with the same coefficients, within a bound of 2^-20 of full scale.
+ *
+ * It then prints the host time per sample for several filter orders as a relative cost measure.
+ * The exit status is 1 if any check fails.
+ *
+ * Build: gcc -O2 -I.. -o filter_test filter_test.c ../filter.c -lm
+ */
+
+#include "filter.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define TEST_SAMPLES   20000
+#define MAX_TAPS       64
+#define MAX_STAGES     4
+#define BENCH_BLOCK    64      // ADC_BLOCK_SIZE of main.c
+#define BENCH_SAMPLES  4000000UL
+
+static int failures;
+static long firSaturated;  // Saturated outputs of the last FirMatches
+static volatile int32 sink;
+
+static void Check(const char *name, int ok)
+{
+    printf("  %-52s %s\n", name, ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        failures++;
+    }
+}
+
+static int16 RandomQ15(void)
+{
+    return (int16)((rand() & 0xFFFF) - 32768);
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// y[n] = sat(floor((2^14 + sum h[k] x[n-k]) / 2^15)), evaluated in double
+static int16 FirReference(const int16 *h, Uint16 numTaps, const int16 *x, long n)
+{
+    double acc = 16384.0;
+    double y;
+    Uint16 k;
+
+    for(k = 0; k < numTaps && k <= n; k++)
+    {
+        acc += (double)h[k] * x[n - k];
+    }
+    y = floor(acc / 32768.0);
+    return (int16)(y > 32767.0 ? 32767.0 : (y < -32768.0 ? -32768.0 : y));
+}
+
+// Random taps with sum |h| just below the given limit (Q15), so the accumulator cannot overflow; a negative limit gives positive taps only
+static void RandomTaps(int16 *h, Uint16 numTaps, double limit)
+{
+    double sum = 0.0;
+    double w[MAX_TAPS];
+    Uint16 k;
+
+    for(k = 0; k < numTaps; k++)
+    {
+        w[k] = (double)rand() / RAND_MAX - (limit < 0.0 ? 0.0 : 0.5);
+        sum += fabs(w[k]);
+    }
+    for(k = 0; k < numTaps; k++)
+    {
+        h[k] = (int16)(w[k] / sum * fabs(limit) * 32767.0);
+    }
+}
+
+// Filter x through the FIR in random block lengths and compare every sample with the reference
+static int FirMatches(Uint16 numTaps, double gain, int inPlace, const int16 *x)
+{
+    static int16 y[TEST_SAMPLES];
+    int16 h[MAX_TAPS];
+    int16 delay[2 * MAX_TAPS];
+    FirQ15 fir;
+    long n = 0;
+    long i;
+    Uint16 length;
+
+    RandomTaps(h, numTaps, gain);
+    FirQ15Init(&fir, h, delay, numTaps);
+    while(n < TEST_SAMPLES)
+    {
+        length = 1 + rand() % 97;
+        if(length > TEST_SAMPLES - n)
+        {
+            length = TEST_SAMPLES - n;
+        }
+        if(inPlace)
+        {
+            for(i = 0; i < length; i++)
+            {
+                y[n + i] = x[n + i];
+            }
+            FirQ15Block(&fir, &y[n], &y[n], length);
+        }
+        else
+        {
+            FirQ15Block(&fir, &x[n], &y[n], length);
+        }
+        n += length;
+    }
+    firSaturated = 0;
+    for(n = 0; n < TEST_SAMPLES; n++)
+    {
+        firSaturated += (y[n] == 32767 || y[n] == -32768);
+        if(y[n] != FirReference(h, numTaps, x, n))
+        {
+            printf("    %u taps: sample %ld is %d, reference %d\n", numTaps, n, y[n], FirReference(h, numTaps, x, n));
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Largest |y - reference| of a biquad cascade, as a fraction of full scale
+static double BiquadError(const BiquadCoeffsQ30 *c, Uint16 numStages, const int32 *x)
+{
+    static int32 y[TEST_SAMPLES];
+    double s[MAX_STAGES][4] = {{ 0 }};
+    int32 state[4 * MAX_STAGES];
+    BiquadQ31 biquad;
+    double worst = 0.0;
+    double v, r;
+    long n = 0;
+    Uint16 length, k;
+
+    BiquadQ31Init(&biquad, c, state, numStages);
+    while(n < TEST_SAMPLES)
+    {
+        length = 1 + rand() % 97;
+        if(length > TEST_SAMPLES - n)
+        {
+            length = TEST_SAMPLES - n;
+        }
+        BiquadQ31Block(&biquad, &x[n], &y[n], length);
+        n += length;
+    }
+
+    for(n = 0; n < TEST_SAMPLES; n++)
+    {
+        v = x[n] / 2147483648.0;
+        for(k = 0; k < numStages; k++)
+        {
+            r = (c[k].b0 * v + c[k].b1 * s[k][0] + c[k].b2 * s[k][1] - c[k].a1 * s[k][2] - c[k].a2 * s[k][3]) / 1073741824.0;
+            s[k][1] = s[k][0];
+            s[k][0] = v;
+            s[k][3] = s[k][2];
+            s[k][2] = r;
+            v = r;
+        }
+        if(fabs(y[n] / 2147483648.0 - v) > worst)
+        {
+            worst = fabs(y[n] / 2147483648.0 - v);
+        }
+    }
+    return worst;
+}
+
+static void TestFilters(void)
+{
+    static int16 x[TEST_SAMPLES];
+    static int32 x31[TEST_SAMPLES];
+    // The 2nd-order Butterworth low-pass of main.c, and a 4th-order one (cutoff 0.1 * fs) as two sections
+    static const BiquadCoeffsQ30 butter2[1] =
+    {
+        { 21564350L, 43128699L, 21564350L, -1676130396L, 688645970L }
+    };
+    static const BiquadCoeffsQ30 butter4[2] =
+    {
+        { 66448722L, 132897445L, 66448722L, -1125925222L, 317978288L },
+        { 83704983L, 167409967L, 83704983L, -1418319997L, 679398106L }
+    };
+    Uint16 adc[4096];
+    int16 q15[4096];
+    Uint16 i;
+    long n;
+    int ok;
+    double error;
+
+    for(i = 0, ok = 1; i < 4096; i++)
+    {
+        adc[i] = i;
+    }
+    AdcToQ15Block(adc, q15, 4096);
+    for(i = 0; i < 4096; i++)
+    {
+        ok &= (q15[i] == (int16)(((int)i - 2048) * 16));
+    }
+    Check("AdcToQ15Block: all 4096 ADC codes", ok);
+
+    for(n = 0; n < TEST_SAMPLES; n++)
+    {
+        x[n] = RandomQ15() / 2; // Half scale: no saturation with sum |h| < 2
+    }
+    Check("FIR 8 taps bit-exact (unrolled loop only)", FirMatches(8, 1.99, 0, x));
+    Check("FIR 16 taps bit-exact", FirMatches(16, 1.99, 0, x));
+    Check("FIR 15 taps bit-exact (tail loop)", FirMatches(15, 1.99, 0, x));
+    Check("FIR 33 taps bit-exact, in place", FirMatches(33, 1.99, 1, x));
+    Check("FIR 1 tap bit-exact (tail loop only)", FirMatches(1, 0.99, 0, x));
+    for(n = 0; n < TEST_SAMPLES; n++)
+    {
+        x[n] = (((n / 200) & 1) ? 16384 : -16384) + RandomQ15() / 8; // Half-scale square wave and noise
+    }
+    ok = FirMatches(64, -1.99, 0, x); // DC gain 1.99: the flat parts saturate
+    Check("FIR 64 taps bit-exact with saturation", ok && firSaturated > 0);
+
+    for(n = 0; n < TEST_SAMPLES; n++)
+    {
+        x31[n] = (int32)(((n / 50) & 1) ? 0x30000000L : -0x30000000L) + (int32)RandomQ15() * 4096; // Steps and noise
+    }
+    error = BiquadError(butter2, 1, x31);
+    printf("    biquad 1 stage:  max error %.3g of full scale\n", error);
+    Check("biquad 1 stage within 2^-20 of double reference", error < 1.0 / 1048576.0);
+    error = BiquadError(butter4, 2, x31);
+    printf("    biquad 2 stages: max error %.3g of full scale\n", error);
+    Check("biquad 2 stages within 2^-20 of double reference", error < 1.0 / 1048576.0);
+}
+
+static void BenchFir(Uint16 numTaps)
+{
+    static int16 block[BENCH_BLOCK];
+    int16 h[MAX_TAPS];
+    int16 delay[2 * MAX_TAPS];
+    FirQ15 fir;
+    unsigned long n;
+    double start;
+
+    RandomTaps(h, numTaps, 1.0);
+    FirQ15Init(&fir, h, delay, numTaps);
+    for(n = 0; n < BENCH_BLOCK; n++)
+    {
+        block[n] = RandomQ15();
+    }
+    start = Now();
+    for(n = 0; n < BENCH_SAMPLES; n += BENCH_BLOCK)
+    {
+        FirQ15Block(&fir, block, block, BENCH_BLOCK);
+    }
+    sink += block[0];
+    printf("  FIR %2u taps            %6.2f ns/sample\n", numTaps, (Now() - start) * 1e9 / BENCH_SAMPLES);
+}
+
+static void BenchBiquad(Uint16 numStages)
+{
+    static const BiquadCoeffsQ30 c = { 21564350L, 43128699L, 21564350L, -1676130396L, 688645970L };
+    BiquadCoeffsQ30 coeffs[MAX_STAGES];
+    static int32 block[BENCH_BLOCK];
+    int32 state[4 * MAX_STAGES];
+    BiquadQ31 biquad;
+    unsigned long n;
+    double start;
+
+    for(n = 0; n < numStages; n++)
+    {
+        coeffs[n] = c;
+    }
+    BiquadQ31Init(&biquad, coeffs, state, numStages);
+    for(n = 0; n < BENCH_BLOCK; n++)
+    {
+        block[n] = (int32)RandomQ15() * 4096;
+    }
+    start = Now();
+    for(n = 0; n < BENCH_SAMPLES; n += BENCH_BLOCK)
+    {
+        BiquadQ31Block(&biquad, block, block, BENCH_BLOCK);
+    }
+    sink += block[0];
+    printf("  biquad %u stage(s)      %6.2f ns/sample\n", numStages, (Now() - start) * 1e9 / BENCH_SAMPLES);
+}
+
+int main(void)
+{
+    srand(1);
+    TestFilters();
+
+    printf("Host cost per sample, blocks of %d:\n", BENCH_BLOCK);
+    BenchFir(8);
+    BenchFir(16);
+    BenchFir(32);
+    BenchFir(64);
+    BenchBiquad(1);
+    BenchBiquad(2);
+    BenchBiquad(4);
+
+    printf(failures ? "%d check(s) failed\n" : "All checks passed\n", failures);
+    return failures != 0;
+}
@@ -0,0 +1,158 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.1
+ *
+ * Description:
+ * This code demonstrates block-based fixed-point filtering of ADC samples on the Texas Instruments C2000 Piccolo LaunchPad Evaluation Kit (LAUNCHHXL-F28027F).
+ * The analog input is connected to ADCINA0 and sampled on every ePWM1 SOCA trigger.
+ *
+ * The ADC interrupt captures samples into ping-pong buffers (see ADC_Interrupt). Each completed block is converted to Q15,
+ * filtered by a Q15 FIR filter and then by a cascade of Q31 biquad sections in the main loop.
+ * The F28027F has no FPU, so all filtering is done in fixed point with 32-bit or 64-bit accumulators.
+ * Add filter.c and filter.h from this folder and adc_capture.h from ../ADC_Interrupt to the project.
+ *
+ * This example is intended to help users get started with digital filtering of ADC data on the F28027F microcontroller.
+ */
+
+#include "F2802x_Device.h"
+#include "f2802x_examples.h"
+#include "filter.h"
+
+#define ADC_BLOCK_SIZE     64 // Number of samples per capture block
+#define FIR_NUM_TAPS       16 // Number of FIR coefficients
+#define BIQUAD_NUM_STAGES  1  // Number of cascaded biquad sections
+
+#include "adc_capture.h"
+
+__interrupt void adc_isr(void);
+
+AdcCapture adcCapture;
+
+/*
+ * Filter configuration
+ */
+// 16-tap Hamming-windowed low-pass, cutoff 0.1 * fs, unity DC gain (Q15)
+const int16 firCoeffs[FIR_NUM_TAPS] =
+{
+    -114, -159, -139, 291, 1450, 3284, 5246, 6524,
+    6524, 5246, 3284, 1450, 291, -139, -159, -114
+};
+
+// 2nd-order Butterworth low-pass, cutoff 0.05 * fs (Q30)
+const BiquadCoeffsQ30 biquadCoeffs[BIQUAD_NUM_STAGES] =
+{
+    { 21564350L, 43128699L, 21564350L, -1676130396L, 688645970L }
+};
+
+int16 firDelay[2 * FIR_NUM_TAPS];
+int32 biquadState[4 * BIQUAD_NUM_STAGES];
+FirQ15 fir;
+BiquadQ31 biquad;
+
+int16 blockQ15[ADC_BLOCK_SIZE];
+int32 blockQ31[ADC_BLOCK_SIZE];
+
+void ProcessAdcBlock(const Uint16 *block, Uint16 length)
+{
+    Uint16 i;
+
+    AdcToQ15Block(block, blockQ15, length);        // 12-bit unsigned -> Q15
+    FirQ15Block(&fir, blockQ15, blockQ15, length); // FIR low-pass (in place)
+    for(i = 0; i < length; i++)
+    {
+        blockQ31[i] = (int32)blockQ15[i] * 65536L; // Q15 -> Q31
+    }
+    BiquadQ31Block(&biquad, blockQ31, blockQ31, length); // Biquad cascade (in place)
+
+    // Do something with the filtered block in blockQ31
+}
+
+/*
+ * Peripheral setup
+ */
+void InitAdc()
+{
+    EALLOW;
+    SysCtrlRegs.PCLKCR0.bit.ADCENCLK = 1; // Enable ADC peripheral clock
+    AdcRegs.ADCTRL1.bit.ADCBGPWD = 1; // Power up bandgap
+    AdcRegs.ADCTRL1.bit.ADCREFPWD = 1; // Power up reference
+    AdcRegs.ADCTRL1.bit.ADCPWDN = 1; // Power up rest of ADC
+    AdcRegs.ADCTRL3.bit.ADCCLKPS = 6; // Set ADC clock prescaler
+    DELAY_US(1000); // Delay for 1ms to allow ADC to power up
+    EDIS;
+}
+
+void ConfigureAdc()
+{
+    EALLOW;
+    AdcRegs.ADCTRL1.bit.SEQ_CASC = 1; // Cascaded mode
+    AdcRegs.ADCMAXCONV.bit.MAX_CONV1 = 0; // One conversion
+    AdcRegs.ADCCHSELSEQ1.bit.CONV00 = 0; // ADCINA0
+    AdcRegs.ADCTRL2.bit.EPWM_SOCA_SEQ1 = 1; // Enable SOC on EPWM SOCA
+    AdcRegs.ADCTRL2.bit.INT_ENA_SEQ1 = 1; // Enable interrupt
+    AdcRegs.ADCTRL2.bit.RST_SEQ1 = 1; // Reset SEQ1
+    AdcRegs.ADCTRL2.bit.SOC_SEQ1 = 1; // Start conversion
+    EDIS;
+}
+
+void InitEPwm()
+{
+    EALLOW;
+    SysCtrlRegs.PCLKCR0.bit.TBCLKSYNC = 1; // Enable TBCLK within the EPWM
+    EPwm1Regs.ETSEL.bit.SOCAEN = 1; // Enable SOC on A group
+    EPwm1Regs.ETSEL.bit.SOCASEL = 4; // Select SOC from CMPA on upcount
+    EPwm1Regs.ETPS.bit.SOCAPRD = 1; // Generate pulse on 1st event
+    EPwm1Regs.CMPA.half.CMPA = 0x0080; // Set compare A value
+    EPwm1Regs.TBPRD = 0xFFFF; // Set period for ePWM1
+    EPwm1Regs.TBCTL.bit.CTRMODE = TB_COUNT_UP; // Up-count mode
+    EDIS;
+}
+
+void main(void)
+{
+    const Uint16 *block;
+
+    InitSysCtrl(); // Initialize the CPU and configure the clock
+    DINT;          // Disable CPU interrupts
+
+    FirQ15Init(&fir, firCoeffs, firDelay, FIR_NUM_TAPS); // Initialize the FIR filter
+    BiquadQ31Init(&biquad, biquadCoeffs, biquadState, BIQUAD_NUM_STAGES); // Initialize the biquad cascade
+    AdcCaptureInit(&adcCapture); // Initialize the capture buffers
+
+    InitAdc();     // Initialize the ADC
+    ConfigureAdc(); // Configure ADC settings
+    InitEPwm();    // Initialize EPWM to trigger ADC conversions
+
+    InitPieCtrl(); // Initialize the PIE control registers
+    InitPieVectTable(); // Initialize the PIE vector table
+
+    EALLOW;
+    PieVectTable.ADCINT1 = &adc_isr; // Map ISR to the PIE vector table
+    EDIS;
+
+    IER |= M_INT1; // Enable CPU INT1
+    PieCtrlRegs.PIEIER1.bit.INTx6 = 1; // Enable PIE Group 1 interrupt 6
+
+    EINT;  // Enable Global interrupt INTM
+    ERTM;  // Enable Global realtime interrupt DBGM
+
+    while(1)
+    {
+        block = AdcCaptureGetBlock(&adcCapture);
+        if(block != 0)
+        {
+            ProcessAdcBlock(block, ADC_BLOCK_SIZE); // Filter the completed block
+            AdcCaptureRelease(&adcCapture);         // Release it back to the ISR
+        }
+    }
+}
+
+__interrupt void adc_isr(void)
+{
+    AdcCapturePush(&adcCapture, AdcRegs.ADCRESULT0 >> 4); // Store the 12-bit ADC result
+
+    AdcRegs.ADCINTFLGCLR.bit.ADCINT1 = 1; // Clear ADCINT1 flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP1; // Acknowledge interrupt
+}
@@ -0,0 +1,144 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Ping-pong block capture of ADC results, shared by the ADC_Interrupt, ADC_Filter and ADC_Spectrum examples.
+ * The ISR fills one block while the main loop processes the other, so the per-sample ISR work is only a store and an
+ * index increment.
+ *
+ * Define ADC_BLOCK_SIZE before including this header to change the block size (default 64). Define
+ * ADC_CAPTURE_TIMESTAMPS to 1 to also keep the time of every sample, extended to 64 bits (see AdcCaptureStamp).
+ * All functions are static inline so the ISR path needs no call, and none of them touch peripheral registers, so
+ * they can be compiled on a host and fed with a synthetic sample and timestamp stream.
+ */
+
+#ifndef ADC_CAPTURE_H
+#define ADC_CAPTURE_H
+
+#ifdef __TMS320C2000__
+#include "F2802x_Device.h"
+#else
+#include <stdint.h>
+typedef uint16_t Uint16;
+typedef uint32_t Uint32;
+typedef uint64_t Uint64;
+#endif
+
+#ifndef ADC_BLOCK_SIZE
+#define ADC_BLOCK_SIZE 64 // Number of samples per capture block
+#endif
+
+#ifndef ADC_CAPTURE_TIMESTAMPS
+#define ADC_CAPTURE_TIMESTAMPS 0 // 1 to store a timestamp with every sample
+#endif
+
+#if ADC_CAPTURE_TIMESTAMPS
+// 64-bit time base built from a 32-bit free-running counter
+typedef struct
+{
+    Uint32 high; // Number of 32-bit wraps
+    Uint32 last; // Last 32-bit count seen
+} Timestamp64;
+#endif
+
+typedef struct
+{
+    Uint16 buffer[2][ADC_BLOCK_SIZE]; // Ping-pong sample buffers
+#if ADC_CAPTURE_TIMESTAMPS
+    Uint32 timestamp[2][ADC_BLOCK_SIZE]; // Low 32 bits of the time of each sample (CPU cycles)
+    Uint64 blockStart[2];             // Full 64-bit time of the first sample of each buffer
+    Timestamp64 time;                 // Time base the timestamps are extended with
+#endif
+    Uint16 fillIndex;                 // Next write position in the buffer being filled
+    Uint16 fillBuffer;                // Buffer currently being filled by the ISR
+    volatile Uint16 readyBuffer;      // Buffer handed over to the main loop
+    volatile Uint16 blockReady;       // Set by the ISR when a block is complete, cleared by the main loop
+    volatile Uint32 overrunCount;     // Blocks dropped because the main loop had not released the previous one
+} AdcCapture;
+
+static inline void AdcCaptureInit(AdcCapture *capture)
+{
+    capture->fillIndex = 0;
+    capture->fillBuffer = 0;
+    capture->readyBuffer = 1;
+    capture->blockReady = 0;
+    capture->overrunCount = 0;
+#if ADC_CAPTURE_TIMESTAMPS
+    capture->time.high = 0;
+    capture->time.last = 0;
+#endif
+}
+
+#if ADC_CAPTURE_TIMESTAMPS
+// Time elapsed since the counter was started; must be called at least once per 32-bit wrap (about 71 s at 60 MHz)
+static inline Uint64 Timestamp64Update(Timestamp64 *ts, Uint32 now)
+{
+    if(now < ts->last)
+    {
+        ts->high++; // 32-bit count wrapped
+    }
+    ts->last = now;
+    return ((Uint64)ts->high << 32) | now;
+}
+
+// Record the time of the sample about to be pushed; call just before AdcCapturePush
+static inline void AdcCaptureStamp(AdcCapture *capture, Uint32 stamp)
+{
+    Uint64 now = Timestamp64Update(&capture->time, stamp); // Track 32-bit wraps
+
+    if(capture->fillIndex == 0)
+    {
+        capture->blockStart[capture->fillBuffer] = now; // Full time of the first sample
+    }
+    capture->timestamp[capture->fillBuffer][capture->fillIndex] = stamp; // Store sample time
+}
+#endif
+
+static inline void AdcCapturePush(AdcCapture *capture, Uint16 sample)
+{
+    capture->buffer[capture->fillBuffer][capture->fillIndex++] = sample; // Store sample
+
+    if(capture->fillIndex == ADC_BLOCK_SIZE)
+    {
+        capture->fillIndex = 0;
+        if(capture->blockReady)
+        {
+            capture->overrunCount++; // Main loop still owns the other buffer, refill this one
+        }
+        else
+        {
+            capture->readyBuffer = capture->fillBuffer; // Hand the full block to the main loop
+            capture->fillBuffer ^= 1;                   // Continue in the other buffer
+            capture->blockReady = 1;
+        }
+    }
+}
+
+static inline const Uint16 *AdcCaptureGetBlock(AdcCapture *capture)
+{
+    if(capture->blockReady == 0)
+    {
+        return 0; // No complete block available
+    }
+    return capture->buffer[capture->readyBuffer];
+}
+
+static inline void AdcCaptureRelease(AdcCapture *capture)
+{
+    capture->blockReady = 0; // Give the buffer back to the ISR
+}
+
+#if ADC_CAPTURE_TIMESTAMPS
+// 64-bit time of a sample in the block returned by AdcCaptureGetBlock
+static inline Uint64 AdcCaptureSampleTime(const AdcCapture *capture, Uint16 index)
+{
+    const Uint32 *stamp = capture->timestamp[capture->readyBuffer];
+
+    return capture->blockStart[capture->readyBuffer] + (Uint32)(stamp[index] - stamp[0]);
+}
+#endif
+
+#endif // ADC_CAPTURE_H
@@ -0,0 +1,216 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Runs the ping-pong block capture of adc_capture.h on a Linux host with a synthetic sample and timestamp stream,
+ * built with the settings of main.c (64-sample blocks, ADC_CAPTURE_TIMESTAMPS 1). Sample n of the stream is n & 0xFFF
+ * and its 32-bit timestamp is TEST_START + n * TEST_PERIOD, so every block can be checked against the stream.
+ *
+ * It checks that blocks are handed over whole, in order and alternately from the two buffers; that blockReady is set
+ * only when a block completes and cleared by AdcCaptureRelease; that blocks completed while the main loop still holds
+ * one are dropped, counted in overrunCount and do not touch the held block; and that AdcCaptureSampleTime gives the
+ * full 64-bit time of every sample across many 32-bit timer wraps, including wraps inside a block. A final run with
+ * a main loop of random latency checks that every block is either received or counted as an overrun.
+ * The exit status is 1 if any check fails.
+ *
+ * Build: gcc -O2 -I.. -o capture_test capture_test.c
+ */
+
+#define ADC_BLOCK_SIZE         64 // As in main.c
+#define ADC_CAPTURE_TIMESTAMPS 1
+#include "adc_capture.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_PERIOD  0x01003039UL // Cycles between samples: the 32-bit count wraps about every 256 samples
+#define TEST_START   (0xFFFFFFFFUL - 100 * TEST_PERIOD) // First wrap inside the second block
+#define TEST_BLOCKS  2000L
+
+static AdcCapture capture;
+static long pushed;              // Samples pushed so far
+static int failures;
+
+static void Check(const char *name, int ok)
+{
+    printf("  %-52s %s\n", name, ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        failures++;
+    }
+}
+
+static Uint64 StreamTime(long n)
+{
+    return (Uint64)TEST_START + (Uint64)n * TEST_PERIOD;
+}
+
+// One ISR: stamp and push the next sample of the stream
+static void PushSample(void)
+{
+    AdcCaptureStamp(&capture, (Uint32)StreamTime(pushed));
+    AdcCapturePush(&capture, (Uint16)(pushed & 0xFFF));
+    pushed++;
+}
+
+// Number of the stream block in the ready buffer, taken from its 64-bit start time, or -1 if its samples are not
+// exactly that block of the stream
+static long ReadyBlock(const Uint16 *block)
+{
+    long first = (long)((capture.blockStart[capture.readyBuffer] - (Uint64)TEST_START) / TEST_PERIOD / ADC_BLOCK_SIZE);
+    Uint16 i;
+
+    for(i = 0; i < ADC_BLOCK_SIZE; i++)
+    {
+        if(block[i] != ((first * ADC_BLOCK_SIZE + i) & 0xFFF))
+        {
+            return -1;
+        }
+    }
+    return first;
+}
+
+// 64-bit time of every sample of the ready block matches the stream
+static int TimesMatch(long blockNumber)
+{
+    Uint16 i;
+
+    for(i = 0; i < ADC_BLOCK_SIZE; i++)
+    {
+        if(AdcCaptureSampleTime(&capture, i) != StreamTime(blockNumber * ADC_BLOCK_SIZE + i))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void TestHandover(void)
+{
+    const Uint16 *block;
+    long b, wrongOrder = 0, wrongTime = 0, earlyReady = 0, lateReady = 0, sameBuffer = 0;
+    Uint16 i, lastBuffer = 0;
+    Uint32 wraps;
+
+    AdcCaptureInit(&capture);
+    pushed = 0;
+    for(b = 0; b < 40; b++)
+    {
+        for(i = 0; i < ADC_BLOCK_SIZE; i++)
+        {
+            earlyReady += AdcCaptureGetBlock(&capture) != 0; // Nothing until the block is complete
+            PushSample();
+        }
+        block = AdcCaptureGetBlock(&capture);
+        if(block == 0 || !capture.blockReady)
+        {
+            lateReady++;
+            continue;
+        }
+        wrongOrder += ReadyBlock(block) != b;
+        wrongTime += !TimesMatch(b);
+        sameBuffer += b > 0 && capture.readyBuffer == lastBuffer;
+        lastBuffer = capture.readyBuffer;
+        AdcCaptureRelease(&capture);
+        earlyReady += capture.blockReady != 0 || AdcCaptureGetBlock(&capture) != 0;
+    }
+    wraps = capture.time.high;
+    printf("  40 blocks, %lu timer wraps\n", (unsigned long)wraps);
+
+    Check("blockReady set only when a block completes", earlyReady == 0 && lateReady == 0);
+    Check("blocks handed over whole and in order", wrongOrder == 0);
+    Check("buffers alternate", sameBuffer == 0);
+    Check("64-bit sample times across 32-bit wraps", wrongTime == 0 && wraps >= 9);
+    Check("no overrun while the main loop keeps up", capture.overrunCount == 0);
+}
+
+static void TestOverrun(void)
+{
+    const Uint16 *block;
+    Uint16 held[ADC_BLOCK_SIZE];
+    Uint16 i, k, intact = 1;
+
+    AdcCaptureInit(&capture);
+    pushed = 0;
+    for(i = 0; i < ADC_BLOCK_SIZE; i++)
+    {
+        PushSample();
+    }
+    block = AdcCaptureGetBlock(&capture);
+    for(i = 0; i < ADC_BLOCK_SIZE; i++)
+    {
+        held[i] = block[i];
+    }
+
+    // Three more blocks complete while the main loop still holds block 0
+    for(k = 0; k < 3; k++)
+    {
+        for(i = 0; i < ADC_BLOCK_SIZE; i++)
+        {
+            PushSample();
+        }
+    }
+    for(i = 0; i < ADC_BLOCK_SIZE; i++)
+    {
+        intact &= block[i] == held[i];
+    }
+    Check("late release: one overrun per dropped block", capture.overrunCount == 3);
+    Check("held block untouched, still ready", intact && ReadyBlock(block) == 0 && TimesMatch(0));
+
+    AdcCaptureRelease(&capture);
+    for(i = 0; i < ADC_BLOCK_SIZE; i++)
+    {
+        PushSample();
+    }
+    block = AdcCaptureGetBlock(&capture);
+    Check("next block after release is the newest", block != 0 && ReadyBlock(block) == 4 && TimesMatch(4));
+}
+
+// Main loop with random latency: every completed block is received or counted as an overrun
+static void TestRandomLatency(void)
+{
+    const Uint16 *block;
+    long received = 0, errors = 0, last = -1, b;
+    long busy = 0;               // Samples until the main loop releases the block it holds
+
+    srand(1);
+    AdcCaptureInit(&capture);
+    pushed = 0;
+    while(pushed < TEST_BLOCKS * ADC_BLOCK_SIZE)
+    {
+        PushSample();
+        if(busy > 0 && --busy == 0)
+        {
+            AdcCaptureRelease(&capture);
+        }
+        if(busy == 0 && (block = AdcCaptureGetBlock(&capture)) != 0)
+        {
+            b = ReadyBlock(block);
+            errors += b <= last || !TimesMatch(b);
+            last = b;
+            received++;
+            busy = 1 + rand() % (2 * ADC_BLOCK_SIZE); // Sometimes longer than a block
+        }
+    }
+    if(busy > 0)
+    {
+        AdcCaptureRelease(&capture);
+    }
+    printf("  %ld blocks: %ld received, %lu overruns\n", TEST_BLOCKS, received, (unsigned long)capture.overrunCount);
+
+    Check("random latency: blocks whole, in order, with times", errors == 0);
+    Check("received + overrunCount = blocks completed", received + (long)capture.overrunCount == TEST_BLOCKS &&
+          capture.overrunCount != 0);
+}
+
+int main(void)
+{
+    TestHandover();
+    TestOverrun();
+    TestRandomLatency();
+    printf(failures ? "%d check(s) failed\n" : "All checks passed\n", failures);
+    return failures != 0;
+}
@@ -2,14 +2,18 @@
  * Author: Kiran Jojare
  * Email: kijo7257@colorado.edu
  * Date: Feb 20, 2024
- * Version: 1.0
+ * Version: 1.3
  *
  * Description:
  * This code demonstrates how to use the ADC (Analog-to-Digital Converter) with interrupts on the Texas Instruments C2000 Piccolo LaunchPad Evaluation Kit (LAUNCHHXL-F28027F).
  * The analog input is connected to ADCINA0.
  *
  * The code initializes the system control and GPIO settings, configures the ADC to read the analog input and trigger an interrupt,
- * and processes the ADC result in the interrupt service routine (ISR).
+ * and captures the ADC results in the interrupt service routine (ISR) into a pair of ping-pong buffers.
+ * The ISR fills one block while the main loop processes the other, so the per-sample ISR work is only a store and an index increment.
+ * Every sample is tagged with the count of free-running CPU-Timer 1, extended to 64 bits, so samples can be correlated with
+ * other time-stamped measurements and the inter-sample jitter can be analysed in the main loop.
+ * The capture buffers are implemented in adc_capture.h, which is shared with the ADC_Filter and ADC_Spectrum examples.
  *
  * This example is intended to help users get started with using ADC interrupts on the F28027F microcontroller.
  */
@@ -17,8 +21,120 @@
 #include "F2802x_Device.h"
 #include "f2802x_examples.h"
 
+#define ADC_BLOCK_SIZE         64     // Number of samples per capture block
+#define ADC_CAPTURE_TIMESTAMPS 1      // Keep the time of every sample
+#include "adc_capture.h"
+
+#define EPWM1_PERIOD           0xFFFF // ePWM1 period, sets the sample rate
+
+// Nominal sample interval: (TBPRD + 1) TBCLK periods, TBCLK = SYSCLKOUT / 2 (reset value of HSPCLKDIV)
+#define ADC_SAMPLE_PERIOD_CYCLES (2UL * (EPWM1_PERIOD + 1UL))
+#define JITTER_NUM_BINS          16 // Histogram bins, the first and last also collect outliers
+#define JITTER_BIN_CYCLES        8  // Width of each histogram bin in CPU cycles
+
 __interrupt void adc_isr(void);
 
+typedef struct
+{
+    Uint32 histogram[JITTER_NUM_BINS]; // Count of intervals per deviation bin around the nominal period
+    Uint32 minInterval;                // Shortest interval seen (CPU cycles)
+    Uint32 maxInterval;                // Longest interval seen (CPU cycles)
+    Uint32 count;                      // Number of intervals measured
+    Uint32 lastStamp;                  // Timestamp of the last sample of the previous block
+    Uint16 haveLast;                   // lastStamp is valid
+} AdcJitter;
+
+AdcCapture adcCapture;
+AdcJitter adcJitter;
+
+void AdcJitterInit(AdcJitter *jitter)
+{
+    Uint16 i;
+
+    for(i = 0; i < JITTER_NUM_BINS; i++)
+    {
+        jitter->histogram[i] = 0;
+    }
+    jitter->minInterval = 0xFFFFFFFF;
+    jitter->maxInterval = 0;
+    jitter->count = 0;
+    jitter->haveLast = 0;
+}
+
+// Add the intervals of a block of sample timestamps to the jitter statistics (main loop only)
+void AdcJitterAddBlock(AdcJitter *jitter, const Uint32 *stamp, Uint16 length)
+{
+    Uint32 prev = jitter->lastStamp;
+    Uint32 interval;
+    int32 bin;
+    Uint16 i = 0;
+
+    if(!jitter->haveLast)
+    {
+        prev = stamp[0];
+        i = 1;
+    }
+
+    for(; i < length; i++)
+    {
+        interval = stamp[i] - prev; // Modulo 2^32, valid across a wrap
+        prev = stamp[i];
+
+        if(interval < jitter->minInterval)
+        {
+            jitter->minInterval = interval;
+        }
+        if(interval > jitter->maxInterval)
+        {
+            jitter->maxInterval = interval;
+        }
+
+        bin = ((int32)(interval - ADC_SAMPLE_PERIOD_CYCLES) + (JITTER_NUM_BINS / 2) * JITTER_BIN_CYCLES) / JITTER_BIN_CYCLES;
+        if(bin < 0)
+        {
+            bin = 0;
+        }
+        else if(bin >= JITTER_NUM_BINS)
+        {
+            bin = JITTER_NUM_BINS - 1;
+        }
+        jitter->histogram[bin]++;
+        jitter->count++;
+    }
+
+    jitter->lastStamp = prev;
+    jitter->haveLast = 1;
+}
+
+/*
+ * Returns the jitter histogram. Bin i counts intervals whose deviation from
+ * ADC_SAMPLE_PERIOD_CYCLES lies in [(i - JITTER_NUM_BINS / 2) * JITTER_BIN_CYCLES, +JITTER_BIN_CYCLES).
+ * Blocks dropped on overrun leave gaps that show up in the last bin.
+ */
+const Uint32 *AdcJitterHistogram(const AdcJitter *jitter)
+{
+    return jitter->histogram;
+}
+
+// Free-running CPU-Timer 1 used as the sample time base
+void InitCpuTimer1()
+{
+    EALLOW;
+    CpuTimer1Regs.PRD.all = 0xFFFFFFFF; // Maximum period
+    CpuTimer1Regs.TPR.all = 0;          // Count every SYSCLKOUT cycle
+    CpuTimer1Regs.TPRH.all = 0;
+    CpuTimer1Regs.TCR.bit.TSS = 1;    // Stop the timer
+    CpuTimer1Regs.TCR.bit.TRB = 1;    // Reload the timer
+    CpuTimer1Regs.TCR.bit.TIE = 0;    // No timer interrupt
+    CpuTimer1Regs.TCR.bit.TSS = 0;    // Start the timer
+    EDIS;
+}
+
+void ProcessAdcBlock(const Uint16 *block, Uint16 length)
+{
+    // Do something with the block of ADC results
+}
+
 void InitAdc()
 {
     EALLOW;
@@ -52,16 +168,21 @@ void InitEPwm()
     EPwm1Regs.ETSEL.bit.SOCASEL = 4; // Select SOC from CMPA on upcount
     EPwm1Regs.ETPS.bit.SOCAPRD = 1; // Generate pulse on 1st event
     EPwm1Regs.CMPA.half.CMPA = 0x0080; // Set compare A value
-    EPwm1Regs.TBPRD = 0xFFFF; // Set period for ePWM1
+    EPwm1Regs.TBPRD = EPWM1_PERIOD; // Set period for ePWM1
     EPwm1Regs.TBCTL.bit.CTRMODE = TB_COUNT_UP; // Up-count mode
     EDIS;
 }
 
 void main(void)
 {
+    const Uint16 *block;
+
     InitSysCtrl(); // Initialize the CPU and configure the clock
     DINT;          // Disable CPU interrupts
 
+    AdcCaptureInit(&adcCapture); // Initialize the capture buffers
+    AdcJitterInit(&adcJitter); // Initialize the jitter statistics
+    InitCpuTimer1(); // Start the sample time base
     InitAdc();     // Initialize the ADC
     ConfigureAdc(); // Configure ADC settings
     InitEPwm();    // Initialize EPWM to trigger ADC conversions
@@ -79,16 +200,24 @@ void main(void)
     EINT;  // Enable Global interrupt INTM
     ERTM;  // Enable Global realtime interrupt DBGM
 
-    while(1) { }
+    while(1)
+    {
+        block = AdcCaptureGetBlock(&adcCapture);
+        if(block != 0)
+        {
+            ProcessAdcBlock(block, ADC_BLOCK_SIZE); // Process the completed block
+            AdcJitterAddBlock(&adcJitter, adcCapture.timestamp[adcCapture.readyBuffer], ADC_BLOCK_SIZE); // Update jitter statistics
+            AdcCaptureRelease(&adcCapture);         // Release it back to the ISR
+        }
+    }
 }
 
 __interrupt void adc_isr(void)
 {
-    Uint16 adcResult;
-
-    adcResult = AdcRegs.ADCRESULT0 >> 4; // Get ADC result
+    Uint32 stamp = ~CpuTimer1Regs.TIM.all; // Elapsed cycles (timer counts down from 0xFFFFFFFF)
 
-    // Do something with the ADC result
+    AdcCaptureStamp(&adcCapture, stamp);                  // Store the sample time
+    AdcCapturePush(&adcCapture, AdcRegs.ADCRESULT0 >> 4); // Store the 12-bit ADC result
 
     AdcRegs.ADCINTFLGCLR.bit.ADCINT1 = 1; // Clear ADCINT1 flag
     PieCtrlRegs.PIEACK.all = PIEACK_GROUP1; // Acknowledge interrupt
@@ -0,0 +1,139 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Cascaded integrator-comb (CIC) decimator and droop compensation FIR for the ADC_Oversampling example.
+ * The integrators run on every 12-bit input sample with integer adds only, the combs once every CIC_DECIMATION
+ * samples, and each decimated output carries CIC_OUTPUT_BITS bits.
+ *
+ * Define CIC_ORDER, CIC_DECIMATION_SHIFT and CIC_OUTPUT_BITS before including this header to change the filter.
+ * All functions are static inline so the ISR path needs no call, and none of them touch peripheral registers.
+ * host/cic_test.c feeds them synthetic noisy input to measure the noise-floor improvement.
+ */
+
+#ifndef CIC_H
+#define CIC_H
+
+#ifdef __TMS320C2000__
+#include "F2802x_Device.h"
+#else
+#include <stdint.h>
+typedef uint16_t Uint16;
+typedef uint32_t Uint32;
+typedef int16_t int16;
+typedef int32_t int32;
+#endif
+
+#ifndef CIC_ORDER
+#define CIC_ORDER             3  // Number of integrator/comb stages
+#endif
+#ifndef CIC_DECIMATION_SHIFT
+#define CIC_DECIMATION_SHIFT  6  // Decimation rate R = 2^CIC_DECIMATION_SHIFT (64)
+#endif
+#ifndef CIC_OUTPUT_BITS
+#define CIC_OUTPUT_BITS       16 // Resolution of the decimated output
+#endif
+#define CIC_DECIMATION        (1 << CIC_DECIMATION_SHIFT)
+
+// Register growth is CIC_ORDER * CIC_DECIMATION_SHIFT bits on top of the 12-bit input
+#if (12 + CIC_ORDER * CIC_DECIMATION_SHIFT) > 32
+#error "CIC register growth exceeds 32 bits, reduce CIC_ORDER or CIC_DECIMATION_SHIFT"
+#endif
+#if (12 + CIC_ORDER * CIC_DECIMATION_SHIFT) < CIC_OUTPUT_BITS
+#error "CIC_OUTPUT_BITS exceeds the bits produced by the CIC filter"
+#endif
+
+#define CIC_OUTPUT_SHIFT (12 + CIC_ORDER * CIC_DECIMATION_SHIFT - CIC_OUTPUT_BITS)
+
+/*
+ * The integrators wrap modulo 2^32. This is harmless because the comb differences
+ * are also computed modulo 2^32 and the true output fits in the register width.
+ */
+typedef struct
+{
+    Uint32 integrator[CIC_ORDER]; // Integrator stages, run at the input rate
+    Uint32 combDelay[CIC_ORDER];  // Comb delay elements, run at the output rate
+    Uint16 phase;                 // Input samples since the last output
+} CicDecimator;
+
+typedef struct
+{
+    const int16 *coeffs; // 3 coefficients (Q14)
+    Uint16 x1, x2;       // Previous two inputs
+} CicCompensator;
+
+static inline void CicInit(CicDecimator *c)
+{
+    Uint16 i;
+
+    for(i = 0; i < CIC_ORDER; i++)
+    {
+        c->integrator[i] = 0;
+        c->combDelay[i] = 0;
+    }
+    c->phase = 0;
+}
+
+// Returns 1 and writes *output when a decimated sample is available
+static inline Uint16 CicPush(CicDecimator *c, Uint16 sample, Uint16 *output)
+{
+    Uint32 value = sample;
+    Uint32 delayed;
+    Uint16 i;
+
+    for(i = 0; i < CIC_ORDER; i++)
+    {
+        c->integrator[i] += value; // Integrator: integer add per input sample
+        value = c->integrator[i];
+    }
+
+    if(++c->phase < CIC_DECIMATION)
+    {
+        return 0;
+    }
+    c->phase = 0;
+
+    for(i = 0; i < CIC_ORDER; i++)
+    {
+        delayed = c->combDelay[i];
+        c->combDelay[i] = value;
+        value -= delayed; // Comb: one subtraction per stage at the output rate
+    }
+
+    *output = (Uint16)(value >> CIC_OUTPUT_SHIFT); // Drop the gain R^N down to CIC_OUTPUT_BITS
+    return 1;
+}
+
+static inline void CicCompensatorInit(CicCompensator *comp, const int16 *coeffs)
+{
+    comp->coeffs = coeffs;
+    comp->x1 = 0;
+    comp->x2 = 0;
+}
+
+static inline Uint16 CicCompensate(CicCompensator *comp, Uint16 sample)
+{
+    int32 acc;
+
+    acc = (int32)comp->coeffs[0] * sample
+        + (int32)comp->coeffs[1] * comp->x1
+        + (int32)comp->coeffs[2] * comp->x2;
+    comp->x2 = comp->x1;
+    comp->x1 = sample;
+
+    acc = (acc + (1L << 13)) >> 14; // Q14 -> integer with rounding
+    if(acc < 0)
+    {
+        return 0;
+    }
+    if(acc > 65535L)
+    {
+        return 65535;
+    }
+    return (Uint16)acc;
+}
+
+#endif // CIC_H
@@ -0,0 +1,240 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Runs the ADC_Oversampling CIC decimator and droop compensation (cic.h) on a Linux host with synthetic 12-bit ADC
+ * samples: a level or tone plus white Gaussian noise, rounded and clipped like the converter would.
+ *
+ * Noise floor: the RMS noise of the decimated output, in 12-bit LSB, is compared with that of the raw samples. It
+ * must match the value predicted from the CIC impulse response within 10% and be at least 0.5 * log2(R) bits lower.
+ * Resolution: DC levels 1/8 LSB apart must come out in order and within 1/32 LSB, once the half output count lost
+ * to truncation is added back. Droop: a tone at a quarter of the output rate must lose more than 2 dB through the
+ * CIC alone and be within 0.5 dB of DC after compensation.
+ * The exit status is 1 if any check fails.
+ *
+ * Build: gcc -O2 -I.. -o cic_test cic_test.c -lm
+ * Other settings can be compared by adding e.g. -DCIC_DECIMATION_SHIFT=4 or -DCIC_ORDER=2 (the compensation
+ * coefficients are for CIC_ORDER 3).
+ */
+
+#include "cic.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define OUTPUTS        20000   // Decimated outputs per measurement
+#define SETTLE         4       // Outputs dropped while the combs fill
+#define OUTPUT_LSB     ((double)(1L << (CIC_OUTPUT_BITS - 12))) // Output counts per 12-bit LSB
+
+static int failures;
+
+static void Check(const char *name, int ok)
+{
+    printf("  %-52s %s\n", name, ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        failures++;
+    }
+}
+
+static double Gaussian(void)
+{
+    double u1 = (rand() + 1.0) / (RAND_MAX + 2.0);
+    double u2 = (rand() + 1.0) / (RAND_MAX + 2.0);
+
+    return sqrt(-2.0 * log(u1)) * cos(6.283185307179586 * u2);
+}
+
+static Uint16 Convert(double volts)
+{
+    double code = floor(volts + 0.5);
+
+    return (Uint16)(code < 0.0 ? 0.0 : (code > 4095.0 ? 4095.0 : code));
+}
+
+// Run the CIC on the level plus noise (12-bit LSB) until n outputs are collected, in 12-bit LSB
+static void Decimate(double level, double sigma, double *out, long n)
+{
+    CicDecimator cic;
+    Uint16 output;
+    long count = -SETTLE;
+
+    CicInit(&cic);
+    while(count < n)
+    {
+        if(CicPush(&cic, Convert(level + sigma * Gaussian()), &output))
+        {
+            if(count >= 0)
+            {
+                out[count] = output / OUTPUT_LSB;
+            }
+            count++;
+        }
+    }
+}
+
+static double Rms(const double *x, long n, double *mean)
+{
+    double sum = 0.0, sq = 0.0;
+    long i;
+
+    for(i = 0; i < n; i++)
+    {
+        sum += x[i];
+    }
+    *mean = sum / n;
+    for(i = 0; i < n; i++)
+    {
+        sq += (x[i] - *mean) * (x[i] - *mean);
+    }
+    return sqrt(sq / n);
+}
+
+// Noise gain sum(h^2) / sum(h)^2 of the CIC impulse response: CIC_ORDER boxcars of length R convolved
+static double CicNoiseGain(void)
+{
+    static double h[CIC_ORDER * CIC_DECIMATION + 1], t[CIC_ORDER * CIC_DECIMATION + 1];
+    double sum = 0.0, sq = 0.0;
+    int length = 1, stage, i, k;
+
+    h[0] = 1.0;
+    for(stage = 0; stage < CIC_ORDER; stage++)
+    {
+        for(i = 0; i < length + CIC_DECIMATION - 1; i++)
+        {
+            t[i] = 0.0;
+            for(k = 0; k < CIC_DECIMATION; k++)
+            {
+                t[i] += (i - k >= 0 && i - k < length) ? h[i - k] : 0.0;
+            }
+        }
+        length += CIC_DECIMATION - 1;
+        for(i = 0; i < length; i++)
+        {
+            h[i] = t[i];
+        }
+    }
+    for(i = 0; i < length; i++)
+    {
+        sum += h[i];
+        sq += h[i] * h[i];
+    }
+    return sq / (sum * sum);
+}
+
+static void TestNoiseFloor(void)
+{
+    static double out[OUTPUTS];
+    double raw[OUTPUTS];
+    double mean, rawRms, outRms, expected, gained;
+    long i;
+    char name[64];
+
+    for(i = 0; i < OUTPUTS; i++)
+    {
+        raw[i] = Convert(2000.3 + 2.0 * Gaussian());
+    }
+    rawRms = Rms(raw, OUTPUTS, &mean);
+    Decimate(2000.3, 2.0, out, OUTPUTS);
+    outRms = Rms(out, OUTPUTS, &mean);
+    expected = rawRms * sqrt(CicNoiseGain());
+    gained = log2(rawRms / outRms);
+
+    printf("    R = %d, order %d: raw noise %.3f LSB, output %.4f LSB (predicted %.4f), %.2f bits gained\n",
+           CIC_DECIMATION, CIC_ORDER, rawRms, outRms, expected, gained);
+    Check("output noise within 10% of the predicted noise", fabs(outRms - expected) < 0.1 * expected);
+    sprintf(name, "noise floor lowered by at least %.1f bits", 0.5 * CIC_DECIMATION_SHIFT);
+    Check(name, gained >= 0.5 * CIC_DECIMATION_SHIFT);
+}
+
+// CicPush truncates to CIC_OUTPUT_BITS, which lowers the output by half an output count on average
+static void TestResolution(void)
+{
+    static double out[2000];
+    double mean, error, previous = 0.0, worst = 0.0;
+    int k, ordered = 1;
+
+    for(k = 0; k <= 8; k++)
+    {
+        Decimate(1000.0 + k / 8.0, 1.0, out, 2000); // 1 LSB of noise dithers the converter
+        Rms(out, 2000, &mean);
+        error = fabs(mean + 0.5 / OUTPUT_LSB - 1000.0 - k / 8.0);
+        worst = (error > worst) ? error : worst;
+        ordered &= (k == 0 || mean > previous);
+        previous = mean;
+    }
+    printf("    levels 1/8 LSB apart: largest error %.4f LSB\n", worst);
+    Check("levels 1/8 LSB apart resolved in order", ordered);
+    Check("levels within 1/32 LSB", worst < 1.0 / 32.0);
+}
+
+#if CIC_ORDER == 3
+// Amplitude of a tone at f cycles per output sample in x, by correlation
+static double ToneAmplitude(const double *x, long n, double f)
+{
+    double c = 0.0, s = 0.0;
+    long i;
+
+    for(i = 0; i < n; i++)
+    {
+        c += x[i] * cos(6.283185307179586 * f * i);
+        s += x[i] * sin(6.283185307179586 * f * i);
+    }
+    return 2.0 * hypot(c, s) / n;
+}
+
+static void TestDroop(void)
+{
+    static double plain[OUTPUTS], flat[OUTPUTS];
+    CicDecimator cic;
+    CicCompensator comp;
+    const int16 coeffs[3] = { -3033, 22450, -3033 }; // cicCompensationCoeffs of main.c
+    Uint16 output;
+    long input = 0, count = -SETTLE;
+    double droop, compensated;
+
+    CicInit(&cic);
+    CicCompensatorInit(&comp, coeffs);
+    while(count < OUTPUTS)
+    {
+        // 1000 LSB tone at a quarter of the output rate, 0.5 LSB of noise
+        if(CicPush(&cic, Convert(2048.0 + 1000.0 * sin(6.283185307179586 * 0.25 * input / CIC_DECIMATION)
+                                 + 0.5 * Gaussian()), &output))
+        {
+            if(count >= 0)
+            {
+                plain[count] = output / OUTPUT_LSB;
+                flat[count] = CicCompensate(&comp, output) / OUTPUT_LSB;
+            }
+            else
+            {
+                CicCompensate(&comp, output);
+            }
+            count++;
+        }
+        input++;
+    }
+    droop = 20.0 * log10(ToneAmplitude(plain, OUTPUTS, 0.25) / 1000.0);
+    compensated = 20.0 * log10(ToneAmplitude(flat, OUTPUTS, 0.25) / 1000.0);
+    printf("    gain at 0.25 * output rate: %.2f dB, compensated %.2f dB\n", droop, compensated);
+    Check("CIC droop at 0.25 * output rate above 2 dB", droop < -2.0);
+    Check("compensated gain within 0.5 dB of DC", fabs(compensated) < 0.5);
+}
+#endif
+
+int main(void)
+{
+    srand(1);
+    TestNoiseFloor();
+    TestResolution();
+#if CIC_ORDER == 3
+    TestDroop();
+#endif
+
+    printf(failures ? "%d check(s) failed\n" : "All checks passed\n", failures);
+    return failures != 0;
+}
@@ -0,0 +1,155 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.1
+ *
+ * Description:
+ * This code demonstrates how to oversample the ADC (Analog-to-Digital Converter) and decimate the result with a cascaded integrator-comb (CIC) filter
+ * on the Texas Instruments C2000 Piccolo LaunchPad Evaluation Kit (LAUNCHHXL-F28027F). The analog input is connected to ADCINA0.
+ *
+ * ePWM1 triggers conversions at a high rate (100 kHz). The ADC interrupt runs the CIC integrators on every sample (integer adds only)
+ * and the combs once every CIC_DECIMATION samples. Each decimated output carries CIC_OUTPUT_BITS bits. With white noise on the input,
+ * every doubling of the decimation rate adds about half a bit of effective resolution. An optional 3-tap FIR in the main loop
+ * compensates the CIC pass-band droop. The filter is implemented in cic.h; add it from this folder to the project.
+ *
+ * This example is intended to help users get started with oversampling and decimation of ADC data on the F28027F microcontroller.
+ */
+
+#include "F2802x_Device.h"
+#include "f2802x_examples.h"
+
+#define CIC_ORDER             3  // Number of integrator/comb stages
+#define CIC_DECIMATION_SHIFT  6  // Decimation rate R = 2^CIC_DECIMATION_SHIFT (64)
+#define CIC_OUTPUT_BITS       16 // Resolution of the decimated output
+#define CIC_OUTPUT_DEPTH      16 // Decimated samples buffered for the main loop (power of two)
+#define CIC_COMPENSATION      1  // 1 = apply the droop compensation FIR in the main loop
+
+#include "cic.h"
+
+#if (CIC_OUTPUT_DEPTH & (CIC_OUTPUT_DEPTH - 1)) != 0
+#error "CIC_OUTPUT_DEPTH must be a power of two"
+#endif
+
+__interrupt void adc_isr(void);
+
+typedef struct
+{
+    Uint16 sample[CIC_OUTPUT_DEPTH]; // Decimated output samples
+    volatile Uint16 head;            // Written by the ISR
+    volatile Uint16 tail;            // Read by the main loop
+    volatile Uint32 overrunCount;    // Outputs dropped because the buffer was full
+} CicOutputBuffer;
+
+CicDecimator cic;
+CicOutputBuffer cicOutput;
+CicCompensator cicCompensator;
+
+// 3-tap droop compensation for CIC_ORDER = 3 (flat to 0.25 * output rate), unity DC gain (Q14)
+const int16 cicCompensationCoeffs[3] = { -3033, 22450, -3033 };
+
+void InitAdc()
+{
+    EALLOW;
+    SysCtrlRegs.PCLKCR0.bit.ADCENCLK = 1; // Enable ADC peripheral clock
+    AdcRegs.ADCTRL1.bit.ADCBGPWD = 1; // Power up bandgap
+    AdcRegs.ADCTRL1.bit.ADCREFPWD = 1; // Power up reference
+    AdcRegs.ADCTRL1.bit.ADCPWDN = 1; // Power up rest of ADC
+    AdcRegs.ADCTRL3.bit.ADCCLKPS = 6; // Set ADC clock prescaler
+    DELAY_US(1000); // Delay for 1ms to allow ADC to power up
+    EDIS;
+}
+
+void ConfigureAdc()
+{
+    EALLOW;
+    AdcRegs.ADCTRL1.bit.SEQ_CASC = 1; // Cascaded mode
+    AdcRegs.ADCMAXCONV.bit.MAX_CONV1 = 0; // One conversion
+    AdcRegs.ADCCHSELSEQ1.bit.CONV00 = 0; // ADCINA0
+    AdcRegs.ADCTRL2.bit.EPWM_SOCA_SEQ1 = 1; // Enable SOC on EPWM SOCA
+    AdcRegs.ADCTRL2.bit.INT_ENA_SEQ1 = 1; // Enable interrupt
+    AdcRegs.ADCTRL2.bit.RST_SEQ1 = 1; // Reset SEQ1
+    AdcRegs.ADCTRL2.bit.SOC_SEQ1 = 1; // Start conversion
+    EDIS;
+}
+
+void InitEPwm()
+{
+    EALLOW;
+    SysCtrlRegs.PCLKCR0.bit.TBCLKSYNC = 1; // Enable TBCLK within the EPWM
+    EPwm1Regs.ETSEL.bit.SOCAEN = 1; // Enable SOC on A group
+    EPwm1Regs.ETSEL.bit.SOCASEL = 4; // Select SOC from CMPA on upcount
+    EPwm1Regs.ETPS.bit.SOCAPRD = 1; // Generate pulse on 1st event
+    EPwm1Regs.CMPA.half.CMPA = 0x0080; // Set compare A value
+    EPwm1Regs.TBPRD = 599; // 100 kHz trigger rate (assuming 60 MHz SYSCLKOUT)
+    EPwm1Regs.TBCTL.bit.HSPCLKDIV = 0; // TBCLK = SYSCLKOUT
+    EPwm1Regs.TBCTL.bit.CLKDIV = 0;
+    EPwm1Regs.TBCTL.bit.CTRMODE = TB_COUNT_UP; // Up-count mode
+    EDIS;
+}
+
+void main(void)
+{
+    Uint16 sample;
+
+    InitSysCtrl(); // Initialize the CPU and configure the clock
+    DINT;          // Disable CPU interrupts
+
+    CicInit(&cic); // Initialize the CIC decimator
+    CicCompensatorInit(&cicCompensator, cicCompensationCoeffs); // Initialize the droop compensation
+
+    InitAdc();     // Initialize the ADC
+    ConfigureAdc(); // Configure ADC settings
+    InitEPwm();    // Initialize EPWM to trigger ADC conversions
+
+    InitPieCtrl(); // Initialize the PIE control registers
+    InitPieVectTable(); // Initialize the PIE vector table
+
+    EALLOW;
+    PieVectTable.ADCINT1 = &adc_isr; // Map ISR to the PIE vector table
+    EDIS;
+
+    IER |= M_INT1; // Enable CPU INT1
+    PieCtrlRegs.PIEIER1.bit.INTx6 = 1; // Enable PIE Group 1 interrupt 6
+
+    EINT;  // Enable Global interrupt INTM
+    ERTM;  // Enable Global realtime interrupt DBGM
+
+    while(1)
+    {
+        while(cicOutput.tail != cicOutput.head)
+        {
+            sample = cicOutput.sample[cicOutput.tail];
+            cicOutput.tail = (cicOutput.tail + 1) & (CIC_OUTPUT_DEPTH - 1);
+
+#if CIC_COMPENSATION
+            sample = CicCompensate(&cicCompensator, sample); // Flatten the CIC pass band
+#endif
+
+            // Do something with the 16-bit decimated ADC result
+        }
+    }
+}
+
+__interrupt void adc_isr(void)
+{
+    Uint16 output;
+    Uint16 next;
+
+    if(CicPush(&cic, AdcRegs.ADCRESULT0 >> 4, &output))
+    {
+        next = (cicOutput.head + 1) & (CIC_OUTPUT_DEPTH - 1);
+        if(next == cicOutput.tail)
+        {
+            cicOutput.overrunCount++; // Main loop is behind, drop this output
+        }
+        else
+        {
+            cicOutput.sample[cicOutput.head] = output;
+            cicOutput.head = next;
+        }
+    }
+
+    AdcRegs.ADCINTFLGCLR.bit.ADCINT1 = 1; // Clear ADCINT1 flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP1; // Acknowledge interrupt
+}
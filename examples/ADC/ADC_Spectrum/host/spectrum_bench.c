@@ -0,0 +1,188 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Runs the ADC_Spectrum FFT and Goertzel detector (spectrum.c) on a Linux host for every block size from 8 to
+ * FFT_MAX_SIZE.
+ *
+ * For each size a block of synthetic 12-bit ADC results (a tone, a weaker second tone and noise) is analysed and
+ * compared with a double-precision DFT: the FFT, scaled back by its block exponent, must stay within 1% of the
+ * largest DFT magnitude in every bin and find the same peak bin, and the Goertzel power of the tone bin must be within
+ * 1% of the DFT power. It then prints the host time per block for the FFT (load, transform and power) and for one
+ * Goertzel bin, the 16x16 multiplies each needs (the C28x cost driver), and the number of bins beyond which one FFT is
+ * cheaper than that many Goertzel bins. The exit status is 1 if any check fails.
+ *
+ * Build: gcc -O2 -I.. -o spectrum_bench spectrum_bench.c ../spectrum.c -lm
+ */
+
+#include "spectrum.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BENCH_BLOCKS  200000UL
+
+static int failures;
+static volatile int64 sink;
+
+static void Check(const char *name, int ok)
+{
+    printf("  %-52s %s\n", name, ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        failures++;
+    }
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// 12-bit samples: full-scale-ish tone in bin size/8, a tone 20 dB lower in bin 3 * size/8, and +-4 LSB of noise
+static void MakeBlock(Uint16 *adc, Uint16 size)
+{
+    const double pi = 3.14159265358979;
+    Uint16 n;
+
+    for(n = 0; n < size; n++)
+    {
+        adc[n] = (Uint16)(2048.0 + 1500.0 * cos(2.0 * pi * (size / 8) * n / size)
+                        + 150.0 * sin(2.0 * pi * (3 * size / 8) * n / size) + (rand() % 9) - 4);
+    }
+}
+
+// Double-precision DFT of the samples as FftLoadAdcBlock scales them
+static void Dft(const Uint16 *adc, Uint16 size, double *re, double *im, double scale)
+{
+    const double pi = 3.14159265358979;
+    Uint16 k, n;
+
+    for(k = 0; k < size / 2; k++)
+    {
+        re[k] = 0.0;
+        im[k] = 0.0;
+        for(n = 0; n < size; n++)
+        {
+            re[k] += ((double)adc[n] - 2048.0) * scale * cos(2.0 * pi * k * n / size);
+            im[k] -= ((double)adc[n] - 2048.0) * scale * sin(2.0 * pi * k * n / size);
+        }
+    }
+}
+
+static void TestSize(Uint16 size)
+{
+    const double pi = 3.14159265358979;
+    Uint16 adc[FFT_MAX_SIZE];
+    int16 re[FFT_MAX_SIZE], im[FFT_MAX_SIZE];
+    Uint32 power[FFT_MAX_SIZE / 2];
+    double refRe[FFT_MAX_SIZE / 2], refIm[FFT_MAX_SIZE / 2];
+    double peak = 0.0, error = 0.0, gain, e, ref;
+    Uint16 exponent, k, peakBin = 1, refBin = 1;
+    int16 coeff;
+    int64 goertzel;
+    char name[64];
+
+    MakeBlock(adc, size);
+    Dft(adc, size, refRe, refIm, 16.0);
+    FftLoadAdcBlock(adc, re, im, size);
+    exponent = FftQ15(re, im, size);
+    FftPower(re, im, power, size);
+    gain = (double)(1L << exponent);
+
+    for(k = 0; k < size / 2; k++)
+    {
+        if(hypot(refRe[k], refIm[k]) > peak)
+        {
+            peak = hypot(refRe[k], refIm[k]);
+        }
+    }
+    for(k = 0; k < size / 2; k++)
+    {
+        e = hypot(re[k] * gain - refRe[k], im[k] * gain - refIm[k]);
+        error = (e > error) ? e : error;
+        if(k > 0 && power[k] > power[peakBin])
+        {
+            peakBin = k;
+        }
+        if(k > 0 && hypot(refRe[k], refIm[k]) > hypot(refRe[refBin], refIm[refBin]))
+        {
+            refBin = k;
+        }
+    }
+    sprintf(name, "FFT %3u: every bin within 1%% of DFT peak, same peak", size);
+    Check(name, error < 0.01 * peak && peakBin == refBin);
+
+    coeff = (int16)floor(2.0 * cos(2.0 * pi * (size / 8) / size) * 16384.0 + 0.5);
+    goertzel = GoertzelPower(adc, size, coeff);
+    ref = (refRe[size / 8] * refRe[size / 8] + refIm[size / 8] * refIm[size / 8]) / 256.0; // Unscaled samples
+    sprintf(name, "Goertzel %3u: tone bin power within 1%% of DFT", size);
+    Check(name, fabs((double)goertzel - ref) < 0.01 * ref);
+}
+
+static void BenchSize(Uint16 size)
+{
+    Uint16 adc[FFT_MAX_SIZE];
+    int16 re[FFT_MAX_SIZE], im[FFT_MAX_SIZE];
+    Uint32 power[FFT_MAX_SIZE / 2];
+    Uint16 stages = 0;
+    unsigned long i;
+    double start, fft, goertzel;
+
+    while((1U << stages) < size)
+    {
+        stages++;
+    }
+    MakeBlock(adc, size);
+
+    start = Now();
+    for(i = 0; i < BENCH_BLOCKS; i++)
+    {
+        adc[i % size] ^= 1; // Defeat hoisting of the loop body
+        FftLoadAdcBlock(adc, re, im, size);
+        sink += FftQ15(re, im, size);
+        FftPower(re, im, power, size);
+        sink += power[1];
+    }
+    fft = (Now() - start) * 1e9 / BENCH_BLOCKS;
+
+    start = Now();
+    for(i = 0; i < BENCH_BLOCKS; i++)
+    {
+        adc[i % size] ^= 1;
+        sink += GoertzelPower(adc, size, 30274);
+    }
+    goertzel = (Now() - start) * 1e9 / BENCH_BLOCKS;
+
+    printf("  %3u   %9.0f %7u   %9.0f %7u   %5.1f\n", size, fft, 2U * size * stages + size,
+           goertzel, size + 4U, fft / goertzel);
+}
+
+int main(void)
+{
+    Uint16 size;
+
+    srand(1);
+    for(size = 8; size <= FFT_MAX_SIZE; size <<= 1)
+    {
+        TestSize(size);
+    }
+
+    printf("Host cost per block (ns) and 16x16 multiplies:\n");
+    printf("  size  FFT ns    mults    Goertzel ns  mults   bins at which the FFT is cheaper\n");
+    for(size = 8; size <= FFT_MAX_SIZE; size <<= 1)
+    {
+        BenchSize(size);
+    }
+
+    printf(failures ? "%d check(s) failed\n" : "All checks passed\n", failures);
+    return failures != 0;
+}
@@ -0,0 +1,150 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.1
+ *
+ * Description:
+ * This code demonstrates spectral analysis of ADC (Analog-to-Digital Converter) samples on the Texas Instruments C2000 Piccolo LaunchPad Evaluation Kit (LAUNCHHXL-F28027F).
+ * The analog input is connected to ADCINA0 and sampled on every ePWM1 SOCA trigger.
+ *
+ * The ADC interrupt captures samples into ping-pong buffers (see ADC_Interrupt). Each completed block is analysed in the main loop by
+ * an in-place fixed-point radix-2 FFT with block scaling, and by a Goertzel detector for a small set of bins of interest.
+ * The twiddle and bit-reversal tables are const, so they are placed in flash.
+ * Add spectrum.c and spectrum.h from this folder and adc_capture.h from ../ADC_Interrupt to the project.
+ *
+ * This example is intended to help users get started with frequency analysis of ADC data on the F28027F microcontroller.
+ */
+
+#include "F2802x_Device.h"
+#include "f2802x_examples.h"
+#include "spectrum.h"
+
+#define FFT_SIZE           128 // FFT length, also the capture block size (power of two, at most FFT_MAX_SIZE)
+#define ADC_BLOCK_SIZE     FFT_SIZE
+#define GOERTZEL_NUM_BINS  3   // Number of bins tracked by the Goertzel detector
+
+#include "adc_capture.h"
+
+__interrupt void adc_isr(void);
+
+AdcCapture adcCapture;
+
+// Goertzel bins of interest and their coefficients 2 * cos(2 * pi * k / FFT_SIZE) (Q14)
+const Uint16 goertzelBins[GOERTZEL_NUM_BINS] = { 4, 8, 12 };
+const int16 goertzelCoeffs[GOERTZEL_NUM_BINS] = { 32138, 30274, 27246 };
+
+int16 fftRe[FFT_SIZE];
+int16 fftIm[FFT_SIZE];
+Uint32 fftPower[FFT_SIZE / 2];
+int64 goertzelPower[GOERTZEL_NUM_BINS];
+
+void ProcessAdcBlock(const Uint16 *block)
+{
+    Uint16 exponent, peakBin, i;
+
+    FftLoadAdcBlock(block, fftRe, fftIm, FFT_SIZE);
+    exponent = FftQ15(fftRe, fftIm, FFT_SIZE);
+    FftPower(fftRe, fftIm, fftPower, FFT_SIZE);
+
+    peakBin = 1; // Strongest non-DC bin
+    for(i = 2; i < FFT_SIZE / 2; i++)
+    {
+        if(fftPower[i] > fftPower[peakBin])
+        {
+            peakBin = i;
+        }
+    }
+
+    for(i = 0; i < GOERTZEL_NUM_BINS; i++)
+    {
+        goertzelPower[i] = GoertzelPower(block, FFT_SIZE, goertzelCoeffs[i]);
+    }
+
+    // Do something with the spectrum (fftPower scaled by 2^(2 * exponent), peakBin) and goertzelPower
+}
+
+/*
+ * Peripheral setup
+ */
+void InitAdc()
+{
+    EALLOW;
+    SysCtrlRegs.PCLKCR0.bit.ADCENCLK = 1; // Enable ADC peripheral clock
+    AdcRegs.ADCTRL1.bit.ADCBGPWD = 1; // Power up bandgap
+    AdcRegs.ADCTRL1.bit.ADCREFPWD = 1; // Power up reference
+    AdcRegs.ADCTRL1.bit.ADCPWDN = 1; // Power up rest of ADC
+    AdcRegs.ADCTRL3.bit.ADCCLKPS = 6; // Set ADC clock prescaler
+    DELAY_US(1000); // Delay for 1ms to allow ADC to power up
+    EDIS;
+}
+
+void ConfigureAdc()
+{
+    EALLOW;
+    AdcRegs.ADCTRL1.bit.SEQ_CASC = 1; // Cascaded mode
+    AdcRegs.ADCMAXCONV.bit.MAX_CONV1 = 0; // One conversion
+    AdcRegs.ADCCHSELSEQ1.bit.CONV00 = 0; // ADCINA0
+    AdcRegs.ADCTRL2.bit.EPWM_SOCA_SEQ1 = 1; // Enable SOC on EPWM SOCA
+    AdcRegs.ADCTRL2.bit.INT_ENA_SEQ1 = 1; // Enable interrupt
+    AdcRegs.ADCTRL2.bit.RST_SEQ1 = 1; // Reset SEQ1
+    AdcRegs.ADCTRL2.bit.SOC_SEQ1 = 1; // Start conversion
+    EDIS;
+}
+
+void InitEPwm()
+{
+    EALLOW;
+    SysCtrlRegs.PCLKCR0.bit.TBCLKSYNC = 1; // Enable TBCLK within the EPWM
+    EPwm1Regs.ETSEL.bit.SOCAEN = 1; // Enable SOC on A group
+    EPwm1Regs.ETSEL.bit.SOCASEL = 4; // Select SOC from CMPA on upcount
+    EPwm1Regs.ETPS.bit.SOCAPRD = 1; // Generate pulse on 1st event
+    EPwm1Regs.CMPA.half.CMPA = 0x0080; // Set compare A value
+    EPwm1Regs.TBPRD = 0xFFFF; // Set period for ePWM1 (sample rate)
+    EPwm1Regs.TBCTL.bit.CTRMODE = TB_COUNT_UP; // Up-count mode
+    EDIS;
+}
+
+void main(void)
+{
+    const Uint16 *block;
+
+    InitSysCtrl(); // Initialize the CPU and configure the clock
+    DINT;          // Disable CPU interrupts
+
+    AdcCaptureInit(&adcCapture); // Initialize the capture buffers
+    InitAdc();     // Initialize the ADC
+    ConfigureAdc(); // Configure ADC settings
+    InitEPwm();    // Initialize EPWM to trigger ADC conversions
+
+    InitPieCtrl(); // Initialize the PIE control registers
+    InitPieVectTable(); // Initialize the PIE vector table
+
+    EALLOW;
+    PieVectTable.ADCINT1 = &adc_isr; // Map ISR to the PIE vector table
+    EDIS;
+
+    IER |= M_INT1; // Enable CPU INT1
+    PieCtrlRegs.PIEIER1.bit.INTx6 = 1; // Enable PIE Group 1 interrupt 6
+
+    EINT;  // Enable Global interrupt INTM
+    ERTM;  // Enable Global realtime interrupt DBGM
+
+    while(1)
+    {
+        block = AdcCaptureGetBlock(&adcCapture);
+        if(block != 0)
+        {
+            ProcessAdcBlock(block);         // Analyse the completed block
+            AdcCaptureRelease(&adcCapture); // Release it back to the ISR
+        }
+    }
+}
+
+__interrupt void adc_isr(void)
+{
+    AdcCapturePush(&adcCapture, AdcRegs.ADCRESULT0 >> 4); // Store the 12-bit ADC result
+
+    AdcRegs.ADCINTFLGCLR.bit.ADCINT1 = 1; // Clear ADCINT1 flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP1; // Acknowledge interrupt
+}
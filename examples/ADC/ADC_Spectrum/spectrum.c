@@ -0,0 +1,156 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Fixed-point radix-2 FFT and Goertzel detector of the ADC_Spectrum example (see spectrum.h).
+ */
+
+#include "spectrum.h"
+
+// W^k = cos(2*pi*k/N) - j*sin(2*pi*k/N), k = 0 .. N/2 - 1, N = FFT_MAX_SIZE (Q15, real / imaginary)
+const int16 fftTwiddle[FFT_MAX_SIZE / 2][2] =
+{
+    { 32767, 0 }, { 32729, -1608 }, { 32610, -3212 }, { 32413, -4808 },
+    { 32138, -6393 }, { 31786, -7962 }, { 31357, -9512 }, { 30853, -11039 },
+    { 30274, -12540 }, { 29622, -14010 }, { 28899, -15447 }, { 28106, -16846 },
+    { 27246, -18205 }, { 26320, -19520 }, { 25330, -20788 }, { 24279, -22006 },
+    { 23170, -23170 }, { 22006, -24279 }, { 20788, -25330 }, { 19520, -26320 },
+    { 18205, -27246 }, { 16846, -28106 }, { 15447, -28899 }, { 14010, -29622 },
+    { 12540, -30274 }, { 11039, -30853 }, { 9512, -31357 }, { 7962, -31786 },
+    { 6393, -32138 }, { 4808, -32413 }, { 3212, -32610 }, { 1608, -32729 },
+    { 0, -32768 }, { -1608, -32729 }, { -3212, -32610 }, { -4808, -32413 },
+    { -6393, -32138 }, { -7962, -31786 }, { -9512, -31357 }, { -11039, -30853 },
+    { -12540, -30274 }, { -14010, -29622 }, { -15447, -28899 }, { -16846, -28106 },
+    { -18205, -27246 }, { -19520, -26320 }, { -20788, -25330 }, { -22006, -24279 },
+    { -23170, -23170 }, { -24279, -22006 }, { -25330, -20788 }, { -26320, -19520 },
+    { -27246, -18205 }, { -28106, -16846 }, { -28899, -15447 }, { -29622, -14010 },
+    { -30274, -12540 }, { -30853, -11039 }, { -31357, -9512 }, { -31786, -7962 },
+    { -32138, -6393 }, { -32413, -4808 }, { -32610, -3212 }, { -32729, -1608 }
+};
+
+// 7-bit reversed index of each sample position; shifted right for smaller sizes
+const Uint16 fftBitReverse[FFT_MAX_SIZE] =
+{
+    0, 64, 32, 96, 16, 80, 48, 112, 8, 72, 40, 104, 24, 88, 56, 120,
+    4, 68, 36, 100, 20, 84, 52, 116, 12, 76, 44, 108, 28, 92, 60, 124,
+    2, 66, 34, 98, 18, 82, 50, 114, 10, 74, 42, 106, 26, 90, 58, 122,
+    6, 70, 38, 102, 22, 86, 54, 118, 14, 78, 46, 110, 30, 94, 62, 126,
+    1, 65, 33, 97, 17, 81, 49, 113, 9, 73, 41, 105, 25, 89, 57, 121,
+    5, 69, 37, 101, 21, 85, 53, 117, 13, 77, 45, 109, 29, 93, 61, 125,
+    3, 67, 35, 99, 19, 83, 51, 115, 11, 75, 43, 107, 27, 91, 59, 123,
+    7, 71, 39, 103, 23, 87, 55, 119, 15, 79, 47, 111, 31, 95, 63, 127
+};
+
+/*
+ * Load a block of 12-bit ADC results into the FFT buffers in bit-reversed order,
+ * centered on mid-scale and scaled to use the full Q15 range.
+ */
+void FftLoadAdcBlock(const Uint16 *adc, int16 *re, int16 *im, Uint16 size)
+{
+    Uint16 shift = 0;
+    Uint16 i, j;
+
+    while((size << shift) < FFT_MAX_SIZE)
+    {
+        shift++; // A log2(size)-bit reversal is the 7-bit reversal shifted right
+    }
+    for(i = 0; i < size; i++)
+    {
+        j = fftBitReverse[i] >> shift;
+        re[j] = (int16)(((int16)adc[i] - 2048) * 16);
+        im[j] = 0;
+    }
+}
+
+/*
+ * In-place radix-2 decimation-in-time FFT on bit-reversed input.
+ * Before each stage the block is halved if any component exceeds 8191, which keeps
+ * the butterfly outputs inside Q15. Returns the block exponent: the true spectrum
+ * is the result multiplied by 2^exponent.
+ */
+Uint16 FftQ15(int16 *re, int16 *im, Uint16 size)
+{
+    Uint16 exponent = 0;
+    Uint16 span, step, group, k, a, b, i;
+    int16 peak, value;
+    int32 tr, ti;
+
+    for(span = 1, step = FFT_MAX_SIZE / 2; span < size; span <<= 1, step >>= 1)
+    {
+        // Block scaling
+        peak = 0;
+        for(i = 0; i < size; i++)
+        {
+            value = (re[i] < 0) ? -re[i] : re[i];
+            if(value > peak)
+            {
+                peak = value;
+            }
+            value = (im[i] < 0) ? -im[i] : im[i];
+            if(value > peak)
+            {
+                peak = value;
+            }
+        }
+        if(peak > 8191)
+        {
+            for(i = 0; i < size; i++)
+            {
+                re[i] >>= 1;
+                im[i] >>= 1;
+            }
+            exponent++;
+        }
+
+        // Butterflies
+        for(group = 0; group < size; group += 2 * span)
+        {
+            for(k = 0; k < span; k++)
+            {
+                a = group + k;
+                b = a + span;
+                tr = ((int32)fftTwiddle[k * step][0] * re[b] - (int32)fftTwiddle[k * step][1] * im[b]) >> 15;
+                ti = ((int32)fftTwiddle[k * step][0] * im[b] + (int32)fftTwiddle[k * step][1] * re[b]) >> 15;
+                re[b] = (int16)(re[a] - tr);
+                im[b] = (int16)(im[a] - ti);
+                re[a] = (int16)(re[a] + tr);
+                im[a] = (int16)(im[a] + ti);
+            }
+        }
+    }
+
+    return exponent;
+}
+
+// Squared magnitude of bins 0 .. size/2 - 1
+void FftPower(const int16 *re, const int16 *im, Uint32 *power, Uint16 size)
+{
+    Uint16 i;
+
+    for(i = 0; i < size / 2; i++)
+    {
+        power[i] = (Uint32)((int32)re[i] * re[i]) + (Uint32)((int32)im[i] * im[i]);
+    }
+}
+
+/*
+ * Goertzel detector for one bin over a block of 12-bit ADC results.
+ * Returns the squared magnitude in the same units as an unscaled FFT of the centered samples.
+ */
+int64 GoertzelPower(const Uint16 *adc, Uint16 length, int16 coeff)
+{
+    int32 s0, s1 = 0, s2 = 0;
+    Uint16 i;
+
+    for(i = 0; i < length; i++)
+    {
+        s0 = ((int32)adc[i] - 2048) + (int32)(((int64)coeff * s1) >> 14) - s2;
+        s2 = s1;
+        s1 = s0;
+    }
+
+    return (int64)s1 * s1 + (int64)s2 * s2 - (((int64)coeff * s1 >> 14) * s2);
+}
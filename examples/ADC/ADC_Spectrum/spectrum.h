@@ -0,0 +1,40 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Fixed-point spectral analysis for the ADC_Spectrum example: an in-place radix-2 FFT with block scaling for any
+ * power-of-two size up to FFT_MAX_SIZE, and a Goertzel detector for single bins. The twiddle and bit-reversal tables
+ * are const, so they are placed in flash; smaller sizes use every (FFT_MAX_SIZE / size)-th twiddle.
+ *
+ * None of the functions touch peripheral registers. host/spectrum_bench.c checks them against a double-precision DFT
+ * and measures their cost per block size.
+ */
+
+#ifndef SPECTRUM_H
+#define SPECTRUM_H
+
+#ifdef __TMS320C2000__
+#include "F2802x_Device.h"
+#else
+#include <stdint.h>
+typedef uint16_t Uint16;
+typedef uint32_t Uint32;
+typedef int16_t int16;
+typedef int32_t int32;
+typedef int64_t int64;
+#endif
+
+#define FFT_MAX_SIZE  128 // Largest FFT length, size of the tables
+
+extern const int16 fftTwiddle[FFT_MAX_SIZE / 2][2];
+extern const Uint16 fftBitReverse[FFT_MAX_SIZE];
+
+void FftLoadAdcBlock(const Uint16 *adc, int16 *re, int16 *im, Uint16 size);
+Uint16 FftQ15(int16 *re, int16 *im, Uint16 size);
+void FftPower(const int16 *re, const int16 *im, Uint32 *power, Uint16 size);
+int64 GoertzelPower(const Uint16 *adc, Uint16 length, int16 coeff);
+
+#endif // SPECTRUM_H
@@ -0,0 +1,121 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Scan configuration, history rings and calibration table handling of the Multi_Channel_Read scan engine
+ * (see adc_scan.h).
+ */
+
+#include "adc_scan.h"
+
+void AdcScanInit(AdcScan *scan)
+{
+    Uint16 i, j;
+
+    for(i = 0; i < ADC_SCAN_NUM_CHANNELS; i++)
+    {
+        for(j = 0; j < ADC_HISTORY_DEPTH; j++)
+        {
+            scan->history[i][j] = 0;
+        }
+    }
+    scan->head = 0;
+    scan->scanCount = 0;
+}
+
+// Pack a channel table into the four ADCCHSELSEQx register values (0-7 = ADCINA0-7, 8-15 = ADCINB0-7)
+void AdcScanChannelSelect(const Uint16 *channels, Uint16 count, Uint16 *chsel)
+{
+    Uint16 i;
+
+    for(i = 0; i < 4; i++)
+    {
+        chsel[i] = 0;
+    }
+    for(i = 0; i < count; i++)
+    {
+        chsel[i >> 2] |= (channels[i] & 0xF) << ((i & 3) * 4); // Four 4-bit CONVxx fields per register
+    }
+}
+
+// Latest result of a channel slot in the scan table
+Uint16 AdcScanLatest(const AdcScan *scan, Uint16 slot)
+{
+    return scan->history[slot][(scan->head - 1) & (ADC_HISTORY_DEPTH - 1)];
+}
+
+Uint16 AdcCalChecksum(const AdcCalibration *cal)
+{
+    Uint16 sum = cal->magic;
+    Uint16 i;
+
+    for(i = 0; i < ADC_SCAN_NUM_CHANNELS; i++)
+    {
+        sum = (sum << 1 | sum >> 15) ^ (Uint16)cal->gain[i];
+        sum = (sum << 1 | sum >> 15) ^ (Uint16)((Uint32)cal->offset[i] & 0xFFFF);
+        sum = (sum << 1 | sum >> 15) ^ (Uint16)((Uint32)cal->offset[i] >> 16);
+    }
+    return sum;
+}
+
+Uint16 AdcCalIsValid(const AdcCalibration *cal)
+{
+    return (cal->magic == ADC_CAL_MAGIC) && (cal->checksum == AdcCalChecksum(cal));
+}
+
+// Set every channel to the same correction; individual entries can be trimmed afterwards
+void AdcCalSetAll(AdcCalibration *cal, int16 gain, int32 offset)
+{
+    Uint16 i;
+
+    for(i = 0; i < ADC_SCAN_NUM_CHANNELS; i++)
+    {
+        cal->gain[i] = gain;
+        cal->offset[i] = offset;
+    }
+    cal->magic = ADC_CAL_MAGIC;
+    cal->checksum = AdcCalChecksum(cal);
+}
+
+/*
+ * Measure both references and derive the gain and offset that map them onto their ideal
+ * results. Returns 0 and loads a unity correction if the references are implausible.
+ */
+Uint16 AdcCalMeasure(AdcCalibration *cal, AdcConvertFn convert)
+{
+    Uint32 sumLow = 0, sumHigh = 0;
+    int32 gain;
+    int32 offset;
+    Uint16 i;
+
+    for(i = 0; i < ADC_CAL_SAMPLES; i++)
+    {
+        sumLow += convert(ADC_CAL_LOW_CHANNEL);
+        sumHigh += convert(ADC_CAL_HIGH_CHANNEL);
+    }
+
+    if(sumHigh <= sumLow)
+    {
+        AdcCalSetAll(cal, 1 << ADC_CAL_SHIFT, 1L << (ADC_CAL_SHIFT - 1)); // Unity correction
+        return 0;
+    }
+
+    // gain = ideal span / measured span, both spans taken over ADC_CAL_SAMPLES conversions
+    gain = (int32)((((Uint32)(ADC_CAL_HIGH_EXPECTED - ADC_CAL_LOW_EXPECTED) * ADC_CAL_SAMPLES) << ADC_CAL_SHIFT) / (sumHigh - sumLow));
+    if(gain > 32767)
+    {
+        AdcCalSetAll(cal, 1 << ADC_CAL_SHIFT, 1L << (ADC_CAL_SHIFT - 1)); // Out of range, keep unity correction
+        return 0;
+    }
+
+    // offset = ideal low - measured low * gain, plus rounding
+    offset = ((int32)ADC_CAL_LOW_EXPECTED << ADC_CAL_SHIFT)
+           - (int32)(((int64)sumLow * gain) / ADC_CAL_SAMPLES)
+           + (1L << (ADC_CAL_SHIFT - 1));
+
+    AdcCalSetAll(cal, (int16)gain, offset);
+    return 1;
+}
@@ -0,0 +1,123 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * ADC scan engine of the Multi_Channel_Read example: scan configuration, the per-channel history rings and the
+ * per-channel offset/gain calibration. At boot two reference inputs are measured through a conversion callback, and
+ * the derived Q14 gain and offset are applied to every result as a single multiply-add (AdcCalApply). At the end of
+ * each scan AdcScanStore copies the corrected results from the result registers into one ring per channel.
+ *
+ * The settings below are shared by main.c and adc_scan.c; to change them for a whole project, edit them here or
+ * define them on the compiler command line. None of the functions touch peripheral registers: the result registers
+ * are passed in as a pointer. host/cal_test.c runs the calibration against a simulated ADC with injected offset and
+ * gain errors, and host/scan_bench.c measures the per-scan copy cost on a model of the result registers.
+ */
+
+#ifndef ADC_SCAN_H
+#define ADC_SCAN_H
+
+#ifdef __TMS320C2000__
+#include "F2802x_Device.h"
+#else
+#include <stdint.h>
+typedef uint16_t Uint16;
+typedef uint32_t Uint32;
+typedef int16_t int16;
+typedef int32_t int32;
+typedef int64_t int64;
+#endif
+
+#ifndef ADC_SCAN_NUM_CHANNELS
+#define ADC_SCAN_NUM_CHANNELS 2  // Number of channels converted per scan (1 to 16)
+#endif
+
+#ifndef ADC_HISTORY_DEPTH
+#define ADC_HISTORY_DEPTH     16 // Number of scans kept per channel (power of two)
+#endif
+
+#define ADC_CAL_LOW_CHANNEL    7      // ADCINA7, connected to the low calibration reference (0.5 V)
+#define ADC_CAL_HIGH_CHANNEL   15     // ADCINB7, connected to the high calibration reference (2.5 V)
+#define ADC_CAL_LOW_EXPECTED   621    // Ideal 12-bit result for the low reference (0.5 V / 3.3 V * 4096)
+#define ADC_CAL_HIGH_EXPECTED  3103   // Ideal 12-bit result for the high reference (2.5 V / 3.3 V * 4096)
+#define ADC_CAL_SAMPLES        64     // Conversions averaged per reference
+#define ADC_CAL_SHIFT          14     // Gain and offset terms are Q14
+#define ADC_CAL_MAGIC          0xCA1B // Marks a valid calibration table
+
+#if (ADC_SCAN_NUM_CHANNELS < 1) || (ADC_SCAN_NUM_CHANNELS > 16)
+#error "ADC_SCAN_NUM_CHANNELS must be between 1 and 16"
+#endif
+#if (ADC_HISTORY_DEPTH & (ADC_HISTORY_DEPTH - 1)) != 0
+#error "ADC_HISTORY_DEPTH must be a power of two"
+#endif
+
+typedef struct
+{
+    Uint16 history[ADC_SCAN_NUM_CHANNELS][ADC_HISTORY_DEPTH]; // One contiguous history ring per channel
+    volatile Uint16 head;      // Ring slot written by the next scan
+    volatile Uint32 scanCount; // Number of completed scans
+} AdcScan;
+
+/*
+ * Per-channel correction: corrected = (raw * gain + offset) >> ADC_CAL_SHIFT.
+ * The offset term already includes the rounding constant.
+ */
+typedef struct
+{
+    Uint16 magic;                        // ADC_CAL_MAGIC when the table is valid
+    int16 gain[ADC_SCAN_NUM_CHANNELS];   // Gain correction (Q14, 16384 = 1.0)
+    int32 offset[ADC_SCAN_NUM_CHANNELS]; // Offset term (Q14)
+    Uint16 checksum;                     // Guards the table in no-init RAM
+} AdcCalibration;
+
+typedef Uint16 (*AdcConvertFn)(Uint16 channel); // Returns the 12-bit result of one conversion
+
+Uint16 AdcCalChecksum(const AdcCalibration *cal);
+Uint16 AdcCalIsValid(const AdcCalibration *cal);
+void AdcCalSetAll(AdcCalibration *cal, int16 gain, int32 offset);
+Uint16 AdcCalMeasure(AdcCalibration *cal, AdcConvertFn convert);
+
+void AdcScanInit(AdcScan *scan);
+void AdcScanChannelSelect(const Uint16 *channels, Uint16 count, Uint16 *chsel);
+Uint16 AdcScanLatest(const AdcScan *scan, Uint16 slot);
+
+static inline Uint16 AdcCalApply(const AdcCalibration *cal, Uint16 channel, Uint16 raw)
+{
+    int32 value = ((int32)raw * cal->gain[channel] + cal->offset[channel]) >> ADC_CAL_SHIFT; // Single multiply-add
+
+    if(value < 0)
+    {
+        return 0;
+    }
+    if(value > 4095)
+    {
+        return 4095;
+    }
+    return (Uint16)value;
+}
+
+/*
+ * Copy the corrected 12-bit results of one scan from the (left-justified) result registers into the
+ * current ring slot and return that slot. The scan is not visible to readers until AdcScanPublish.
+ */
+static inline Uint16 AdcScanStore(AdcScan *scan, const AdcCalibration *cal, volatile const Uint16 *result)
+{
+    Uint16 slot = scan->head;
+    Uint16 i;
+
+    for(i = 0; i < ADC_SCAN_NUM_CHANNELS; i++)
+    {
+        scan->history[i][slot] = AdcCalApply(cal, i, result[i] >> 4);
+    }
+    return slot;
+}
+
+static inline void AdcScanPublish(AdcScan *scan)
+{
+    scan->head = (scan->head + 1) & (ADC_HISTORY_DEPTH - 1);
+    scan->scanCount++;
+}
+
+#endif // ADC_SCAN_H
@@ -0,0 +1,197 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Runs the Multi_Channel_Read calibration (adc_scan.c) on a Linux host against a simulated ADC. The simulated
+ * converter maps an ideal 12-bit input to raw = ideal * gain error + offset error + noise, rounded and clipped
+ * to 0..4095, and serves the two reference channels through the conversion callback as AdcConvertChannel does.
+ *
+ * For a grid of injected offset (-60 to +60 LSB) and gain (0.90 to 1.10) errors, AdcCalMeasure runs on the
+ * simulated references and every input code that the converter does not clip is then corrected with AdcCalApply;
+ * the result must be within 1 LSB of the ideal code (2 LSB with 1 LSB RMS of noise). Implausible references must
+ * fall back to unity correction, and the checksum must accept a stored table and reject a corrupted one, so a warm
+ * boot skips the measurement only when the table is intact. The exit status is 1 if any check fails.
+ *
+ * Build: gcc -O2 -I.. -o cal_test cal_test.c ../adc_scan.c -lm
+ */
+
+#include "adc_scan.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+static int failures;
+
+static double simGain = 1.0;      // Injected gain error
+static double simOffset = 0.0;    // Injected offset error (LSB)
+static double simNoise = 0.0;     // RMS noise (LSB)
+static double simLow = ADC_CAL_LOW_EXPECTED;   // Ideal code of the low reference input
+static double simHigh = ADC_CAL_HIGH_EXPECTED; // Ideal code of the high reference input
+static Uint32 simConversions;
+
+static void Check(const char *name, int ok)
+{
+    printf("  %-52s %s\n", name, ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        failures++;
+    }
+}
+
+static double Gaussian(void)
+{
+    double u1 = (rand() + 1.0) / (RAND_MAX + 2.0);
+    double u2 = (rand() + 1.0) / (RAND_MAX + 2.0);
+
+    return sqrt(-2.0 * log(u1)) * cos(6.283185307179586 * u2);
+}
+
+static Uint16 SimRaw(double ideal)
+{
+    double code = floor(ideal * simGain + simOffset + simNoise * Gaussian() + 0.5);
+
+    return (Uint16)(code < 0.0 ? 0.0 : (code > 4095.0 ? 4095.0 : code));
+}
+
+// Conversion callback for AdcCalMeasure
+static Uint16 SimConvert(Uint16 channel)
+{
+    simConversions++;
+    if(channel == ADC_CAL_LOW_CHANNEL)
+    {
+        return SimRaw(simLow);
+    }
+    if(channel == ADC_CAL_HIGH_CHANNEL)
+    {
+        return SimRaw(simHigh);
+    }
+    return SimRaw(2048.0);
+}
+
+// Largest |corrected - ideal| over the input codes the simulated converter does not clip, on every channel
+static int WorstError(const AdcCalibration *cal)
+{
+    int worst = 0;
+    int ideal, raw, error;
+    Uint16 channel;
+
+    for(channel = 0; channel < ADC_SCAN_NUM_CHANNELS; channel++)
+    {
+        for(ideal = 0; ideal < 4096; ideal++)
+        {
+            raw = (int)floor(ideal * simGain + simOffset + 0.5);
+            if(raw <= 0 || raw >= 4095)
+            {
+                continue; // Clipped by the converter, nothing to correct
+            }
+            error = abs((int)AdcCalApply(cal, channel, (Uint16)raw) - ideal);
+            worst = (error > worst) ? error : worst;
+        }
+    }
+    return worst;
+}
+
+static void TestErrorGrid(double noise, int limit)
+{
+    AdcCalibration cal;
+    int worst = 0, measured = 1, error;
+    char name[64];
+
+    simNoise = noise;
+    for(simOffset = -60.0; simOffset <= 60.0; simOffset += 15.0)
+    {
+        for(simGain = 0.90; simGain <= 1.1001; simGain += 0.025)
+        {
+            measured &= AdcCalMeasure(&cal, SimConvert);
+            error = WorstError(&cal);
+            worst = (error > worst) ? error : worst;
+        }
+    }
+    printf("    noise %.1f LSB RMS: largest corrected error %d LSB\n", noise, worst);
+    sprintf(name, "offset +-60 LSB, gain +-10%%, noise %.1f: within %d LSB", noise, limit);
+    Check(name, measured && worst <= limit);
+    simGain = 1.0;
+    simOffset = 0.0;
+    simNoise = 0.0;
+}
+
+static Uint16 IsUnity(const AdcCalibration *cal)
+{
+    Uint16 ok = AdcCalIsValid(cal);
+    Uint16 channel;
+
+    for(channel = 0; channel < ADC_SCAN_NUM_CHANNELS; channel++)
+    {
+        ok &= (cal->gain[channel] == (1 << ADC_CAL_SHIFT));
+        ok &= (AdcCalApply(cal, channel, 1234) == 1234);
+    }
+    return ok;
+}
+
+static void TestFallbacks(void)
+{
+    AdcCalibration cal;
+
+    simLow = ADC_CAL_HIGH_EXPECTED; // References swapped
+    simHigh = ADC_CAL_LOW_EXPECTED;
+    Check("swapped references: unity correction, returns 0", AdcCalMeasure(&cal, SimConvert) == 0 && IsUnity(&cal));
+
+    simLow = 2000.0; // References too close together: the gain would exceed 2.0
+    simHigh = 2600.0;
+    Check("span below half: unity correction, returns 0", AdcCalMeasure(&cal, SimConvert) == 0 && IsUnity(&cal));
+
+    simLow = ADC_CAL_LOW_EXPECTED;
+    simHigh = ADC_CAL_HIGH_EXPECTED;
+}
+
+static void TestWarmBoot(void)
+{
+    AdcCalibration cal;
+    Uint32 conversions;
+    Uint16 intact;
+
+    simGain = 1.05;
+    simOffset = 20.0;
+    simConversions = 0;
+    AdcCalMeasure(&cal, SimConvert);
+    Check("measured table is valid", AdcCalIsValid(&cal));
+    Check("measurement uses 2 * ADC_CAL_SAMPLES conversions", simConversions == 2UL * ADC_CAL_SAMPLES);
+
+    // Warm boot: main skips AdcCalMeasure when the retained table is valid
+    conversions = simConversions;
+    if(!AdcCalIsValid(&cal))
+    {
+        AdcCalMeasure(&cal, SimConvert);
+    }
+    Check("warm boot with intact table: no conversions", simConversions == conversions);
+
+    intact = 1;
+    cal.offset[ADC_SCAN_NUM_CHANNELS - 1] ^= 0x10000L; // Bit flipped in retained RAM
+    intact &= !AdcCalIsValid(&cal);
+    cal.offset[ADC_SCAN_NUM_CHANNELS - 1] ^= 0x10000L;
+    cal.gain[0] ^= 1;
+    intact &= !AdcCalIsValid(&cal);
+    cal.gain[0] ^= 1;
+    cal.magic = 0;
+    intact &= !AdcCalIsValid(&cal);
+    Check("corrupted gain, offset or magic: table rejected", intact);
+
+    simGain = 1.0;
+    simOffset = 0.0;
+}
+
+int main(void)
+{
+    srand(1);
+    TestErrorGrid(0.0, 1);
+    TestErrorGrid(1.0, 2);
+    TestFallbacks();
+    TestWarmBoot();
+
+    printf(failures ? "%d check(s) failed\n" : "All checks passed\n", failures);
+    return failures != 0;
+}
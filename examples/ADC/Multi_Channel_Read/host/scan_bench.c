@@ -0,0 +1,163 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Runs the Multi_Channel_Read scan engine (adc_scan.c) on a Linux host against a model of the ADC result registers:
+ * a volatile array of left-justified 12-bit results, read in the same order as ADCRESULT0..15 by adc_isr.
+ *
+ * The channel table must pack into the ADCCHSELSEQ1..4 values given in the reference manual. Over many scans
+ * (several wraps of the history rings) every ring slot must hold the corrected result of its channel, head and
+ * scanCount must advance once per published scan, and AdcScanLatest must return the newest result. It then prints
+ * the host time of AdcScanStore per scan and per channel, with unity and non-unity calibration, as a measure of the
+ * per-scan copy cost. The exit status is 1 if any check fails.
+ *
+ * Build: gcc -O2 -I.. -o scan_bench scan_bench.c ../adc_scan.c
+ * Add -DADC_SCAN_NUM_CHANNELS=16 to the build line to measure a full 16-channel scan.
+ */
+
+#include "adc_scan.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define TEST_SCANS    (7 * ADC_HISTORY_DEPTH + 3) // Several ring wraps, ending mid-ring
+#define BENCH_SCANS   20000000UL
+
+static int failures;
+static volatile Uint16 resultRegs[16]; // ADCRESULT0..15
+static volatile Uint32 sink;
+
+static void Check(const char *name, int ok)
+{
+    printf("  %-52s %s\n", name, ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        failures++;
+    }
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// 12-bit result of channel slot i in scan n, as the converter would produce it
+static Uint16 ModelResult(Uint32 n, Uint16 i)
+{
+    return (Uint16)((n * 37 + i * 211 + 5) & 0xFFF);
+}
+
+// Load the result registers with scan n, left-justified like the ADC
+static void ModelConvert(Uint32 n)
+{
+    Uint16 i;
+
+    for(i = 0; i < 16; i++)
+    {
+        resultRegs[i] = ModelResult(n, i) << 4;
+    }
+}
+
+static void TestChannelSelect(void)
+{
+    const Uint16 all[16] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15 };
+    const Uint16 pair[2] = { 0, 1 };
+    const Uint16 mixed[5] = { 15, 7, 8, 0, 3 };
+    Uint16 chsel[4];
+
+    AdcScanChannelSelect(all, 16, chsel);
+    Check("16 channels: ADCCHSELSEQ1..4 = 3210 7654 BA98 FEDC",
+          chsel[0] == 0x3210 && chsel[1] == 0x7654 && chsel[2] == 0xBA98 && chsel[3] == 0xFEDC);
+    AdcScanChannelSelect(pair, 2, chsel);
+    Check("ADCINA0, ADCINA1: ADCCHSELSEQ1 = 0010, rest 0",
+          chsel[0] == 0x0010 && chsel[1] == 0 && chsel[2] == 0 && chsel[3] == 0);
+    AdcScanChannelSelect(mixed, 5, chsel);
+    Check("B7 A7 B0 A0 A3: ADCCHSELSEQ1..2 = 087F 0003",
+          chsel[0] == 0x087F && chsel[1] == 0x0003 && chsel[2] == 0 && chsel[3] == 0);
+}
+
+static void TestStore(const AdcCalibration *cal, const char *name)
+{
+    static AdcScan scan;
+    Uint32 n, back;
+    Uint16 i, slot, ok = 1, latest = 1, order = 1;
+
+    AdcScanInit(&scan);
+    for(n = 0; n < TEST_SCANS; n++)
+    {
+        ModelConvert(n);
+        slot = AdcScanStore(&scan, cal, resultRegs);
+        order &= (slot == (n & (ADC_HISTORY_DEPTH - 1))) && (scan.scanCount == n); // Not published yet
+        AdcScanPublish(&scan);
+        for(i = 0; i < ADC_SCAN_NUM_CHANNELS; i++)
+        {
+            latest &= (AdcScanLatest(&scan, i) == AdcCalApply(cal, i, ModelResult(n, i)));
+        }
+    }
+
+    // Every slot holds one of the last ADC_HISTORY_DEPTH scans, oldest at head
+    for(back = 1; back <= ADC_HISTORY_DEPTH; back++)
+    {
+        slot = (scan.head - back) & (ADC_HISTORY_DEPTH - 1);
+        for(i = 0; i < ADC_SCAN_NUM_CHANNELS; i++)
+        {
+            ok &= (scan.history[i][slot] == AdcCalApply(cal, i, ModelResult(TEST_SCANS - back, i)));
+        }
+    }
+
+    printf("    %s:\n", name);
+    Check("head and scanCount advance once per published scan",
+          order && scan.scanCount == TEST_SCANS && scan.head == (TEST_SCANS & (ADC_HISTORY_DEPTH - 1)));
+    Check("AdcScanLatest returns the newest corrected result", latest);
+    Check("history rings hold the last ADC_HISTORY_DEPTH scans", ok);
+}
+
+static double BenchStore(const AdcCalibration *cal)
+{
+    static AdcScan scan;
+    unsigned long n;
+    double start;
+
+    AdcScanInit(&scan);
+    ModelConvert(0);
+    start = Now();
+    for(n = 0; n < BENCH_SCANS; n++)
+    {
+        resultRegs[0] = (Uint16)(n << 4); // A new conversion in every scan
+        AdcScanStore(&scan, cal, resultRegs);
+        AdcScanPublish(&scan);
+    }
+    sink += scan.history[0][0] + scan.scanCount;
+    return (Now() - start) * 1e9 / BENCH_SCANS;
+}
+
+int main(void)
+{
+    AdcCalibration unity, trimmed;
+    double ns;
+
+    AdcCalSetAll(&unity, 1 << ADC_CAL_SHIFT, 1L << (ADC_CAL_SHIFT - 1));
+    AdcCalSetAll(&trimmed, 17203, -318000L); // Gain 1.05, offset -19.4 LSB
+    trimmed.gain[0] = 15565;                   // Channel 0 trimmed separately
+    trimmed.checksum = AdcCalChecksum(&trimmed);
+
+    TestChannelSelect();
+    TestStore(&unity, "unity calibration");
+    TestStore(&trimmed, "gain 1.05, offset -19.4 LSB");
+
+    printf("Host copy cost of AdcScanStore + AdcScanPublish, %d channel(s):\n", ADC_SCAN_NUM_CHANNELS);
+    ns = BenchStore(&unity);
+    printf("  unity calibration     %6.2f ns/scan  %5.2f ns/channel\n", ns, ns / ADC_SCAN_NUM_CHANNELS);
+    ns = BenchStore(&trimmed);
+    printf("  trimmed calibration   %6.2f ns/scan  %5.2f ns/channel\n", ns, ns / ADC_SCAN_NUM_CHANNELS);
+
+    printf(failures ? "%d check(s) failed\n" : "All checks passed\n", failures);
+    return failures != 0;
+}
@@ -0,0 +1,204 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Runs the Multi_Channel_Read sliding-window statistics engine (window_stats.c) on a Linux host.
+ *
+ * For several synthetic 12-bit input patterns (noise, slow ramps, steps, long runs of equal samples and full-scale
+ * alternation), the mean, RMS, minimum, maximum and median reported after every sample must equal a full
+ * recomputation over the same window, including the priming with the first sample. It then prints the host time per
+ * sample of the incremental update (and all five reads) against the full recomputation, over 16 channels.
+ * The exit status is 1 if any check fails.
+ *
+ * Build: gcc -O2 -I.. -o stats_bench stats_bench.c ../window_stats.c -lm
+ * Other window sizes can be compared by adding e.g. -DSTATS_WINDOW_SIZE=256 to the build line.
+ */
+
+#include "window_stats.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define TEST_SAMPLES   200000L
+#define BENCH_SAMPLES  2000000UL
+#define BENCH_CHANNELS 16
+
+static int failures;
+static volatile Uint32 sink;
+
+typedef struct
+{
+    Uint16 mean, rms, min, max, median;
+} Stats;
+
+static void Check(const char *name, int ok)
+{
+    printf("  %-52s %s\n", name, ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        failures++;
+    }
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int CompareUint16(const void *a, const void *b)
+{
+    return (int)*(const Uint16 *)a - (int)*(const Uint16 *)b;
+}
+
+// Full recomputation over the window, with the same rounding as the WindowStats read functions
+static void Recompute(const Uint16 *window, Stats *r)
+{
+    Uint16 sorted[STATS_WINDOW_SIZE];
+    Uint32 sum = 0, sumSq = 0;
+    Uint16 i;
+
+    for(i = 0; i < STATS_WINDOW_SIZE; i++)
+    {
+        sum += window[i];
+        sumSq += (Uint32)window[i] * window[i];
+        sorted[i] = window[i];
+    }
+    qsort(sorted, STATS_WINDOW_SIZE, sizeof(Uint16), CompareUint16);
+    r->mean = (Uint16)(sum / STATS_WINDOW_SIZE);
+    r->rms = (Uint16)floor(sqrt((double)(sumSq / STATS_WINDOW_SIZE)));
+    r->min = sorted[0];
+    r->max = sorted[STATS_WINDOW_SIZE - 1];
+    r->median = (sorted[STATS_HALF_WINDOW - 1] + sorted[STATS_HALF_WINDOW]) >> 1;
+}
+
+static void Read(const WindowStats *s, Stats *r)
+{
+    r->mean = WindowStatsMean(s);
+    r->rms = WindowStatsRms(s);
+    r->min = WindowStatsMin(s);
+    r->max = WindowStatsMax(s);
+    r->median = WindowStatsMedian(s);
+}
+
+static Uint16 Pattern(int pattern, long n)
+{
+    switch(pattern)
+    {
+    case 0:
+        return (Uint16)(rand() & 0xFFF);                           // White noise, full scale
+    case 1:
+        return (Uint16)((n / 3) % 4096);                           // Slow rising ramp, wraps to 0
+    case 2:
+        return (Uint16)(((n / 97) & 1) ? 3000 + rand() % 4 : 500); // Steps with a little noise
+    case 3:
+        return (Uint16)(((n / 50) % 7) * 100);                     // Long runs of equal samples
+    default:
+        return (Uint16)((n & 1) ? 4095 : 0);                       // Full-scale alternation
+    }
+}
+
+static void TestPattern(int pattern, const char *name)
+{
+    static WindowStats s;
+    Uint16 window[STATS_WINDOW_SIZE];
+    Stats got, want;
+    long n;
+    Uint16 i, sample;
+    char label[64];
+
+    sample = Pattern(pattern, 0);
+    WindowStatsInit(&s, sample);
+    for(i = 0; i < STATS_WINDOW_SIZE; i++)
+    {
+        window[i] = sample; // Primed with the first sample
+    }
+    for(n = 0; n < TEST_SAMPLES; n++)
+    {
+        Read(&s, &got);
+        Recompute(window, &want);
+        if(got.mean != want.mean || got.rms != want.rms || got.min != want.min || got.max != want.max
+           || got.median != want.median)
+        {
+            printf("    %s: sample %ld: mean %u/%u rms %u/%u min %u/%u max %u/%u median %u/%u\n", name, n,
+                   got.mean, want.mean, got.rms, want.rms, got.min, want.min, got.max, want.max,
+                   got.median, want.median);
+            break;
+        }
+        sample = Pattern(pattern, n + 1);
+        WindowStatsUpdate(&s, sample);
+        window[n & (STATS_WINDOW_SIZE - 1)] = sample;
+    }
+    sprintf(label, "%s: all statistics match a recomputation", name);
+    Check(label, n == TEST_SAMPLES);
+}
+
+static void Bench(void)
+{
+    static WindowStats s[BENCH_CHANNELS];
+    static Uint16 window[BENCH_CHANNELS][STATS_WINDOW_SIZE];
+    static Uint16 input[4096];
+    Stats r;
+    unsigned long n;
+    Uint16 c;
+    double start, incremental, full;
+
+    for(n = 0; n < 4096; n++)
+    {
+        input[n] = (Uint16)(rand() & 0xFFF);
+    }
+    for(c = 0; c < BENCH_CHANNELS; c++)
+    {
+        WindowStatsInit(&s[c], input[c]);
+    }
+
+    start = Now();
+    for(n = 0; n < BENCH_SAMPLES; n += BENCH_CHANNELS)
+    {
+        for(c = 0; c < BENCH_CHANNELS; c++)
+        {
+            WindowStatsUpdate(&s[c], input[(n + c) & 4095]);
+            Read(&s[c], &r);
+            sink += r.mean + r.rms + r.min + r.max + r.median;
+        }
+    }
+    incremental = (Now() - start) * 1e9 / BENCH_SAMPLES;
+
+    start = Now();
+    for(n = 0; n < BENCH_SAMPLES; n += BENCH_CHANNELS)
+    {
+        for(c = 0; c < BENCH_CHANNELS; c++)
+        {
+            window[c][(n / BENCH_CHANNELS) & (STATS_WINDOW_SIZE - 1)] = input[(n + c) & 4095];
+            Recompute(window[c], &r);
+            sink += r.mean + r.rms + r.min + r.max + r.median;
+        }
+    }
+    full = (Now() - start) * 1e9 / BENCH_SAMPLES;
+
+    printf("Host cost per sample, window of %d, %d channels:\n", STATS_WINDOW_SIZE, BENCH_CHANNELS);
+    printf("  incremental update and reads  %8.1f ns\n", incremental);
+    printf("  full recomputation            %8.1f ns (%.1fx)\n", full, full / incremental);
+    printf("  WindowStats size              %8u bytes per channel\n", (unsigned)sizeof(WindowStats));
+}
+
+int main(void)
+{
+    srand(1);
+    TestPattern(0, "white noise");
+    TestPattern(1, "slow ramp");
+    TestPattern(2, "steps");
+    TestPattern(3, "equal runs");
+    TestPattern(4, "alternation");
+    Bench();
+
+    printf(failures ? "%d check(s) failed\n" : "All checks passed\n", failures);
+    return failures != 0;
+}
@@ -2,20 +2,98 @@
  * Author: Kiran Jojare
  * Email: kijo7257@colorado.edu
  * Date: Feb 23, 2024
- * Version: 1.0
+ * Version: 1.7
  *
  * Description:
  * This code demonstrates how to use the ADC (Analog-to-Digital Converter) to read multiple analog inputs sequentially on the Texas Instruments C2000 Piccolo LaunchPad Evaluation Kit (LAUNCHHXL-F28027F).
- * The analog inputs are connected to ADCINA0 and ADCINA1.
+ * The analog inputs are listed in the adcScanChannels table (ADCINA0 and ADCINA1 by default, up to 16 channels).
  *
- * The code initializes the system control and GPIO settings, configures the ADC to read the analog inputs sequentially,
- * and processes the ADC results.
+ * The code initializes the system control and GPIO settings, configures the cascaded sequencer to convert every channel in the table
+ * on each ePWM1 SOCA trigger, and copies the results into a per-channel history ring in the end-of-sequence interrupt.
+ * At boot two reference inputs are measured to derive a per-channel offset/gain correction, which the interrupt applies
+ * to every result as a single multiply-add. The table is kept in no-init RAM so a warm reset can skip the measurement.
+ * The scan engine and the calibration are implemented in adc_scan.c and adc_scan.h; add them from this folder to the project.
+ * The interrupt also compares every corrected result against per-channel limits with hysteresis and debounce, and posts
+ * limit events to a lock-free queue within the same invocation. The cycles added by this check are measured with CPU-Timer 1.
+ * The main loop is free for other work. When new scans have completed it feeds them into a per-channel sliding-window
+ * statistics engine (mean, RMS, min/max and median) that is updated incrementally instead of recomputing over the window.
+ * The statistics engine is implemented in window_stats.c and window_stats.h; add them from this folder to the project.
  *
  * This example is intended to help users get started with reading multiple analog inputs using the ADC on the F28027F microcontroller.
  */
 
 #include "F2802x_Device.h"
 #include "f2802x_examples.h"
+#include "adc_scan.h"
+#include "window_stats.h"
+
+#define ADC_EVENT_QUEUE_SIZE  16 // Limit events buffered for the main loop (power of two)
+
+#if (ADC_EVENT_QUEUE_SIZE & (ADC_EVENT_QUEUE_SIZE - 1)) != 0
+#error "ADC_EVENT_QUEUE_SIZE must be a power of two"
+#endif
+
+__interrupt void adc_isr(void);
+
+// Channel converted in each sequencer slot (0-7 = ADCINA0-7, 8-15 = ADCINB0-7)
+const Uint16 adcScanChannels[ADC_SCAN_NUM_CHANNELS] = { 0, 1 };
+
+AdcScan adcScan;
+
+// Not initialized by the C runtime, so the table survives a warm reset (map AdcCalNoInit to RAM in the linker command file)
+#pragma DATA_SECTION(adcCal, "AdcCalNoInit")
+AdcCalibration adcCal;
+
+// Limit state of a channel, also used as the event type
+#define ADC_LIMIT_NORMAL 0 // Inside the limits
+#define ADC_LIMIT_HIGH   1 // Above the high limit
+#define ADC_LIMIT_LOW    2 // Below the low limit
+
+typedef struct
+{
+    Uint16 high;       // Enter ADC_LIMIT_HIGH above this value
+    Uint16 low;        // Enter ADC_LIMIT_LOW below this value
+    Uint16 hysteresis; // Distance back inside a limit before the channel returns to normal
+    Uint16 debounce;   // Consecutive samples required before a state change (at least 1)
+} AdcThreshold;
+
+typedef struct
+{
+    Uint16 state;   // Current ADC_LIMIT_x state
+    Uint16 pending; // State the channel is moving towards
+    Uint16 count;   // Consecutive samples in the pending state
+} AdcThresholdState;
+
+typedef struct
+{
+    Uint16 channel; // Slot in the channel table
+    Uint16 type;    // New ADC_LIMIT_x state
+    Uint16 value;   // Corrected result that caused the change
+    Uint32 scan;    // scanCount of the triggering scan
+} AdcEvent;
+
+typedef struct
+{
+    AdcEvent event[ADC_EVENT_QUEUE_SIZE];
+    volatile Uint16 head;       // Written only by adc_isr
+    volatile Uint16 tail;       // Written only by the main loop
+    volatile Uint32 dropCount;  // Events lost because the queue was full
+} AdcEventQueue;
+
+// Limits per slot in the channel table (can be changed at run time)
+AdcThreshold adcThresholds[ADC_SCAN_NUM_CHANNELS] =
+{
+    { 3500, 500, 50, 3 }, // ADCINA0
+    { 3500, 500, 50, 3 }  // ADCINA1
+};
+AdcThresholdState adcThresholdState[ADC_SCAN_NUM_CHANNELS];
+AdcEventQueue adcEvents;
+
+volatile Uint32 adcThresholdCycles;    // CPU cycles spent in the limit checks of the last scan
+volatile Uint32 adcThresholdCyclesMax; // Worst case since reset
+
+WindowStats adcStats[ADC_SCAN_NUM_CHANNELS];
+Uint32 adcStatsMissedScans; // Scans that were overwritten in the history before the main loop read them
 
 void InitAdc()
 {
@@ -29,33 +107,269 @@ void InitAdc()
     EDIS;
 }
 
-void ConfigureAdcSequence()
+void ConfigureAdcSequence(const Uint16 *channels, Uint16 count)
+{
+    Uint16 chsel[4];
+
+    AdcScanChannelSelect(channels, count, chsel); // Four 4-bit CONVxx fields per register
+
+    EALLOW;
+    AdcRegs.ADCTRL1.bit.SEQ_CASC = 1; // Cascaded mode
+    AdcRegs.ADCMAXCONV.bit.MAX_CONV1 = count - 1; // Conversions per scan
+    AdcRegs.ADCCHSELSEQ1.all = chsel[0]; // CONV00 - CONV03
+    AdcRegs.ADCCHSELSEQ2.all = chsel[1]; // CONV04 - CONV07
+    AdcRegs.ADCCHSELSEQ3.all = chsel[2]; // CONV08 - CONV11
+    AdcRegs.ADCCHSELSEQ4.all = chsel[3]; // CONV12 - CONV15
+    AdcRegs.ADCTRL2.bit.EPWM_SOCA_SEQ1 = 1; // Start a scan on EPWM SOCA
+    AdcRegs.ADCTRL2.bit.INT_ENA_SEQ1 = 1; // Interrupt at end of sequence
+    AdcRegs.ADCTRL2.bit.RST_SEQ1 = 1; // Reset SEQ1
+    EDIS;
+}
+
+void InitEPwm()
+{
+    EALLOW;
+    SysCtrlRegs.PCLKCR0.bit.TBCLKSYNC = 1; // Enable TBCLK within the EPWM
+    EPwm1Regs.ETSEL.bit.SOCAEN = 1; // Enable SOC on A group
+    EPwm1Regs.ETSEL.bit.SOCASEL = 4; // Select SOC from CMPA on upcount
+    EPwm1Regs.ETPS.bit.SOCAPRD = 1; // Generate pulse on 1st event
+    EPwm1Regs.CMPA.half.CMPA = 0x0080; // Set compare A value
+    EPwm1Regs.TBPRD = 0xFFFF; // Set period for ePWM1 (scan rate)
+    EPwm1Regs.TBCTL.bit.CTRMODE = TB_COUNT_UP; // Up-count mode
+    EDIS;
+}
+
+// Feed every scan completed since lastScan from the history rings into the statistics
+void AdcStatsUpdate(Uint32 *lastScan)
+{
+    Uint32 scanCount;
+    Uint32 pending;
+    Uint16 head, slot, i;
+
+    DINT; // Read a consistent head / scanCount pair
+    head = adcScan.head;
+    scanCount = adcScan.scanCount;
+    EINT;
+
+    pending = scanCount - *lastScan;
+    if(pending > ADC_HISTORY_DEPTH)
+    {
+        adcStatsMissedScans += pending - ADC_HISTORY_DEPTH; // Older scans are already overwritten
+        pending = ADC_HISTORY_DEPTH;
+    }
+
+    slot = (head - (Uint16)pending) & (ADC_HISTORY_DEPTH - 1); // Oldest unread scan
+    while(pending--)
+    {
+        for(i = 0; i < ADC_SCAN_NUM_CHANNELS; i++)
+        {
+            if(*lastScan == 0)
+            {
+                WindowStatsInit(&adcStats[i], adcScan.history[i][slot]); // First scan primes the window
+            }
+            else
+            {
+                WindowStatsUpdate(&adcStats[i], adcScan.history[i][slot]);
+            }
+        }
+        slot = (slot + 1) & (ADC_HISTORY_DEPTH - 1);
+        (*lastScan)++;
+    }
+    *lastScan = scanCount;
+}
+
+// Single software-started conversion, only used at boot before the scan is configured
+Uint16 AdcConvertChannel(Uint16 channel)
 {
     EALLOW;
     AdcRegs.ADCTRL1.bit.SEQ_CASC = 1; // Cascaded mode
-    AdcRegs.ADCMAXCONV.bit.MAX_CONV1 = 1; // Two conversions
-    AdcRegs.ADCCHSELSEQ1.bit.CONV00 = 0; // ADCINA0
-    AdcRegs.ADCCHSELSEQ1.bit.CONV01 = 1; // ADCINA1
+    AdcRegs.ADCMAXCONV.bit.MAX_CONV1 = 0; // One conversion
+    AdcRegs.ADCCHSELSEQ1.bit.CONV00 = channel; // Reference channel
+    AdcRegs.ADCTRL2.bit.RST_SEQ1 = 1; // Reset SEQ1
+    EDIS;
+
+    AdcRegs.ADCTRL2.bit.SOC_SEQ1 = 1; // Start conversion
+    while(AdcRegs.ADCST.bit.SEQ1_BSY == 1); // Wait for conversion to complete
+    return AdcRegs.ADCRESULT0 >> 4; // 12-bit result
+}
+
+/*
+ * Limit checks. These functions do not touch peripheral registers and can be
+ * compiled on a host together with the event queue.
+ */
+static inline void AdcEventPost(AdcEventQueue *q, Uint16 channel, Uint16 type, Uint16 value, Uint32 scan)
+{
+    Uint16 head = q->head;
+    Uint16 next = (head + 1) & (ADC_EVENT_QUEUE_SIZE - 1);
+
+    if(next == q->tail)
+    {
+        q->dropCount++; // Queue full
+        return;
+    }
+    q->event[head].channel = channel;
+    q->event[head].type = type;
+    q->event[head].value = value;
+    q->event[head].scan = scan;
+    q->head = next; // Publish after the record is written
+}
+
+Uint16 AdcEventGet(AdcEventQueue *q, AdcEvent *event)
+{
+    Uint16 tail = q->tail;
+
+    if(tail == q->head)
+    {
+        return 0; // Queue empty
+    }
+    *event = q->event[tail];
+    q->tail = (tail + 1) & (ADC_EVENT_QUEUE_SIZE - 1); // Release the record after it is copied
+    return 1;
+}
+
+static inline void AdcThresholdCheck(const AdcThreshold *t, AdcThresholdState *st, Uint16 channel, Uint16 value, Uint32 scan)
+{
+    Uint16 target;
+
+    // Fast path: normal channel inside its limits
+    if(st->state == ADC_LIMIT_NORMAL && value <= t->high && value >= t->low)
+    {
+        st->count = 0;
+        return;
+    }
+
+    if(value > t->high)
+    {
+        target = ADC_LIMIT_HIGH;
+    }
+    else if(value < t->low)
+    {
+        target = ADC_LIMIT_LOW;
+    }
+    else if(st->state == ADC_LIMIT_HIGH && value + t->hysteresis > t->high)
+    {
+        target = ADC_LIMIT_HIGH; // Still inside the high hysteresis band
+    }
+    else if(st->state == ADC_LIMIT_LOW && value < t->low + t->hysteresis)
+    {
+        target = ADC_LIMIT_LOW; // Still inside the low hysteresis band
+    }
+    else
+    {
+        target = ADC_LIMIT_NORMAL;
+    }
+
+    if(target == st->state)
+    {
+        st->count = 0;
+        return;
+    }
+    if(target != st->pending)
+    {
+        st->pending = target; // Restart debounce towards the new state
+        st->count = 0;
+    }
+    if(++st->count >= t->debounce)
+    {
+        st->state = target;
+        st->count = 0;
+        AdcEventPost(&adcEvents, channel, target, value, scan);
+    }
+}
+
+// Free-running CPU-Timer 1 (counts SYSCLKOUT cycles down), used to measure ISR cost
+void InitCpuTimer1()
+{
+    EALLOW;
+    CpuTimer1Regs.PRD.all = 0xFFFFFFFF; // Maximum period
+    CpuTimer1Regs.TPR.all = 0;          // Count every SYSCLKOUT cycle
+    CpuTimer1Regs.TPRH.all = 0;
+    CpuTimer1Regs.TCR.bit.TSS = 1;    // Stop the timer
+    CpuTimer1Regs.TCR.bit.TRB = 1;    // Reload the timer
+    CpuTimer1Regs.TCR.bit.TIE = 0;    // No timer interrupt
+    CpuTimer1Regs.TCR.bit.TSS = 0;    // Start the timer
     EDIS;
 }
 
 void main(void)
 {
-    Uint16 adcResult0, adcResult1;
+    Uint32 lastScan = 0;
+    Uint16 mean0, rms0, min0, max0, median0;
+    AdcEvent event;
 
     InitSysCtrl(); // Initialize the CPU and configure the clock
     DINT;          // Disable CPU interrupts
 
     InitAdc();     // Initialize the ADC
-    ConfigureAdcSequence(); // Configure ADC sequence
+    if(!AdcCalIsValid(&adcCal))
+    {
+        AdcCalMeasure(&adcCal, AdcConvertChannel); // Cold boot: measure the calibration references
+    }
+    AdcScanInit(&adcScan); // Empty the history rings
+    ConfigureAdcSequence(adcScanChannels, ADC_SCAN_NUM_CHANNELS); // Configure ADC scan from the channel table
+    InitEPwm();    // Initialize EPWM to trigger ADC scans
+    InitCpuTimer1(); // Start the cycle counter
+
+    InitPieCtrl(); // Initialize the PIE control registers
+    InitPieVectTable(); // Initialize the PIE vector table
+
+    EALLOW;
+    PieVectTable.ADCINT1 = &adc_isr; // Map ISR to the PIE vector table
+    EDIS;
+
+    IER |= M_INT1; // Enable CPU INT1
+    PieCtrlRegs.PIEIER1.bit.INTx6 = 1; // Enable PIE Group 1 interrupt 6
+
+    EINT;  // Enable Global interrupt INTM
+    ERTM;  // Enable Global realtime interrupt DBGM
 
     while(1)
     {
-        AdcRegs.ADCTRL2.bit.SOC_SEQ1 = 1; // Start conversion
-        while(AdcRegs.ADCST.bit.SEQ1_BSY == 1); // Wait for conversion to complete
-        adcResult0 = AdcRegs.ADCRESULT0 >> 4; // Get ADC result for ADCINA0
-        adcResult1 = AdcRegs.ADCRESULT1 >> 4; // Get ADC result for ADCINA1
+        if(adcScan.scanCount != lastScan)
+        {
+            AdcStatsUpdate(&lastScan); // Feed all new scans into the window statistics
+
+            mean0 = WindowStatsMean(&adcStats[0]);     // Window statistics for ADCINA0
+            rms0 = WindowStatsRms(&adcStats[0]);
+            min0 = WindowStatsMin(&adcStats[0]);
+            max0 = WindowStatsMax(&adcStats[0]);
+            median0 = WindowStatsMedian(&adcStats[0]);
 
-        // Do something with the ADC results
+            // Do something with the ADC results and statistics
+        }
+
+        while(AdcEventGet(&adcEvents, &event))
+        {
+            // React to limit events (event.channel entered event.type at scan event.scan)
+        }
+
+        // Other work runs here while the ADC scans in the background
     }
 }
+
+__interrupt void adc_isr(void)
+{
+    Uint16 slot;
+    Uint16 i;
+    Uint32 start, cycles;
+
+    slot = AdcScanStore(&adcScan, &adcCal, &AdcRegs.ADCRESULT0); // Copy corrected results into the channel rings (result registers are contiguous)
+
+    start = CpuTimer1Regs.TIM.all;
+    for(i = 0; i < ADC_SCAN_NUM_CHANNELS; i++)
+    {
+        AdcThresholdCheck(&adcThresholds[i], &adcThresholdState[i], i, adcScan.history[i][slot], adcScan.scanCount);
+    }
+    cycles = start - CpuTimer1Regs.TIM.all; // Timer counts down
+    adcThresholdCycles = cycles;
+    if(cycles > adcThresholdCyclesMax)
+    {
+        adcThresholdCyclesMax = cycles;
+    }
+
+    AdcScanPublish(&adcScan); // Make the scan visible to the main loop
+
+    AdcRegs.ADCTRL2.bit.RST_SEQ1 = 1; // Reset SEQ1 for the next scan
+    AdcRegs.ADCINTFLGCLR.bit.ADCINT1 = 1; // Clear ADCINT1 flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP1; // Acknowledge interrupt
+}
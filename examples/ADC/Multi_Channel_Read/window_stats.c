@@ -0,0 +1,202 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Sliding-window statistics engine of the Multi_Channel_Read example (see window_stats.h).
+ */
+
+#include "window_stats.h"
+
+static inline Uint16 StatsAbove(const WindowStats *s, Uint16 slotA, Uint16 slotB, Uint16 isMax)
+{
+    return isMax ? (s->value[slotA] > s->value[slotB]) : (s->value[slotA] < s->value[slotB]);
+}
+
+static void StatsHeapSwap(WindowStats *s, Uint16 i, Uint16 j)
+{
+    Uint16 slot = s->heap[i];
+
+    s->heap[i] = s->heap[j];
+    s->heap[j] = slot;
+    s->heapPos[s->heap[i]] = i;
+    s->heapPos[s->heap[j]] = j;
+}
+
+static void StatsSiftUp(WindowStats *s, Uint16 base, Uint16 pos, Uint16 isMax)
+{
+    Uint16 parent;
+
+    while(pos > base)
+    {
+        parent = base + ((pos - base - 1) >> 1);
+        if(!StatsAbove(s, s->heap[pos], s->heap[parent], isMax))
+        {
+            break;
+        }
+        StatsHeapSwap(s, pos, parent);
+        pos = parent;
+    }
+}
+
+static void StatsSiftDown(WindowStats *s, Uint16 base, Uint16 pos, Uint16 isMax)
+{
+    Uint16 end = base + STATS_HALF_WINDOW;
+    Uint16 child;
+
+    while(1)
+    {
+        child = base + 2 * (pos - base) + 1;
+        if(child >= end)
+        {
+            break;
+        }
+        if((child + 1 < end) && StatsAbove(s, s->heap[child + 1], s->heap[child], isMax))
+        {
+            child++; // Pick the child that belongs higher in the heap
+        }
+        if(!StatsAbove(s, s->heap[child], s->heap[pos], isMax))
+        {
+            break;
+        }
+        StatsHeapSwap(s, pos, child);
+        pos = child;
+    }
+}
+
+// The window starts out filled with the first sample
+void WindowStatsInit(WindowStats *s, Uint16 firstSample)
+{
+    Uint16 i;
+
+    for(i = 0; i < STATS_WINDOW_SIZE; i++)
+    {
+        s->value[i] = firstSample;
+        s->heap[i] = i;
+        s->heapPos[i] = i;
+    }
+    s->seq = 0;
+    s->sum = (Uint32)firstSample * STATS_WINDOW_SIZE;
+    s->sumSq = (Uint32)firstSample * firstSample * STATS_WINDOW_SIZE;
+
+    s->maxDeque[0] = (Uint16)(s->seq - 1); // Only the newest of equal samples is kept
+    s->minDeque[0] = (Uint16)(s->seq - 1);
+    s->maxHead = 0;
+    s->maxCount = 1;
+    s->minHead = 0;
+    s->minCount = 1;
+}
+
+void WindowStatsUpdate(WindowStats *s, Uint16 sample)
+{
+    const Uint16 mask = STATS_WINDOW_SIZE - 1;
+    Uint16 seq = s->seq;
+    Uint16 slot = seq & mask;
+    Uint16 expired = (Uint16)(seq - STATS_WINDOW_SIZE);
+    Uint16 old = s->value[slot];
+    Uint16 pos;
+
+    // Running sums (modulo 2^32 arithmetic, the true sums always fit)
+    s->sum += (Uint32)sample - old;
+    s->sumSq += (Uint32)sample * sample - (Uint32)old * old;
+
+    // Drop the outgoing sample from the front of the deques before its slot is overwritten
+    if(s->maxCount && s->maxDeque[s->maxHead] == expired)
+    {
+        s->maxHead = (s->maxHead + 1) & mask;
+        s->maxCount--;
+    }
+    if(s->minCount && s->minDeque[s->minHead] == expired)
+    {
+        s->minHead = (s->minHead + 1) & mask;
+        s->minCount--;
+    }
+
+    s->value[slot] = sample;
+
+    // Monotonic deques: remove samples from the back that can never become the max / min
+    while(s->maxCount && s->value[s->maxDeque[(s->maxHead + s->maxCount - 1) & mask] & mask] <= sample)
+    {
+        s->maxCount--;
+    }
+    s->maxDeque[(s->maxHead + s->maxCount++) & mask] = seq;
+    while(s->minCount && s->value[s->minDeque[(s->minHead + s->minCount - 1) & mask] & mask] >= sample)
+    {
+        s->minCount--;
+    }
+    s->minDeque[(s->minHead + s->minCount++) & mask] = seq;
+
+    // Median heaps: restore the heap holding the replaced slot, then the order between the heaps
+    pos = s->heapPos[slot];
+    if(pos < STATS_HALF_WINDOW)
+    {
+        StatsSiftUp(s, 0, pos, 1);
+        StatsSiftDown(s, 0, s->heapPos[slot], 1);
+    }
+    else
+    {
+        StatsSiftUp(s, STATS_HALF_WINDOW, pos, 0);
+        StatsSiftDown(s, STATS_HALF_WINDOW, s->heapPos[slot], 0);
+    }
+    if(s->value[s->heap[0]] > s->value[s->heap[STATS_HALF_WINDOW]])
+    {
+        StatsHeapSwap(s, 0, STATS_HALF_WINDOW);
+        StatsSiftDown(s, 0, 0, 1);
+        StatsSiftDown(s, STATS_HALF_WINDOW, STATS_HALF_WINDOW, 0);
+    }
+
+    s->seq = seq + 1;
+}
+
+Uint16 WindowStatsMean(const WindowStats *s)
+{
+    return (Uint16)(s->sum / STATS_WINDOW_SIZE);
+}
+
+Uint16 WindowStatsMax(const WindowStats *s)
+{
+    return s->value[s->maxDeque[s->maxHead] & (STATS_WINDOW_SIZE - 1)];
+}
+
+Uint16 WindowStatsMin(const WindowStats *s)
+{
+    return s->value[s->minDeque[s->minHead] & (STATS_WINDOW_SIZE - 1)];
+}
+
+Uint16 WindowStatsMedian(const WindowStats *s)
+{
+    return (s->value[s->heap[0]] + s->value[s->heap[STATS_HALF_WINDOW]]) >> 1;
+}
+
+// Integer square root, one result bit per iteration
+Uint16 ISqrt32(Uint32 value)
+{
+    Uint32 root = 0;
+    Uint32 bit = 1UL << 30;
+
+    while(bit > value)
+    {
+        bit >>= 2;
+    }
+    while(bit != 0)
+    {
+        if(value >= root + bit)
+        {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return (Uint16)root;
+}
+
+Uint16 WindowStatsRms(const WindowStats *s)
+{
+    return ISqrt32(s->sumSq / STATS_WINDOW_SIZE);
+}
@@ -0,0 +1,68 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Sliding-window statistics engine of the Multi_Channel_Read example: mean, RMS, minimum, maximum and median of the
+ * last STATS_WINDOW_SIZE samples of a channel, updated incrementally with every new sample instead of recomputed over
+ * the window. All storage is sized at compile time, one WindowStats per channel.
+ *
+ * The functions do not touch peripheral registers. host/stats_bench.c checks them against a full recomputation and
+ * compares the cost of both.
+ */
+
+#ifndef WINDOW_STATS_H
+#define WINDOW_STATS_H
+
+#ifdef __TMS320C2000__
+#include "F2802x_Device.h"
+#else
+#include <stdint.h>
+typedef uint16_t Uint16;
+typedef uint32_t Uint32;
+#endif
+
+#ifndef STATS_WINDOW_SIZE
+#define STATS_WINDOW_SIZE     32 // Samples per statistics window (power of two, 2 to 256)
+#endif
+#define STATS_HALF_WINDOW     (STATS_WINDOW_SIZE / 2)
+
+#if (STATS_WINDOW_SIZE < 2) || (STATS_WINDOW_SIZE > 256) || ((STATS_WINDOW_SIZE & (STATS_WINDOW_SIZE - 1)) != 0)
+#error "STATS_WINDOW_SIZE must be a power of two between 2 and 256" // 256 * 4095^2 still fits the 32-bit sum of squares
+#endif
+
+/*
+ * Sliding-window statistics for one channel. All storage is sized at compile time.
+ *
+ * - sum / sumSq: running sums, O(1) per sample
+ * - maxDeque / minDeque: monotonic deques of sample sequence numbers, amortized O(1) per sample
+ * - heap: window slots split into a max-heap (lower half, heap[0 .. H-1]) and a min-heap
+ *   (upper half, heap[H .. W-1]). The outgoing sample is replaced in place, so the heaps
+ *   never change size and the median update is O(log W).
+ */
+typedef struct
+{
+    Uint16 value[STATS_WINDOW_SIZE];    // Window samples, indexed by sequence number modulo the window size
+    Uint16 heap[STATS_WINDOW_SIZE];     // Window slots arranged as two heaps
+    Uint16 heapPos[STATS_WINDOW_SIZE];  // Position of each slot in heap[]
+    Uint16 maxDeque[STATS_WINDOW_SIZE]; // Sequence numbers with non-increasing values
+    Uint16 minDeque[STATS_WINDOW_SIZE]; // Sequence numbers with non-decreasing values
+    Uint16 maxHead, maxCount;
+    Uint16 minHead, minCount;
+    Uint16 seq;                         // Sequence number of the next sample
+    Uint32 sum;                         // Sum of the window samples
+    Uint32 sumSq;                       // Sum of the squared window samples
+} WindowStats;
+
+void WindowStatsInit(WindowStats *s, Uint16 firstSample);
+void WindowStatsUpdate(WindowStats *s, Uint16 sample);
+Uint16 WindowStatsMean(const WindowStats *s);
+Uint16 WindowStatsMax(const WindowStats *s);
+Uint16 WindowStatsMin(const WindowStats *s);
+Uint16 WindowStatsMedian(const WindowStats *s);
+Uint16 WindowStatsRms(const WindowStats *s);
+Uint16 ISqrt32(Uint32 value);
+
+#endif // WINDOW_STATS_H
@@ -0,0 +1,410 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Runs two ISO-TP nodes against each other on a simulated 500 kbps CAN bus, on a Linux host. Each node has its own
+ * eCAN register model (../../CAN_Receive/host/ecan_model.c), receive ring (can_rx.c), transmit queue (can_tx.c) and
+ * tick counter; the engines use globals, so the simulation swaps a node's state in before running its interrupts and
+ * main loop and out again afterwards. Between frames the bus runs arbitration: of the frames the two modules would
+ * start, the lower identifier wins, is acknowledged by its sender and stored by the other node.
+ *
+ * The scenarios check single and segmented transfers byte for byte, block size and STmin pacing on the bus, both
+ * directions at once, extended identifiers, and the error cases (receiver overflow, a lost CF, a lost FC). The
+ * benchmark then measures payload throughput for several message sizes, block sizes and STmin values. The exit
+ * status is 1 if any check fails.
+ *
+ * Build: gcc -O2 -I.. -I../../CAN_Receive -I../../CAN_Trasmit -I../../CAN_Receive/host -o isotp_sim isotp_sim.c ../isotp.c ../../CAN_Receive/can_rx.c ../../CAN_Trasmit/can_tx.c ../../CAN_Receive/host/ecan_model.c
+ */
+
+#include "isotp.h"
+#include "ecan_model.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define BIT_RATE      500000UL
+#define TICK_BITS     (ISOTP_TICK_US * (BIT_RATE / 1000) / 1000)  // Bit times per IsoTpTick
+#define TX_MAILBOXES  0x0FFFFFFFUL                                  // 27-0 transmit, 31-28 receive
+#define LOG_SIZE      8192
+
+typedef struct
+{
+    EcanModel model;
+    CanRx rx;
+    CanTx tx;
+    Uint32 ticks;
+    Uint32 nextTick;                 // Bit time of the next IsoTpTick
+    IsoTpLink link;
+    IsoTpMessage txMessage;
+    IsoTpMessage rxMessage;
+    Uint16 txData[ISOTP_MAX_LENGTH];
+    Uint16 rxData[ISOTP_MAX_LENGTH];
+    Uint16 repost;                   // Post the receive buffer again when a message ends
+    Uint16 resend;                   // Send the message again when it ends (benchmark)
+    Uint32 bytesReceived;            // Bytes of messages received with ISOTP_STATUS_DONE
+} Node;
+
+typedef struct
+{
+    Uint32 id;
+    Uint16 pci;
+    Uint32 end;                      // Bit time the frame ended
+} LogEntry;
+
+static Node nodes[2];
+static Uint32 now;
+static Uint32 busyBits;
+static Uint16 dropPci;               // Lose the next frame with this PCI nibble (0xFF for none)
+static LogEntry busLog[LOG_SIZE];
+static Uint16 logCount;
+static int failures;
+
+static void Check(const char *name, int ok)
+{
+    printf("  %-52s %s\n", name, ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        failures++;
+    }
+}
+
+static void Select(Node *node)
+{
+    ecanModel = node->model;
+    canRx = node->rx;
+    canTx = node->tx;
+    isoTpTicks = node->ticks;
+}
+
+static void Deselect(Node *node)
+{
+    node->model = ecanModel;
+    node->rx = canRx;
+    node->tx = canTx;
+    node->ticks = isoTpTicks;
+}
+
+static Node *NodeOf(IsoTpMessage *m)
+{
+    return (m == &nodes[0].txMessage || m == &nodes[0].rxMessage) ? &nodes[0] : &nodes[1];
+}
+
+static void ReceiveDone(IsoTpMessage *m)
+{
+    Node *node = NodeOf(m);
+
+    if(m->status == ISOTP_STATUS_DONE)
+    {
+        node->bytesReceived += m->length;
+    }
+    if(node->repost)
+    {
+        IsoTpReceive(&node->link, m);
+    }
+}
+
+static void SendDone(IsoTpMessage *m)
+{
+    Node *node = NodeOf(m);
+
+    if(node->resend)
+    {
+        IsoTpSend(&node->link, m);
+    }
+}
+
+static void Setup(Uint32 idA, Uint32 idB, Uint16 blockSize, Uint16 stMin)
+{
+    CanRxFilter filter;
+    Uint16 i, j;
+
+    now = 0;
+    busyBits = 0;
+    logCount = 0;
+    dropPci = 0xFF;
+    for(i = 0; i < 2; i++)
+    {
+        memset(&nodes[i], 0, sizeof(Node));
+        filter.id = i ? idA : idB;
+        filter.mask = (filter.id & CAN_ID_EXT) ? ECAN_EXT_MASK : 0x7FF;
+        filter.depth = 4;
+        Select(&nodes[i]);
+        EcanModelReset();
+        memset(&canRx, 0, sizeof(canRx));
+        memset(&canTx, 0, sizeof(canTx));
+        isoTpTicks = 0;
+        CanRxInit(&filter, 1, 31);
+        CanTxInit(TX_MAILBOXES);
+        Deselect(&nodes[i]);
+        IsoTpInit(&nodes[i].link, i ? idB : idA, filter.id, blockSize, stMin);
+        nodes[i].txMessage.data = nodes[i].txData;
+        nodes[i].txMessage.done = SendDone;
+        nodes[i].rxMessage.data = nodes[i].rxData;
+        nodes[i].rxMessage.size = ISOTP_MAX_LENGTH;
+        nodes[i].rxMessage.done = ReceiveDone;
+        for(j = 0; j < ISOTP_MAX_LENGTH; j++)
+        {
+            nodes[i].txData[j] = (j * 13 + (j >> 8) + i * 101) & 0xFF;
+        }
+    }
+}
+
+// Interrupts and main loop of a node at the current time; returns the mailbox its module would send next
+static Uint16 NodeRun(Node *node)
+{
+    CanFrame frame;
+    Uint16 start;
+
+    Select(node);
+    while(node->nextTick <= now)
+    {
+        IsoTpTick();
+        node->nextTick += TICK_BITS;
+    }
+    ecanModel.regs[ECAN_CANTSC] = now;
+    if(EcanModelInterrupt(0))
+    {
+        CanRxService();
+    }
+    if(EcanModelInterrupt(1))
+    {
+        CanTxService();
+    }
+    while(CanRxPop(&frame))
+    {
+        IsoTpFrame(&node->link, &frame);
+    }
+    IsoTpPoll(&node->link);
+    start = EcanModelTransmitStart();
+    Deselect(node);
+    return start;
+}
+
+// Bits of a frame including the interframe space, without stuff bits
+static Uint32 FrameBits(const CanFrame *frame)
+{
+    return ((frame->id & CAN_ID_EXT) ? 67 : 47) + 8 * frame->dlc;
+}
+
+static Uint32 Key(Uint32 id)
+{
+    if(id & CAN_ID_EXT)
+    {
+        return (((id >> 18) & 0x7FF) << 19) | (1UL << 18) | (id & 0x3FFFF);
+    }
+    return (id & 0x7FF) << 19;
+}
+
+// One frame on the bus, or one tick of idle bus
+static void Step(void)
+{
+    CanFrame frame;
+    Uint16 start[2];
+    Uint16 winner;
+    Uint16 i;
+    struct MBOX *mbox[2];
+
+    for(i = 0; i < 2; i++)
+    {
+        start[i] = NodeRun(&nodes[i]);
+        mbox[i] = &nodes[i].model.mbox[start[i] & (ECAN_MAILBOXES - 1)];
+    }
+    if(start[0] == ECAN_MODEL_NONE && start[1] == ECAN_MODEL_NONE)
+    {
+        now = (nodes[0].nextTick < nodes[1].nextTick) ? nodes[0].nextTick : nodes[1].nextTick;
+        return;
+    }
+    if(start[1] == ECAN_MODEL_NONE)
+    {
+        winner = 0;
+    }
+    else if(start[0] == ECAN_MODEL_NONE)
+    {
+        winner = 1;
+    }
+    else
+    {
+        winner = Key(EcanFrameId(mbox[1]->MSGID.all)) < Key(EcanFrameId(mbox[0]->MSGID.all));
+        nodes[!winner].model.transmitting = ECAN_MODEL_NONE; // Lost arbitration, tries again next time
+    }
+
+    Select(&nodes[winner]);
+    EcanModelTransmitEnd(&frame);
+    Deselect(&nodes[winner]);
+    now += FrameBits(&frame);
+    busyBits += FrameBits(&frame);
+    if(logCount < LOG_SIZE)
+    {
+        busLog[logCount].id = frame.id;
+        busLog[logCount].pci = frame.data[0] >> 4;
+        busLog[logCount].end = now;
+        logCount++;
+    }
+    if(dropPci == frame.data[0] >> 4)
+    {
+        dropPci = 0xFF; // Lost to the receiver, e.g. a bus error it could not recover from
+        return;
+    }
+    Select(&nodes[!winner]);
+    EcanModelReceive(&frame);
+    Deselect(&nodes[!winner]);
+}
+
+static void Run(Uint32 bits)
+{
+    Uint32 end = now + bits;
+
+    while(now < end)
+    {
+        Step();
+    }
+}
+
+static void Transfer(Uint16 from, Uint16 length)
+{
+    nodes[from].txMessage.length = length;
+    IsoTpReceive(&nodes[!from].link, &nodes[!from].rxMessage);
+    IsoTpSend(&nodes[from].link, &nodes[from].txMessage);
+}
+
+static int Received(Uint16 to, Uint16 length)
+{
+    Node *node = &nodes[to];
+
+    return node->rxMessage.status == ISOTP_STATUS_DONE && node->rxMessage.length == length
+           && memcmp(node->rxData, nodes[!to].txData, length * sizeof(Uint16)) == 0;
+}
+
+// Smallest time between the ends of two CFs in the bus log, in bit times
+static Uint32 MinCfGap(void)
+{
+    Uint32 gap = 0xFFFFFFFFUL;
+    Uint32 last = 0;
+    Uint16 i;
+
+    for(i = 0; i < logCount; i++)
+    {
+        if(busLog[i].pci != 2)
+        {
+            last = 0;
+            continue;
+        }
+        if(last != 0 && busLog[i].end - last < gap)
+        {
+            gap = busLog[i].end - last;
+        }
+        last = busLog[i].end;
+    }
+    return gap;
+}
+
+static Uint16 CountPci(Uint16 pci)
+{
+    Uint16 count = 0;
+    Uint16 i;
+
+    for(i = 0; i < logCount; i++)
+    {
+        count += busLog[i].pci == pci;
+    }
+    return count;
+}
+
+static void Benchmark(Uint16 length, Uint16 blockSize, Uint16 stMin)
+{
+    Uint32 bits = 2 * BIT_RATE; // 2 s
+
+    Setup(0x7E0, 0x7E8, blockSize, stMin);
+    nodes[1].repost = 1;
+    nodes[0].resend = 1;
+    Transfer(0, length);
+    Run(bits);
+    printf("  %4u bytes  BS %3u  STmin 0x%02X  %6.2f kB/s  bus %5.1f%%\n", length, blockSize, stMin,
+           nodes[1].bytesReceived / 2.0 / 1000, 100.0 * busyBits / now);
+}
+
+int main(void)
+{
+    Uint16 fc;
+
+    printf("ISO-TP over eCAN, two nodes at 500 kbps\n");
+
+    Setup(0x7E0, 0x7E8, 0, 0);
+    Transfer(0, 5);
+    Run(1000);
+    Check("single frame delivered", Received(1, 5) && logCount == 1);
+
+    Setup(0x7E0, 0x7E8, 8, 0);
+    Transfer(0, ISOTP_MAX_LENGTH);
+    Run(BIT_RATE / 2);
+    fc = CountPci(3);
+    Check("4095 bytes, BS 8: delivered byte for byte", Received(1, ISOTP_MAX_LENGTH)
+          && nodes[0].txMessage.status == ISOTP_STATUS_DONE);
+    Check("one FC per block of 8 CFs", fc == 1 + (CountPci(2) - 1) / 8 && CountPci(2) == (ISOTP_MAX_LENGTH - 6 + 7 - 1) / 7);
+
+    Setup(0x7E0, 0x7E8, 0, 0xF5);
+    Transfer(0, 300);
+    Run(BIT_RATE / 2);
+    Check("STmin 500 us: CFs at least 500 us apart", Received(1, 300) && MinCfGap() >= 500 * (BIT_RATE / 1000) / 1000);
+    Setup(0x7E0, 0x7E8, 4, 2);
+    Transfer(0, 300);
+    Run(BIT_RATE / 2);
+    Check("STmin 2 ms, BS 4: CFs at least 2 ms apart", Received(1, 300) && MinCfGap() >= 2 * (BIT_RATE / 1000));
+
+    Setup(0x7E0, 0x7E8, 0, 0);
+    Transfer(0, 2000);
+    Transfer(1, 1500);
+    Run(BIT_RATE / 2);
+    Check("both directions at once", Received(1, 2000) && Received(0, 1500));
+
+    Setup(CAN_ID_EXT | 0x18DA10F1UL, CAN_ID_EXT | 0x18DAF110UL, 0, 0);
+    Transfer(0, 1000);
+    Run(BIT_RATE / 2);
+    Check("29-bit identifiers", Received(1, 1000));
+
+    Setup(0x7E0, 0x7E8, 0, 0);
+    nodes[1].rxMessage.size = 100;
+    Transfer(0, 200);
+    Run(BIT_RATE / 10);
+    Check("buffer too small: FC overflow ends both sides", nodes[0].txMessage.status == ISOTP_STATUS_OVERFLOW
+          && nodes[1].rxMessage.status == ISOTP_STATUS_OVERFLOW && CountPci(2) == 0);
+
+    Setup(0x7E0, 0x7E8, 0, 0);
+    Transfer(0, 500);
+    Run(2000);
+    dropPci = 2;
+    Run(BIT_RATE / 2);
+    Check("lost CF: receiver reports wrong sequence number", nodes[1].rxMessage.status == ISOTP_STATUS_WRONG_SN);
+
+    Setup(0x7E0, 0x7E8, 0, 0);
+    dropPci = 3;
+    Transfer(0, 500);
+    Run(3 * BIT_RATE / 2);
+    Check("lost FC: N_Bs and N_Cr time out after 1 s", nodes[0].txMessage.status == ISOTP_STATUS_TIMEOUT
+          && nodes[1].rxMessage.status == ISOTP_STATUS_TIMEOUT);
+
+    Setup(0x7E0, 0x7E8, 0, 0);
+    nodes[1].repost = 1;
+    nodes[0].resend = 1;
+    Transfer(0, ISOTP_MAX_LENGTH);
+    Run(BIT_RATE);
+    Check("back-to-back messages, no receive errors", nodes[1].link.errors == 0 && nodes[1].link.messagesReceived > 5
+          && nodes[1].link.noBuffer == 0 && nodes[0].rx.dropped == 0 && nodes[1].rx.dropped == 0);
+
+    printf("Throughput (8-byte frames of 111 bits, at most 7 payload bytes each: %.2f kB/s)\n",
+           7.0 * BIT_RATE / 111 / 1000);
+    Benchmark(ISOTP_MAX_LENGTH, 0, 0);
+    Benchmark(ISOTP_MAX_LENGTH, 8, 0);
+    Benchmark(ISOTP_MAX_LENGTH, 32, 0);
+    Benchmark(ISOTP_MAX_LENGTH, 0, 0xF2);
+    Benchmark(ISOTP_MAX_LENGTH, 0, 1);
+    Benchmark(512, 0, 0);
+    Benchmark(64, 0, 0);
+    Benchmark(7, 0, 0);
+
+    printf(failures ? "%d check(s) failed\n" : "All checks passed\n", failures);
+    return failures != 0;
+}
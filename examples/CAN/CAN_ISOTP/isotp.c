@@ -0,0 +1,444 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Segmentation, reassembly and flow control of the ISO-TP transport layer (see isotp.h).
+ */
+
+#include "isotp.h"
+
+// Protocol control information, high nibble of byte 0
+#define ISOTP_PCI_SF  0x0
+#define ISOTP_PCI_FF  0x1
+#define ISOTP_PCI_CF  0x2
+#define ISOTP_PCI_FC  0x3
+
+// Flow status of an FC
+#define ISOTP_FS_CTS       0
+#define ISOTP_FS_WAIT      1
+#define ISOTP_FS_OVERFLOW  2
+
+// Transmit states
+#define ISOTP_TX_IDLE     0
+#define ISOTP_TX_SF       1   // SF waiting for room in the transmit queue
+#define ISOTP_TX_FF       2   // FF waiting for room in the transmit queue
+#define ISOTP_TX_WAIT_FC  3
+#define ISOTP_TX_CF       4
+
+// Receive states
+#define ISOTP_RX_IDLE     0
+#define ISOTP_RX_CF       1   // FF received, expecting CFs
+
+volatile Uint32 isoTpTicks;
+
+void IsoTpInit(IsoTpLink *link, Uint32 txId, Uint32 rxId, Uint16 blockSize, Uint16 stMin)
+{
+    link->txId = txId;
+    link->rxId = rxId;
+    link->blockSize = blockSize & 0xFF;
+    link->stMin = stMin & 0xFF;
+    link->tx = 0;
+    link->txState = ISOTP_TX_IDLE;
+    link->rx = 0;
+    link->rxState = ISOTP_RX_IDLE;
+    link->fcPending = 0;
+    link->framesSent = 0;
+    link->framesReceived = 0;
+    link->messagesSent = 0;
+    link->messagesReceived = 0;
+    link->ignored = 0;
+    link->noBuffer = 0;
+    link->errors = 0;
+}
+
+// Ticks a sender waits between CFs for an STmin byte: 0-127 ms, 0xF1-0xF9 100-900 us, reserved values 127 ms
+static Uint16 IsoTpGap(Uint16 stMin)
+{
+    if(stMin <= 0x7F)
+    {
+        return stMin * (1000 / ISOTP_TICK_US);
+    }
+    if(stMin >= 0xF1 && stMin <= 0xF9)
+    {
+        return ((stMin - 0xF0) * 100 + ISOTP_TICK_US - 1) / ISOTP_TICK_US;
+    }
+    return 0x7F * (1000 / ISOTP_TICK_US);
+}
+
+static void IsoTpEndTx(IsoTpLink *link, Uint16 status)
+{
+    IsoTpMessage *m = link->tx;
+
+    link->tx = 0; // The callback may send the next message
+    link->txState = ISOTP_TX_IDLE;
+    if(status == ISOTP_STATUS_DONE)
+    {
+        link->messagesSent++;
+    }
+    else
+    {
+        link->errors++;
+    }
+    m->status = status;
+    if(m->done)
+    {
+        m->done(m);
+    }
+}
+
+static void IsoTpEndRx(IsoTpLink *link, Uint16 status)
+{
+    IsoTpMessage *m = link->rx;
+
+    link->rx = 0; // The callback may post the next buffer
+    link->rxState = ISOTP_RX_IDLE;
+    if(status == ISOTP_STATUS_DONE)
+    {
+        link->messagesReceived++;
+    }
+    else
+    {
+        link->errors++;
+    }
+    m->status = status;
+    if(m->done)
+    {
+        m->done(m);
+    }
+}
+
+// Queue a frame of the PCI bytes, then length bytes of data, padded to 8 bytes; returns 0 if the queue is full
+static Uint16 IsoTpSendFrame(IsoTpLink *link, const Uint16 *pci, Uint16 pciLength, const Uint16 *data, Uint16 length)
+{
+    CanFrame frame;
+    Uint16 i;
+
+    frame.id = link->txId;
+    frame.dlc = 8;
+    frame.timestamp = 0;
+    for(i = 0; i < pciLength; i++)
+    {
+        frame.data[i] = pci[i];
+    }
+    for(i = 0; i < length; i++)
+    {
+        frame.data[pciLength + i] = data[i] & 0xFF;
+    }
+    for(i = pciLength + length; i < 8; i++)
+    {
+        frame.data[i] = ISOTP_PADDING;
+    }
+    if(!CanTxSend(&frame))
+    {
+        return 0;
+    }
+    link->framesSent++;
+    return 1;
+}
+
+static void IsoTpSendFc(IsoTpLink *link, Uint16 flowStatus)
+{
+    Uint16 pci[3];
+
+    pci[0] = (ISOTP_PCI_FC << 4) | flowStatus;
+    pci[1] = link->blockSize;
+    pci[2] = link->stMin;
+    link->fcPending = IsoTpSendFrame(link, pci, 3, 0, 0) ? 0 : flowStatus + 1; // Retried by IsoTpPoll
+}
+
+// Start sending a message; returns 0 if the link is still sending or the length is 0 or above ISOTP_MAX_LENGTH
+Uint16 IsoTpSend(IsoTpLink *link, IsoTpMessage *m)
+{
+    if(link->tx != 0 || m->length == 0 || m->length > ISOTP_MAX_LENGTH)
+    {
+        return 0;
+    }
+    m->status = ISOTP_STATUS_ACTIVE;
+    link->tx = m;
+    link->txState = (m->length <= 7) ? ISOTP_TX_SF : ISOTP_TX_FF;
+    return 1;
+}
+
+// Post the buffer the next message is received into; returns 0 if one is already posted
+Uint16 IsoTpReceive(IsoTpLink *link, IsoTpMessage *m)
+{
+    if(link->rx != 0)
+    {
+        return 0;
+    }
+    m->length = 0;
+    m->status = ISOTP_STATUS_ACTIVE;
+    link->rx = m;
+    return 1;
+}
+
+// Copy count data bytes of a frame, from byte first on, to the end of the message being received
+static void IsoTpCopy(IsoTpLink *link, const CanFrame *frame, Uint16 first, Uint16 count)
+{
+    Uint16 *dst = link->rx->data + link->rx->length;
+    Uint16 i;
+
+    for(i = 0; i < count; i++)
+    {
+        dst[i] = frame->data[first + i] & 0xFF;
+    }
+    link->rx->length += count;
+}
+
+static void IsoTpSingleFrame(IsoTpLink *link, const CanFrame *frame)
+{
+    Uint16 length = frame->data[0] & 0xF;
+
+    if(length == 0 || length > 7 || frame->dlc < length + 1)
+    {
+        link->ignored++;
+        return;
+    }
+    if(link->rxState != ISOTP_RX_IDLE)
+    {
+        IsoTpEndRx(link, ISOTP_STATUS_ABORTED); // A new message replaces the one in progress
+    }
+    if(link->rx == 0)
+    {
+        link->noBuffer++;
+    }
+    else if(length > link->rx->size)
+    {
+        IsoTpEndRx(link, ISOTP_STATUS_OVERFLOW);
+    }
+    else
+    {
+        IsoTpCopy(link, frame, 1, length);
+        IsoTpEndRx(link, ISOTP_STATUS_DONE);
+    }
+}
+
+static void IsoTpFirstFrame(IsoTpLink *link, const CanFrame *frame)
+{
+    Uint16 length = ((frame->data[0] & 0xF) << 8) | (frame->data[1] & 0xFF);
+
+    if(length <= 7 || frame->dlc < 8)
+    {
+        link->ignored++;
+        return;
+    }
+    if(link->rxState != ISOTP_RX_IDLE)
+    {
+        IsoTpEndRx(link, ISOTP_STATUS_ABORTED);
+    }
+    if(link->rx == 0 || length > link->rx->size)
+    {
+        IsoTpSendFc(link, ISOTP_FS_OVERFLOW);
+        if(link->rx == 0)
+        {
+            link->noBuffer++;
+        }
+        else
+        {
+            IsoTpEndRx(link, ISOTP_STATUS_OVERFLOW);
+        }
+        return;
+    }
+    IsoTpCopy(link, frame, 2, 6);
+    link->rxLength = length;
+    link->rxSn = 1;
+    link->rxBlock = link->blockSize;
+    link->rxTime = isoTpTicks;
+    link->rxState = ISOTP_RX_CF;
+    IsoTpSendFc(link, ISOTP_FS_CTS);
+}
+
+static void IsoTpConsecutiveFrame(IsoTpLink *link, const CanFrame *frame)
+{
+    Uint16 count;
+
+    if(link->rxState != ISOTP_RX_CF)
+    {
+        link->ignored++;
+        return;
+    }
+    if((frame->data[0] & 0xF) != link->rxSn)
+    {
+        IsoTpEndRx(link, ISOTP_STATUS_WRONG_SN);
+        return;
+    }
+    count = link->rxLength - link->rx->length;
+    if(count > 7)
+    {
+        count = 7;
+    }
+    if(frame->dlc < count + 1)
+    {
+        link->ignored++;
+        return;
+    }
+    IsoTpCopy(link, frame, 1, count);
+    link->rxSn = (link->rxSn + 1) & 0xF;
+    link->rxTime = isoTpTicks;
+    if(link->rx->length == link->rxLength)
+    {
+        IsoTpEndRx(link, ISOTP_STATUS_DONE);
+    }
+    else if(link->rxBlock != 0 && --link->rxBlock == 0)
+    {
+        link->rxBlock = link->blockSize;
+        IsoTpSendFc(link, ISOTP_FS_CTS); // Next block
+    }
+}
+
+static void IsoTpFlowControl(IsoTpLink *link, const CanFrame *frame)
+{
+    if(link->txState != ISOTP_TX_WAIT_FC || frame->dlc < 3)
+    {
+        link->ignored++;
+        return;
+    }
+    switch(frame->data[0] & 0xF)
+    {
+    case ISOTP_FS_CTS:
+        link->txBlock = frame->data[1] & 0xFF;
+        link->txGap = IsoTpGap(frame->data[2] & 0xFF);
+        link->txWaits = 0;
+        link->txTime = isoTpTicks - link->txGap - 1; // STmin applies between CFs, the first may go at once
+        link->txState = ISOTP_TX_CF;
+        break;
+    case ISOTP_FS_WAIT:
+        if(++link->txWaits > ISOTP_WAIT_LIMIT)
+        {
+            IsoTpEndTx(link, ISOTP_STATUS_ABORTED);
+        }
+        else
+        {
+            link->txTime = isoTpTicks; // N_Bs starts again
+        }
+        break;
+    case ISOTP_FS_OVERFLOW:
+        IsoTpEndTx(link, ISOTP_STATUS_OVERFLOW);
+        break;
+    default:
+        IsoTpEndTx(link, ISOTP_STATUS_ABORTED);
+        break;
+    }
+}
+
+// Main loop: pass each received frame; returns 1 if it belonged to this link
+Uint16 IsoTpFrame(IsoTpLink *link, const CanFrame *frame)
+{
+    if(frame->id != link->rxId || frame->dlc == 0)
+    {
+        return 0;
+    }
+    link->framesReceived++;
+    switch((frame->data[0] >> 4) & 0xF)
+    {
+    case ISOTP_PCI_SF:
+        IsoTpSingleFrame(link, frame);
+        break;
+    case ISOTP_PCI_FF:
+        IsoTpFirstFrame(link, frame);
+        break;
+    case ISOTP_PCI_CF:
+        IsoTpConsecutiveFrame(link, frame);
+        break;
+    case ISOTP_PCI_FC:
+        IsoTpFlowControl(link, frame);
+        break;
+    default:
+        link->ignored++;
+        break;
+    }
+    return 1;
+}
+
+// Send the CFs that the block size, STmin and the transmit queue allow now
+static void IsoTpSendCfs(IsoTpLink *link)
+{
+    IsoTpMessage *m = link->tx;
+    Uint16 pci;
+    Uint16 count;
+
+    while(link->txGap != 0 ? (Uint32)(isoTpTicks - link->txTime) > link->txGap : CanTxPending() < ISOTP_TX_AHEAD)
+    {
+        count = m->length - link->txOffset;
+        if(count > 7)
+        {
+            count = 7;
+        }
+        pci = (ISOTP_PCI_CF << 4) | link->txSn;
+        if(!IsoTpSendFrame(link, &pci, 1, m->data + link->txOffset, count))
+        {
+            return;
+        }
+        link->txOffset += count;
+        link->txSn = (link->txSn + 1) & 0xF;
+        link->txTime = isoTpTicks;
+        if(link->txOffset == m->length)
+        {
+            IsoTpEndTx(link, ISOTP_STATUS_DONE); // Done once the last CF is queued
+            return;
+        }
+        if(link->txBlock != 0 && --link->txBlock == 0)
+        {
+            link->txState = ISOTP_TX_WAIT_FC;
+            return;
+        }
+    }
+}
+
+// Main loop: send what is due and check the timeouts
+void IsoTpPoll(IsoTpLink *link)
+{
+    Uint16 pci[2];
+
+    if(link->fcPending != 0)
+    {
+        IsoTpSendFc(link, link->fcPending - 1);
+    }
+
+    switch(link->txState)
+    {
+    case ISOTP_TX_SF:
+        pci[0] = (ISOTP_PCI_SF << 4) | link->tx->length;
+        if(IsoTpSendFrame(link, pci, 1, link->tx->data, link->tx->length))
+        {
+            IsoTpEndTx(link, ISOTP_STATUS_DONE);
+        }
+        break;
+    case ISOTP_TX_FF:
+        pci[0] = (ISOTP_PCI_FF << 4) | (link->tx->length >> 8);
+        pci[1] = link->tx->length & 0xFF;
+        if(IsoTpSendFrame(link, pci, 2, link->tx->data, 6))
+        {
+            link->txOffset = 6;
+            link->txSn = 1;
+            link->txTime = isoTpTicks;
+            link->txState = ISOTP_TX_WAIT_FC;
+        }
+        break;
+    case ISOTP_TX_WAIT_FC:
+        if((Uint32)(isoTpTicks - link->txTime) >= ISOTP_TIMEOUT_TICKS)
+        {
+            IsoTpEndTx(link, ISOTP_STATUS_TIMEOUT);
+        }
+        break;
+    case ISOTP_TX_CF:
+        IsoTpSendCfs(link);
+        break;
+    default:
+        break;
+    }
+
+    if(link->rxState == ISOTP_RX_CF && (Uint32)(isoTpTicks - link->rxTime) >= ISOTP_TIMEOUT_TICKS)
+    {
+        IsoTpEndRx(link, ISOTP_STATUS_TIMEOUT);
+    }
+}
+
+// Call every ISOTP_TICK_US, e.g. from a CPU timer interrupt
+void IsoTpTick(void)
+{
+    isoTpTicks++;
+}
@@ -0,0 +1,95 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * ISO-TP (ISO 15765-2) transport layer for the CAN_ISOTP example: messages of up to 4095 bytes over classic CAN
+ * frames with normal 11-bit or 29-bit addressing. A message of up to 7 bytes goes in a single frame (SF); a longer one
+ * in a first frame (FF) and consecutive frames (CF), paced by the receiver's flow control frames (FC) with their
+ * block size (BS) and minimum separation time (STmin).
+ *
+ * A link is one pair of identifiers and works both ways at once. Received bytes are written straight from the CAN
+ * frame into the buffer the caller posted with IsoTpReceive, and sent bytes are read straight from the caller's
+ * buffer, so no message is ever copied whole. Frames come from the eCAN receive ring of ../CAN_Receive/can_rx.c
+ * (IsoTpFrame) and go out through the transmit queue of ../CAN_Trasmit/can_tx.c. Timing uses IsoTpTick, called every
+ * ISOTP_TICK_US. host/isotp_sim.c runs two nodes against each other on a simulated bus.
+ */
+
+#ifndef ISOTP_H
+#define ISOTP_H
+
+#include "can_rx.h"
+#include "can_tx.h"
+
+#define ISOTP_MAX_LENGTH     4095   // Largest message: 12-bit FF_DL
+#define ISOTP_PADDING        0xCC   // Unused bytes of a frame, every frame is sent with 8 bytes
+#define ISOTP_TICK_US        100    // IsoTpTick period, also the STmin resolution
+#define ISOTP_TIMEOUT_TICKS  10000  // N_Bs (waiting for FC) and N_Cr (waiting for CF): 1 s
+#define ISOTP_WAIT_LIMIT     10     // FC WAIT frames accepted in a row (N_WFTmax)
+#define ISOTP_TX_AHEAD       8      // Frames a sender keeps in the transmit queue when STmin is 0
+
+// Message status
+#define ISOTP_STATUS_IDLE      0
+#define ISOTP_STATUS_ACTIVE    1
+#define ISOTP_STATUS_DONE      2
+#define ISOTP_STATUS_TIMEOUT   3    // No FC (sender) or CF (receiver) within ISOTP_TIMEOUT_TICKS
+#define ISOTP_STATUS_OVERFLOW  4    // Receiver buffer too small: FC overflow sent or received
+#define ISOTP_STATUS_WRONG_SN  5    // CF out of sequence, the message was abandoned
+#define ISOTP_STATUS_ABORTED   6    // New SF/FF during a reception, invalid FC, or too many FC WAIT
+
+typedef struct IsoTpMessage IsoTpMessage;
+
+struct IsoTpMessage
+{
+    Uint16 *data;                        // One byte per word: bytes to send, or buffer to receive into
+    Uint16 length;                       // Bytes to send, or bytes received
+    Uint16 size;                         // Buffer size (receive)
+    void (*done)(IsoTpMessage *m);       // Called from IsoTpFrame or IsoTpPoll when it ends, may be 0
+    volatile Uint16 status;              // ISOTP_STATUS_*
+};
+
+typedef struct
+{
+    Uint32 txId;                         // Identifier of the frames this node sends, CAN_ID_EXT for extended
+    Uint32 rxId;                         // Identifier of the frames this node receives
+    Uint16 blockSize;                    // BS asked of the sender, 0 = all CFs after one FC
+    Uint16 stMin;                        // STmin byte asked of the sender
+
+    IsoTpMessage *tx;                    // Message being sent, 0 when idle
+    Uint16 txState;                      // ISOTP_TX_* in isotp.c
+    Uint16 txOffset;                     // Bytes of tx framed so far
+    Uint16 txSn;                         // Sequence number of the next CF
+    Uint16 txBlock;                      // CFs left before the next FC, 0 = unlimited
+    Uint16 txGap;                        // Ticks between CFs from the receiver's STmin
+    Uint16 txWaits;                      // FC WAIT frames in a row
+    Uint32 txTime;                       // isoTpTicks at the last frame sent or FC received
+
+    IsoTpMessage *rx;                    // Posted buffer, 0 when none
+    Uint16 rxState;                      // ISOTP_RX_* in isotp.c
+    Uint16 rxLength;                     // FF_DL of the message being received
+    Uint16 rxSn;                         // Sequence number of the next CF
+    Uint16 rxBlock;                      // CFs left before the next FC, 0 = unlimited
+    Uint16 fcPending;                    // Flow status + 1 of an FC the transmit queue refused, 0 for none
+    Uint32 rxTime;                       // isoTpTicks at the last FF or CF received
+
+    Uint32 framesSent;
+    Uint32 framesReceived;               // Frames for this link passed to IsoTpFrame
+    Uint32 messagesSent;
+    Uint32 messagesReceived;
+    Uint32 ignored;                      // Frames that fit no state, e.g. a CF with no reception in progress
+    Uint32 noBuffer;                     // SF or FF arriving with no buffer posted
+    Uint32 errors;                       // Messages ended with a status other than ISOTP_STATUS_DONE
+} IsoTpLink;
+
+extern volatile Uint32 isoTpTicks;
+
+void IsoTpInit(IsoTpLink *link, Uint32 txId, Uint32 rxId, Uint16 blockSize, Uint16 stMin);
+Uint16 IsoTpSend(IsoTpLink *link, IsoTpMessage *m);
+Uint16 IsoTpReceive(IsoTpLink *link, IsoTpMessage *m);
+Uint16 IsoTpFrame(IsoTpLink *link, const CanFrame *frame);
+void IsoTpPoll(IsoTpLink *link);
+void IsoTpTick(void);
+
+#endif // ISOTP_H
@@ -0,0 +1,197 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.1
+ *
+ * Description:
+ * This code demonstrates ISO-TP (ISO 15765-2) segmented transfers over the CAN module on the Texas Instruments C2000 Piccolo LaunchPad Evaluation Kit (LAUNCHHXL-F28027F).
+ * The CAN module is configured to communicate at a baud rate of 500 kbps.
+ *
+ * A tester sends messages to this node on REQUEST_ID and receives its answers on RESPONSE_ID. A message of up to
+ * CAL_SIZE bytes is taken as a new calibration table; the one-byte request LOG_REQUEST is answered with the LOG_SIZE
+ * bytes of logDump. Requests are received straight into the one of the two calBuffers that calTable does not point
+ * to, and calTable switches to it only when a calibration table has arrived complete, so a log request or a failed
+ * transfer never touches the table in use. Frames are received by ECAN0INT into the ring of
+ * ../CAN_Receive/can_rx.c and sent through the transmit queue of ../CAN_Trasmit/can_tx.c on ECAN1INT; the ISO-TP
+ * layer (isotp.c) runs in the main loop, timed by CPU-Timer 0 every 100 us. Add isotp.c and isotp.h from this folder,
+ * can_rx.c, can_rx.h and ecan.h from ../CAN_Receive and can_tx.c and can_tx.h from ../CAN_Trasmit to the project.
+ *
+ * This example is intended to help users move blocks of data larger than one CAN frame on the F28027F microcontroller.
+ */
+
+#include "F2802x_Device.h"
+#include "f2802x_examples.h"
+#include "isotp.h"
+
+#define REQUEST_ID   0x7E0       // Tester to this node
+#define RESPONSE_ID  0x7E8       // This node to the tester
+
+#define CAL_SIZE     512         // Bytes of calibration table
+#define LOG_SIZE     1024        // Bytes of log dump
+#define LOG_REQUEST  0x01        // One-byte request for the log dump
+
+#define CAN_BTC      0x00020165UL // 500 kbps: 30 MHz eCAN clock, 100 ns TQ, 1 + 13 + 6 TQ, sample point 70%
+
+__interrupt void ecan0_isr(void);
+__interrupt void ecan1_isr(void);
+__interrupt void cpu_timer0_isr(void);
+
+const CanRxFilter rxFilters[1] =
+{
+    { REQUEST_ID, 0x7FF, 4 },    // Mailboxes 31-28
+};
+
+IsoTpLink testerLink;
+IsoTpMessage request;
+IsoTpMessage response;
+Uint16 calBuffers[2][CAL_SIZE];  // One byte per word
+const Uint16 *calTable = calBuffers[0]; // Calibration table in use
+Uint16 calLength;                // Bytes in calTable
+Uint16 calReceive = 1;           // calBuffers entry the next request is received into
+Uint16 logDump[LOG_SIZE];
+Uint16 logRequests;
+Uint16 busyRequests;             // Log requests while the previous dump was still being sent
+
+void InitGpio()
+{
+    EALLOW;
+    GpioCtrlRegs.GPAPUD.bit.GPIO30 = 0; // Enable pull-up on GPIO30 (CANRXA)
+    GpioCtrlRegs.GPAPUD.bit.GPIO31 = 0; // Enable pull-up on GPIO31 (CANTXA)
+    GpioCtrlRegs.GPAQSEL2.bit.GPIO30 = 3; // Asynchronous input GPIO30 (CANRXA)
+    GpioCtrlRegs.GPAMUX2.bit.GPIO30 = 1;  // Configure GPIO30 as CANRXA
+    GpioCtrlRegs.GPAMUX2.bit.GPIO31 = 1;  // Configure GPIO31 as CANTXA
+    EDIS;
+}
+
+void InitCan()
+{
+    EALLOW;
+    SysCtrlRegs.PCLKCR0.bit.ECANENCLK = 1; // Enable CAN clock
+    EDIS;
+
+    InitECana(); // Initialize eCAN module
+
+    EALLOW;
+    ECanaRegs.CANME.all = 0; // Disable all mailboxes
+    ECanaRegs.CANMC.bit.CCR = 1; // Enable configuration change
+    while(ECanaRegs.CANES.bit.CCE != 1); // Wait for configuration change enable
+
+    ECanaRegs.CANBTC.all = CAN_BTC; // Set baud rate to 500 kbps
+    ECanaRegs.CANMC.bit.CCR = 0; // Disable configuration change
+    while(ECanaRegs.CANES.bit.CCE != 0); // Wait for configuration change disable
+
+    CanRxInit(rxFilters, 1, 31); // Mailboxes 31-28 receive
+    CanTxInit(0x0FFFFFFF);       // Mailboxes 27-0 transmit
+    EDIS;
+}
+
+void InitTimer()
+{
+    EALLOW;
+    InitCpuTimers();
+    ConfigCpuTimer(&CpuTimer0, 60, ISOTP_TICK_US); // Configure CPU-Timer 0 to interrupt every 100 us
+    PieVectTable.TINT0 = &cpu_timer0_isr;          // Map ISR to the PIE vector table
+    EDIS;
+
+    IER |= M_INT1; // Enable CPU INT1
+    PieCtrlRegs.PIEIER1.bit.INTx7 = 1; // Enable PIE Group 1 interrupt 7 (TINT0)
+
+    CpuTimer0Regs.TCR.all = 0x4000; // Start CPU-Timer 0
+}
+
+// Called from IsoTpFrame or IsoTpPoll when a request ends
+void RequestDone(IsoTpMessage *m)
+{
+    if(m->status == ISOTP_STATUS_DONE)
+    {
+        if(m->length == 1 && m->data[0] == LOG_REQUEST)
+        {
+            logRequests++;
+            if(!IsoTpSend(&testerLink, &response))
+            {
+                busyRequests++;
+            }
+        }
+        else
+        {
+            calTable = calBuffers[calReceive]; // New calibration table, received in place
+            calLength = m->length;
+            calReceive ^= 1;
+        }
+    }
+    m->data = calBuffers[calReceive]; // Never the table in use; a failed transfer leaves calTable as it was
+    IsoTpReceive(&testerLink, m); // Ready for the next request
+}
+
+void main(void)
+{
+    CanFrame frame;
+    Uint16 i;
+
+    InitSysCtrl(); // Initialize the CPU and configure the clock
+    DINT;          // Disable CPU interrupts
+
+    InitGpio();    // Initialize the GPIO
+    InitCan();     // Initialize the CAN
+
+    InitPieCtrl(); // Initialize the PIE control registers
+    InitPieVectTable(); // Initialize the PIE vector table
+
+    EALLOW;
+    PieVectTable.ECAN0INTA = &ecan0_isr; // Map ISRs to the PIE vector table
+    PieVectTable.ECAN1INTA = &ecan1_isr;
+    EDIS;
+
+    IER |= M_INT9; // Enable CPU INT9
+    PieCtrlRegs.PIEIER9.bit.INTx5 = 1; // Enable PIE Group 9 interrupt 5 (ECAN0INTA)
+    PieCtrlRegs.PIEIER9.bit.INTx6 = 1; // Enable PIE Group 9 interrupt 6 (ECAN1INTA)
+
+    InitTimer();   // 100 us ISO-TP tick
+
+    for(i = 0; i < LOG_SIZE; i++)
+    {
+        logDump[i] = i & 0xFF; // Stand-in for logged data
+    }
+    IsoTpInit(&testerLink, RESPONSE_ID, REQUEST_ID, 0, 0); // No further FC after the first, no STmin
+    request.data = calBuffers[calReceive];
+    request.size = CAL_SIZE;
+    request.done = RequestDone;
+    response.data = logDump;
+    response.length = LOG_SIZE;
+    IsoTpReceive(&testerLink, &request);
+
+    EINT;  // Enable Global interrupt INTM
+    ERTM;  // Enable Global realtime interrupt DBGM
+
+    while(1)
+    {
+        while(CanRxPop(&frame))
+        {
+            IsoTpFrame(&testerLink, &frame); // Frames of other identifiers are left to the rest of the application
+        }
+        IsoTpPoll(&testerLink); // Sends due CFs and FCs, checks timeouts
+    }
+}
+
+__interrupt void ecan0_isr(void)
+{
+    CanRxService(); // Empties every full receive mailbox
+
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP9; // Acknowledge interrupt
+}
+
+__interrupt void ecan1_isr(void)
+{
+    CanTxService(); // Releases acknowledged mailboxes and loads queued frames
+
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP9; // Acknowledge interrupt
+}
+
+__interrupt void cpu_timer0_isr(void)
+{
+    IsoTpTick();
+
+    CpuTimer0Regs.TCR.bit.TIF = 1; // Clear Timer interrupt flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP1; // Acknowledge interrupt
+}
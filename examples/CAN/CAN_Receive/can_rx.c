@@ -0,0 +1,164 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Mailbox setup, interrupt handler and frame ring of the eCAN receive engine (see can_rx.h).
+ */
+
+#include "can_rx.h"
+
+#if (CAN_RX_RING_SIZE & (CAN_RX_RING_SIZE - 1)) != 0
+#error "CAN_RX_RING_SIZE must be a power of two"
+#endif
+
+#ifdef __TMS320C2000__
+#define RING_BARRIER()
+#else
+#define RING_BARRIER() __sync_synchronize()
+#endif
+
+CanRx canRx;
+
+/*
+ * Give each filter depth mailboxes, from topMailbox downwards, and enable them on interrupt line 0. The eCAN module
+ * stores a frame in the highest-numbered matching mailbox that is free, so earlier filters win where filters overlap.
+ * Call with EALLOW set, before the mailboxes are used. Returns the mailboxes used, or 0 if they do not fit.
+ */
+Uint32 CanRxInit(const CanRxFilter *filters, Uint16 count, Uint16 topMailbox)
+{
+    volatile struct MBOX *mbox;
+    Uint32 mask = 0;
+    Uint32 protect = 0;
+    Uint32 lam;
+    Uint16 total = 0;
+    Uint16 n = topMailbox + 1;
+    Uint16 i, d;
+
+    for(i = 0; i < count; i++)
+    {
+        total += filters[i].depth;
+    }
+    if(total == 0 || topMailbox >= ECAN_MAILBOXES || total > topMailbox + 1)
+    {
+        return 0;
+    }
+    for(i = 0; i < count; i++)
+    {
+        for(d = 0; d < filters[i].depth; d++)
+        {
+            mask |= 1UL << (n - 1 - d);
+        }
+        n -= filters[i].depth;
+    }
+    ECAN_WRITE(CANME, ECAN_READ(CANME) & ~mask); // MSGID can only be written while the mailbox is disabled
+
+    n = topMailbox + 1;
+    for(i = 0; i < count; i++)
+    {
+        if(filters[i].id & CAN_ID_EXT)
+        {
+            lam = ~filters[i].mask & ECAN_EXT_MASK; // LAM bit set = don't care
+        }
+        else
+        {
+            lam = (~filters[i].mask & 0x7FF) << ECAN_STD_SHIFT;
+        }
+        for(d = 0; d < filters[i].depth; d++)
+        {
+            n--;
+            mbox = ECAN_MBOX(n);
+            mbox->MSGID.all = EcanMsgId(filters[i].id) | ECAN_MSGID_AME;
+            mbox->MSGCTRL.all = 0;
+            ECAN_LAM(n) = lam;
+            if(d + 1 < filters[i].depth)
+            {
+                protect |= 1UL << n; // The lowest mailbox of the group is the only one that may be overwritten
+            }
+        }
+    }
+
+    canRx.head = 0;
+    canRx.tail = 0;
+    canRx.mailboxes = mask;
+
+    ECAN_WRITE(CANMD, ECAN_READ(CANMD) | mask);                  // Receive
+    ECAN_WRITE(CANOPC, (ECAN_READ(CANOPC) & ~mask) | protect);   // Overwrite protection
+    ECAN_WRITE(CANMIL, ECAN_READ(CANMIL) & ~mask);               // Interrupt line 0
+    ECAN_WRITE(CANMIM, ECAN_READ(CANMIM) | mask);                // Mailbox interrupts
+    ECAN_WRITE(CANRMP, mask);                                    // Forget old messages
+    ECAN_WRITE(CANME, ECAN_READ(CANME) | mask);
+    ECAN_WRITE(CANGIM, ECAN_READ(CANGIM) | ECAN_GIM_I0EN);
+    return mask;
+}
+
+// Copy mailbox n into the ring; the mailbox stays full until the caller clears its CANRMP bit
+static void CanRxCopy(Uint16 n)
+{
+    volatile struct MBOX *mbox = ECAN_MBOX(n);
+    CanFrame *frame;
+    Uint16 head = canRx.head;
+
+    if((Uint16)(head - canRx.tail) >= CAN_RX_RING_SIZE)
+    {
+        canRx.dropped++;
+        return;
+    }
+    frame = &canRx.ring[head & (CAN_RX_RING_SIZE - 1)];
+    frame->id = EcanFrameId(mbox->MSGID.all); // The received identifier, not the filter's
+    frame->dlc = mbox->MSGCTRL.all & ECAN_MSGCTRL_DLC;
+    EcanGetData(mbox, frame);
+    frame->timestamp = ECAN_MOTS(n);
+    RING_BARRIER(); // Frame is complete before the new head
+    canRx.head = head + 1;
+    canRx.received++;
+}
+
+/*
+ * Call from the ECAN0INT interrupt. Empties every full receive mailbox, highest first, which is the order a group
+ * was filled in, and looks again for frames that arrived meanwhile before returning.
+ */
+void CanRxService(void)
+{
+    Uint32 pending;
+    Uint32 bit;
+    Uint16 n;
+
+    canRx.interrupts++;
+    while((pending = ECAN_READ(CANRMP) & canRx.mailboxes) != 0)
+    {
+        for(n = ECAN_MAILBOXES - 1; pending != 0; n--)
+        {
+            bit = 1UL << n;
+            if(!(pending & bit))
+            {
+                continue;
+            }
+            pending &= ~bit;
+            CanRxCopy(n);
+            if(ECAN_READ(CANRML) & bit)
+            {
+                canRx.overwritten++; // Read after the copy, so an overwrite during the copy is counted too
+            }
+            ECAN_WRITE(CANRMP, bit); // Mailbox free again; also clears its CANRML bit
+        }
+    }
+}
+
+// Main loop: take the oldest received frame; returns 0 if there is none
+Uint16 CanRxPop(CanFrame *frame)
+{
+    Uint16 tail = canRx.tail;
+
+    if(tail == canRx.head)
+    {
+        return 0;
+    }
+    RING_BARRIER(); // Read the frame only after seeing the new head
+    *frame = canRx.ring[tail & (CAN_RX_RING_SIZE - 1)];
+    RING_BARRIER(); // Frame is copied before its slot is released
+    canRx.tail = tail + 1;
+    return 1;
+}
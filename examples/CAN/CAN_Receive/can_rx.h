@@ -0,0 +1,50 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Interrupt-driven eCAN receive engine for the CAN_Receive example. Each acceptance filter gets a group of receive
+ * mailboxes with its identifier and local acceptance mask (LAM), so the eCAN module discards all other frames itself.
+ * Within a group every mailbox but the lowest has overwrite protection (CANOPC): a frame arriving while a mailbox
+ * is still full moves on to the next one, making the group a small hardware FIFO. Only the lowest mailbox can be
+ * overwritten, which the module reports in CANRML.
+ *
+ * CanRxService runs from ECAN0INT, copies every full mailbox (CANRMP) into a ring of CanFrame, and counts overwritten
+ * and dropped frames. The main loop takes frames with CanRxPop.
+ */
+
+#ifndef CAN_RX_H
+#define CAN_RX_H
+
+#include "ecan.h"
+
+#define CAN_RX_RING_SIZE    16   // Received frames waiting for the main loop (power of two)
+
+typedef struct
+{
+    Uint32 id;       // Identifier to accept, CAN_ID_EXT for extended frames
+    Uint32 mask;     // Identifier bits that must match, e.g. 0x7FF for exactly id (standard)
+    Uint16 depth;    // Mailboxes for this filter, frames it can hold before the ISR runs
+} CanRxFilter;
+
+typedef struct
+{
+    CanFrame ring[CAN_RX_RING_SIZE];
+    volatile Uint16 head;         // Next free slot (ISR)
+    volatile Uint16 tail;         // Next frame to read (main loop)
+    Uint32 mailboxes;             // Receive mailboxes, bit n = mailbox n
+    volatile Uint32 received;     // Frames copied into the ring
+    volatile Uint32 overwritten;  // Mailboxes found overwritten (CANRML); repeated overwrites before the ISR count once
+    volatile Uint32 dropped;      // Frames lost because the ring was full
+    volatile Uint32 interrupts;   // CanRxService calls
+} CanRx;
+
+extern CanRx canRx;
+
+Uint32 CanRxInit(const CanRxFilter *filters, Uint16 count, Uint16 topMailbox);
+void CanRxService(void);
+Uint16 CanRxPop(CanFrame *frame);
+
+#endif // CAN_RX_H
@@ -0,0 +1,143 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * eCAN register access and the CAN frame type shared by the CAN examples. The engines read and write eCAN-A only
+ * through the ECAN_* macros below. On the C28x they are the 32-bit register accesses the eCAN module requires; on a
+ * host they go to the register model in host/ecan_model.c, which behaves like the module (write-1-to-clear flags,
+ * acceptance filtering, overwrite protection, transmit priority and aborts), so the same engine code runs in both places.
+ */
+
+#ifndef ECAN_H
+#define ECAN_H
+
+#ifdef __TMS320C2000__
+#include "F2802x_Device.h"
+
+#define ECAN_READ(reg)          (ECanaRegs.reg.all)
+#define ECAN_WRITE(reg, value)  (ECanaRegs.reg.all = (value))
+#define ECAN_MBOX(n)            (&ECanaMboxes.MBOX0 + (n))      // volatile struct MBOX *
+#define ECAN_LAM(n)             ((&ECanaLAMRegs.LAM0)[n].all)   // Local acceptance mask
+#define ECAN_MOTS(n)            ((&ECanaMOTSRegs.MOTS0)[n].all) // Receive time stamp
+#else
+#include <stdint.h>
+typedef uint16_t Uint16;
+typedef uint32_t Uint32;
+typedef int32_t int32;
+
+typedef struct
+{
+    Uint32 all;
+} EcanReg;
+
+struct MBOX
+{
+    EcanReg MSGID;
+    EcanReg MSGCTRL;
+    EcanReg MDL;
+    EcanReg MDH;
+};
+
+// Registers of the model, in eCAN register order
+enum
+{
+    ECAN_CANME, ECAN_CANMD, ECAN_CANTRS, ECAN_CANTRR, ECAN_CANTA, ECAN_CANAA, ECAN_CANRMP, ECAN_CANRML,
+    ECAN_CANRFP, ECAN_CANGAM, ECAN_CANMC, ECAN_CANBTC, ECAN_CANES, ECAN_CANTEC, ECAN_CANREC, ECAN_CANGIF0,
+    ECAN_CANGIM, ECAN_CANGIF1, ECAN_CANMIM, ECAN_CANMIL, ECAN_CANOPC, ECAN_CANTIOC, ECAN_CANRIOC, ECAN_CANTSC,
+    ECAN_REGISTERS
+};
+
+Uint32 EcanModelRead(Uint16 reg);
+void EcanModelWrite(Uint16 reg, Uint32 value);
+struct MBOX *EcanModelMbox(Uint16 n);
+Uint32 *EcanModelLam(Uint16 n);
+Uint32 *EcanModelMots(Uint16 n);
+
+#define ECAN_READ(reg)          EcanModelRead(ECAN_##reg)
+#define ECAN_WRITE(reg, value)  EcanModelWrite(ECAN_##reg, (value))
+#define ECAN_MBOX(n)            EcanModelMbox(n)
+#define ECAN_LAM(n)             (*EcanModelLam(n))
+#define ECAN_MOTS(n)            (*EcanModelMots(n))
+#endif
+
+#define ECAN_MAILBOXES      32
+
+// MSGID fields
+#define ECAN_MSGID_IDE      0x80000000UL  // Extended identifier
+#define ECAN_MSGID_AME      0x40000000UL  // Use the local acceptance mask (receive mailboxes)
+#define ECAN_MSGID_AAM      0x20000000UL  // Auto answer mode (transmit mailboxes)
+#define ECAN_STD_SHIFT      18            // Standard identifier in MSGID bits 28:18
+#define ECAN_EXT_MASK       0x1FFFFFFFUL
+#define ECAN_LAM_LAMI       0x80000000UL  // Accept standard and extended frames alike
+
+// MSGCTRL fields
+#define ECAN_MSGCTRL_DLC    0x000F
+#define ECAN_MSGCTRL_RTR    0x0010
+#define ECAN_MSGCTRL_TPL_SHIFT  8         // Transmit priority level, MSGCTRL bits 12:8
+#define ECAN_TPL_MAX        31
+
+// CANGIM bits
+#define ECAN_GIM_I0EN       0x00000001UL  // Interrupt line 0 (ECAN0INT)
+#define ECAN_GIM_I1EN       0x00000002UL  // Interrupt line 1 (ECAN1INT)
+#define ECAN_GIM_GIL        0x00000004UL  // Global interrupts (e.g. abort acknowledge) on line 1
+#define ECAN_GIM_AAIM       0x00004000UL  // Abort acknowledge interrupt
+
+// Frame identifier: 11-bit standard, or 29-bit extended with CAN_ID_EXT set
+#define CAN_ID_EXT          0x80000000UL
+
+typedef struct
+{
+    Uint32 id;           // Identifier, CAN_ID_EXT for an extended frame
+    Uint16 dlc;          // Data length code, 0-8
+    Uint16 data[8];      // One byte per word, data[0] first on the bus
+    Uint32 timestamp;    // CANTSC when the frame was stored (receive), 0 otherwise
+} CanFrame;
+
+// MSGID of a mailbox for a frame identifier
+static inline Uint32 EcanMsgId(Uint32 id)
+{
+    if(id & CAN_ID_EXT)
+    {
+        return ECAN_MSGID_IDE | (id & ECAN_EXT_MASK);
+    }
+    return (id & 0x7FF) << ECAN_STD_SHIFT;
+}
+
+// Frame identifier of a mailbox MSGID
+static inline Uint32 EcanFrameId(Uint32 msgId)
+{
+    if(msgId & ECAN_MSGID_IDE)
+    {
+        return CAN_ID_EXT | (msgId & ECAN_EXT_MASK);
+    }
+    return (msgId >> ECAN_STD_SHIFT) & 0x7FF;
+}
+
+// Copy the data field of a mailbox; CANMC.DBO = 0, so byte 0 is the most significant byte of MDL
+static inline void EcanGetData(volatile struct MBOX *mbox, CanFrame *frame)
+{
+    Uint32 mdl = mbox->MDL.all;
+    Uint32 mdh = mbox->MDH.all;
+
+    frame->data[0] = (mdl >> 24) & 0xFF;
+    frame->data[1] = (mdl >> 16) & 0xFF;
+    frame->data[2] = (mdl >> 8) & 0xFF;
+    frame->data[3] = mdl & 0xFF;
+    frame->data[4] = (mdh >> 24) & 0xFF;
+    frame->data[5] = (mdh >> 16) & 0xFF;
+    frame->data[6] = (mdh >> 8) & 0xFF;
+    frame->data[7] = mdh & 0xFF;
+}
+
+static inline void EcanSetData(volatile struct MBOX *mbox, const CanFrame *frame)
+{
+    mbox->MDL.all = ((Uint32)(frame->data[0] & 0xFF) << 24) | ((Uint32)(frame->data[1] & 0xFF) << 16)
+                  | ((frame->data[2] & 0xFF) << 8) | (frame->data[3] & 0xFF);
+    mbox->MDH.all = ((Uint32)(frame->data[4] & 0xFF) << 24) | ((Uint32)(frame->data[5] & 0xFF) << 16)
+                  | ((frame->data[6] & 0xFF) << 8) | (frame->data[7] & 0xFF);
+}
+
+#endif // ECAN_H
@@ -0,0 +1,193 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Runs the eCAN receive engine (can_rx.c) on a Linux host against the eCAN register model (ecan_model.c). Frames
+ * are put on the simulated bus one at a time; CanRxService runs whenever the model requests ECAN0INT, as the ISR
+ * in main.c would, except where a scenario holds the interrupt off to let mailboxes fill.
+ *
+ * The scenarios check acceptance filtering, mailbox groups filling in order, overwrite and ring-full counts, and a
+ * long random run in which every frame sent is either received in order or counted as lost. The exit status is 1
+ * if any check fails.
+ *
+ * Build: gcc -O2 -I.. -o can_rx_sim can_rx_sim.c ecan_model.c ../can_rx.c
+ */
+
+#include "can_rx.h"
+#include "ecan_model.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define FRAME_BITS  111   // 8-byte standard frame with stuffing at 500 kbps: about 222 us
+
+static const CanRxFilter filters[3] =
+{
+    { 0x100, 0x7FF, 3 },                                     // Exactly 0x100, three mailboxes
+    { 0x200, 0x7F0, 2 },                                     // 0x200-0x20F
+    { CAN_ID_EXT | 0x18FF0000UL, 0x1FFFFF00UL, 1 },          // Extended 0x18FF00xx
+};
+
+static int failures;
+
+static void Check(const char *name, int ok)
+{
+    printf("  %-52s %s\n", name, ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        failures++;
+    }
+}
+
+static void Setup(void)
+{
+    EcanModelReset();
+    memset(&canRx, 0, sizeof(canRx));
+    CanRxInit(filters, 3, 31);
+}
+
+static void MakeFrame(CanFrame *f, Uint32 id, Uint16 seq)
+{
+    Uint16 i;
+
+    f->id = id;
+    f->dlc = 8;
+    for(i = 0; i < 8; i++)
+    {
+        f->data[i] = (seq + i * 17) & 0xFF;
+    }
+    f->data[0] = seq & 0xFF;
+    f->data[1] = (seq >> 8) & 0xFF;
+    f->timestamp = 0;
+}
+
+// A frame on the bus; the ISR runs at once unless held
+static void Send(Uint32 id, Uint16 seq, Uint16 holdIsr)
+{
+    CanFrame f;
+
+    MakeFrame(&f, id, seq);
+    EcanModelAdvance(FRAME_BITS);
+    EcanModelReceive(&f);
+    if(!holdIsr && EcanModelInterrupt(0))
+    {
+        CanRxService();
+    }
+}
+
+static Uint16 Seq(const CanFrame *f)
+{
+    return f->data[0] | (f->data[1] << 8);
+}
+
+int main(void)
+{
+    CanFrame f;
+    Uint32 mask;
+    Uint16 ok, i, n, got;
+    Uint16 expect[3];
+    Uint32 sent[3], lost;
+    Uint32 ids[3] = { 0x100, 0x20A, CAN_ID_EXT | 0x18FF0042UL };
+
+    Setup();
+    mask = canRx.mailboxes;
+    Check("mailbox groups from 31 down, lowest unprotected", mask == 0xFC000000UL
+          && ecanModel.regs[ECAN_CANOPC] == 0xD0000000UL && ecanModel.regs[ECAN_CANMIL] == 0);
+
+    // Acceptance filtering
+    Send(0x100, 1, 0);
+    Send(0x101, 2, 0);
+    Send(0x20F, 3, 0);
+    Send(0x210, 4, 0);
+    Send(CAN_ID_EXT | 0x18FF00AAUL, 5, 0);
+    Send(CAN_ID_EXT | 0x18FE00AAUL, 6, 0);
+    Send(CAN_ID_EXT | 0x100, 7, 0); // Extended frame with a standard filter's identifier
+    ok = 1;
+    ok &= CanRxPop(&f) && f.id == 0x100 && Seq(&f) == 1 && f.dlc == 8 && f.data[7] == ((1 + 7 * 17) & 0xFF);
+    ok &= CanRxPop(&f) && f.id == 0x20F && Seq(&f) == 3;
+    ok &= CanRxPop(&f) && f.id == (CAN_ID_EXT | 0x18FF00AAUL) && Seq(&f) == 5 && f.timestamp == 5 * FRAME_BITS;
+    ok &= !CanRxPop(&f);
+    Check("only matching identifiers are received", ok && ecanModel.unmatched == 4);
+
+    // Three frames before the ISR runs: the group holds them in order, one interrupt drains all
+    Setup();
+    Send(0x100, 10, 1);
+    Send(0x100, 11, 1);
+    Send(0x205, 12, 1);
+    Send(0x100, 13, 1);
+    CanRxService();
+    for(ok = 1, i = 0; i < 3; i++)
+    {
+        ok &= CanRxPop(&f) && f.id == 0x100 && Seq(&f) == 10 + (i == 2 ? 3 : i);
+    }
+    ok &= CanRxPop(&f) && f.id == 0x205 && Seq(&f) == 12;
+    Check("one interrupt drains every full mailbox in order", ok && canRx.interrupts == 1 && canRx.overwritten == 0);
+
+    // A fourth frame for a full group overwrites its lowest mailbox
+    Setup();
+    for(i = 0; i < 4; i++)
+    {
+        Send(0x100, 20 + i, 1);
+    }
+    CanRxService();
+    Check("overflowing a group counts one overwrite", canRx.overwritten == 1 && canRx.received == 3
+          && CanRxPop(&f) && Seq(&f) == 20);
+
+    // Ring full: frames are dropped and counted, not overwritten in the ring
+    Setup();
+    for(i = 0; i < CAN_RX_RING_SIZE + 5; i++)
+    {
+        Send(0x100, i, 0);
+    }
+    for(ok = 1, i = 0; i < CAN_RX_RING_SIZE; i++)
+    {
+        ok &= CanRxPop(&f) && Seq(&f) == i;
+    }
+    Check("full ring drops and counts the newest frames", ok && canRx.dropped == 5 && !CanRxPop(&f));
+
+    // Random traffic, interrupt latency and main loop: every frame arrives in order or is counted
+    Setup();
+    srand(11);
+    memset(expect, 0, sizeof(expect));
+    memset(sent, 0, sizeof(sent));
+    ok = 1;
+    for(n = 0; n < 60000; n++)
+    {
+        i = rand() % 3;
+        Send(ids[i], sent[i]++ & 0xFFFF, rand() % 4 == 0); // Sometimes the ISR is late
+        if(rand() % 3 == 0)
+        {
+            while(CanRxPop(&f))
+            {
+                i = (f.id == 0x100) ? 0 : (f.id == 0x20A) ? 1 : 2;
+                got = Seq(&f);
+                if((Uint16)(got - expect[i]) >= 0x8000)
+                {
+                    ok = 0; // Older than a frame already received
+                }
+                expect[i] = got + 1;
+            }
+        }
+    }
+    if(EcanModelInterrupt(0))
+    {
+        CanRxService();
+    }
+    while(CanRxPop(&f))
+    {
+    }
+    lost = ecanModel.overwrites + canRx.dropped + ecanModel.discarded;
+    Check("random run: in order, received + lost = sent", ok && canRx.received + lost == sent[0] + sent[1] + sent[2]);
+    Check("overwrites detected through CANRML", canRx.overwritten != 0 && canRx.overwritten <= ecanModel.overwrites);
+    printf("  %lu frames: %lu received, %lu overwritten (%lu counted), %lu dropped, %lu interrupts\n",
+           (unsigned long)(sent[0] + sent[1] + sent[2]), (unsigned long)canRx.received,
+           (unsigned long)ecanModel.overwrites, (unsigned long)canRx.overwritten, (unsigned long)canRx.dropped, (unsigned long)canRx.interrupts);
+    Check("losses only while the ISR or main loop was late", lost < (sent[0] + sent[1] + sent[2]) / 10);
+
+    printf("%s\n", failures ? "FAILED" : "All checks passed");
+    return failures != 0;
+}
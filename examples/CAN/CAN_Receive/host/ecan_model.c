@@ -0,0 +1,222 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Host model of the eCAN-A registers and mailboxes (see ecan_model.h).
+ */
+
+#include "ecan_model.h"
+
+#include <string.h>
+
+EcanModel ecanModel;
+
+static void EcanModelAbort(void);
+
+void EcanModelReset(void)
+{
+    memset(&ecanModel, 0, sizeof(ecanModel));
+    ecanModel.transmitting = ECAN_MODEL_NONE;
+}
+
+Uint32 EcanModelRead(Uint16 reg)
+{
+    return ecanModel.regs[reg];
+}
+
+void EcanModelWrite(Uint16 reg, Uint32 value)
+{
+    switch(reg)
+    {
+    case ECAN_CANRMP:
+        ecanModel.regs[ECAN_CANRMP] &= ~value;
+        ecanModel.regs[ECAN_CANRML] &= ~value; // Clearing RMP also clears RML
+        break;
+    case ECAN_CANTA:
+    case ECAN_CANAA:
+    case ECAN_CANGIF0:
+    case ECAN_CANGIF1:
+        ecanModel.regs[reg] &= ~value;         // Write 1 to clear
+        break;
+    case ECAN_CANTRS:
+        ecanModel.regs[reg] |= value;          // Write 1 to set, cleared by the module
+        break;
+    case ECAN_CANTRR:
+        ecanModel.regs[ECAN_CANTRR] |= value;
+        EcanModelAbort();
+        break;
+    case ECAN_CANRML:
+        break;                                 // Read only
+    default:
+        ecanModel.regs[reg] = value;
+        break;
+    }
+}
+
+// Carry out transmission requests resets: waiting mailboxes are aborted, the one on the bus finishes first
+static void EcanModelAbort(void)
+{
+    Uint32 abort = ecanModel.regs[ECAN_CANTRR];
+
+    if(ecanModel.transmitting != ECAN_MODEL_NONE)
+    {
+        abort &= ~(1UL << ecanModel.transmitting);
+    }
+    ecanModel.regs[ECAN_CANAA] |= abort & ecanModel.regs[ECAN_CANTRS];
+    ecanModel.regs[ECAN_CANTRS] &= ~abort;
+    ecanModel.regs[ECAN_CANTRR] &= ~abort;
+}
+
+struct MBOX *EcanModelMbox(Uint16 n)
+{
+    return &ecanModel.mbox[n];
+}
+
+Uint32 *EcanModelLam(Uint16 n)
+{
+    return &ecanModel.lam[n];
+}
+
+Uint32 *EcanModelMots(Uint16 n)
+{
+    return &ecanModel.mots[n];
+}
+
+static Uint16 EcanModelAccepts(Uint16 n, Uint32 msgId)
+{
+    Uint32 own = ecanModel.mbox[n].MSGID.all;
+    Uint32 lam = 0;
+
+    if(own & ECAN_MSGID_AME)
+    {
+        lam = ecanModel.lam[n];
+    }
+    if(!(lam & ECAN_LAM_LAMI) && ((own ^ msgId) & ECAN_MSGID_IDE))
+    {
+        return 0;
+    }
+    return ((own ^ msgId) & ~lam & ECAN_EXT_MASK) == 0;
+}
+
+// A frame from the bus; returns the mailbox it was stored in, or ECAN_MODEL_NONE
+Uint16 EcanModelReceive(const CanFrame *frame)
+{
+    struct MBOX *mbox;
+    Uint32 msgId = EcanMsgId(frame->id);
+    Uint32 receive = ecanModel.regs[ECAN_CANME] & ecanModel.regs[ECAN_CANMD];
+    Uint32 bit;
+    Uint16 matched = 0;
+    Uint16 n;
+
+    for(n = ECAN_MAILBOXES; n-- > 0; )
+    {
+        bit = 1UL << n;
+        if(!(receive & bit) || !EcanModelAccepts(n, msgId))
+        {
+            continue;
+        }
+        matched = 1;
+        if((ecanModel.regs[ECAN_CANRMP] & bit) && (ecanModel.regs[ECAN_CANOPC] & bit))
+        {
+            continue; // Full and protected: try the next matching mailbox
+        }
+        mbox = &ecanModel.mbox[n];
+        mbox->MSGID.all = (mbox->MSGID.all & (ECAN_MSGID_AME | ECAN_MSGID_AAM)) | msgId;
+        mbox->MSGCTRL.all = frame->dlc & ECAN_MSGCTRL_DLC;
+        EcanSetData(mbox, frame);
+        ecanModel.mots[n] = ecanModel.regs[ECAN_CANTSC];
+        if(ecanModel.regs[ECAN_CANRMP] & bit)
+        {
+            ecanModel.regs[ECAN_CANRML] |= bit; // Previous message overwritten
+            ecanModel.overwrites++;
+        }
+        ecanModel.regs[ECAN_CANRMP] |= bit;
+        return n;
+    }
+    if(matched)
+    {
+        ecanModel.discarded++;
+    }
+    else
+    {
+        ecanModel.unmatched++;
+    }
+    return ECAN_MODEL_NONE;
+}
+
+/*
+ * The bus is free: the module starts the requested transmit mailbox with the highest TPL, the highest-numbered one
+ * among equals. Returns the mailbox, or ECAN_MODEL_NONE if nothing is requested.
+ */
+Uint16 EcanModelTransmitStart(void)
+{
+    Uint32 request = ecanModel.regs[ECAN_CANTRS] & ecanModel.regs[ECAN_CANME] & ~ecanModel.regs[ECAN_CANMD];
+    Uint16 best = ECAN_MODEL_NONE;
+    Uint16 bestTpl = 0;
+    Uint16 tpl;
+    Uint16 n;
+
+    for(n = ECAN_MAILBOXES; n-- > 0; )
+    {
+        if(!(request & (1UL << n)))
+        {
+            continue;
+        }
+        tpl = (ecanModel.mbox[n].MSGCTRL.all >> ECAN_MSGCTRL_TPL_SHIFT) & ECAN_TPL_MAX;
+        if(best == ECAN_MODEL_NONE || tpl > bestTpl)
+        {
+            best = n;
+            bestTpl = tpl;
+        }
+    }
+    ecanModel.transmitting = best;
+    return best;
+}
+
+// The frame started by EcanModelTransmitStart was acknowledged; returns its mailbox, or ECAN_MODEL_NONE
+Uint16 EcanModelTransmitEnd(CanFrame *frame)
+{
+    struct MBOX *mbox;
+    Uint16 n = ecanModel.transmitting;
+    Uint32 bit;
+
+    if(n == ECAN_MODEL_NONE)
+    {
+        return n;
+    }
+    bit = 1UL << n;
+    mbox = &ecanModel.mbox[n];
+    frame->id = EcanFrameId(mbox->MSGID.all);
+    frame->dlc = mbox->MSGCTRL.all & ECAN_MSGCTRL_DLC;
+    EcanGetData(mbox, frame);
+    frame->timestamp = ecanModel.regs[ECAN_CANTSC];
+    ecanModel.transmitting = ECAN_MODEL_NONE;
+    ecanModel.regs[ECAN_CANTRS] &= ~bit;
+    ecanModel.regs[ECAN_CANTRR] &= ~bit; // An abort requested too late has no effect
+    ecanModel.regs[ECAN_CANTA] |= bit;
+    EcanModelAbort();
+    return n;
+}
+
+// 1 while interrupt line 0 (ECAN0INT) or 1 (ECAN1INT) is requested
+Uint16 EcanModelInterrupt(Uint16 line)
+{
+    Uint32 gim = ecanModel.regs[ECAN_CANGIM];
+    Uint32 flags = (ecanModel.regs[ECAN_CANRMP] | ecanModel.regs[ECAN_CANTA]) & ecanModel.regs[ECAN_CANMIM];
+    Uint16 global = (gim & ECAN_GIM_AAIM) && ecanModel.regs[ECAN_CANAA] != 0; // Abort acknowledge, on line GIL
+
+    if(line == 0)
+    {
+        return (gim & ECAN_GIM_I0EN) && ((flags & ~ecanModel.regs[ECAN_CANMIL]) != 0 || (global && !(gim & ECAN_GIM_GIL)));
+    }
+    return (gim & ECAN_GIM_I1EN) && ((flags & ecanModel.regs[ECAN_CANMIL]) != 0 || (global && (gim & ECAN_GIM_GIL)));
+}
+
+// Bus time passes; the time stamp counter counts bit times
+void EcanModelAdvance(Uint32 bits)
+{
+    ecanModel.regs[ECAN_CANTSC] += bits;
+}
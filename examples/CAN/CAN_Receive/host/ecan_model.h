@@ -0,0 +1,45 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Host model of the eCAN-A registers and mailboxes, used in place of the hardware by the ECAN_* macros in ecan.h.
+ * Flags are write-1-to-clear as on the device, and EcanModelReceive stores a frame from the bus the way the module
+ * does: acceptance by MSGID and the local acceptance mask, highest matching mailbox first, overwrite protection
+ * (CANOPC) and lost-message flags (CANRML). On the transmit side, EcanModelTransmitStart picks the mailbox the module
+ * would send next (highest TPL, then highest mailbox number) and EcanModelTransmitEnd completes it with CANTA. A
+ * transmission request reset (CANTRR) aborts a waiting mailbox at once with CANAA; a mailbox already on the bus
+ * finishes with CANTA instead.
+ */
+
+#ifndef ECAN_MODEL_H
+#define ECAN_MODEL_H
+
+#include "ecan.h"
+
+#define ECAN_MODEL_NONE  0xFFFF
+
+typedef struct
+{
+    Uint32 regs[ECAN_REGISTERS];
+    struct MBOX mbox[ECAN_MAILBOXES];
+    Uint32 lam[ECAN_MAILBOXES];
+    Uint32 mots[ECAN_MAILBOXES];
+    Uint32 unmatched;    // Frames no enabled receive mailbox accepted
+    Uint32 discarded;    // Frames whose matching mailboxes were all full and protected
+    Uint32 overwrites;   // Unread frames overwritten (CANRML shows only the first per mailbox)
+    Uint16 transmitting; // Mailbox on the bus, or ECAN_MODEL_NONE
+} EcanModel;
+
+extern EcanModel ecanModel;
+
+void EcanModelReset(void);
+Uint16 EcanModelReceive(const CanFrame *frame);
+Uint16 EcanModelTransmitStart(void);
+Uint16 EcanModelTransmitEnd(CanFrame *frame);
+Uint16 EcanModelInterrupt(Uint16 line);
+void EcanModelAdvance(Uint32 bits);
+
+#endif // ECAN_MODEL_H
@@ -2,19 +2,43 @@
  * Author: Kiran Jojare
  * Email: kijo7257@colorado.edu
  * Date: June 19, 2024
- * Version: 1.0
+ * Version: 1.2
  *
  * Description:
  * This code demonstrates how to use the CAN (Controller Area Network) module to receive messages on the Texas Instruments C2000 Piccolo LaunchPad Evaluation Kit (LAUNCHHXL-F28027F).
  * The CAN module is configured to communicate at a baud rate of 500 kbps.
  *
  * The code initializes the system control and GPIO settings, configures the CAN module, and receives CAN messages.
+ * Only the identifiers in rxFilters are accepted, by mailbox acceptance masks in the eCAN module. Received frames
+ * are copied by the ECAN0INT interrupt (can_rx.c) into a ring, with their length and time stamp, and the main loop
+ * takes them from there without waiting. Add can_rx.c, can_rx.h and ecan.h from this folder to the project.
  *
  * This example is intended to help users get started with basic CAN receive operations on the F28027F microcontroller.
  */
 
 #include "F2802x_Device.h"
 #include "f2802x_examples.h"
+#include "can_rx.h"
+
+#define COMMAND_ID   0x100       // Commands for this node
+#define SENSOR_ID    0x200       // Sensor broadcasts 0x200-0x20F
+
+#define CAN_BTC      0x00020165UL // 500 kbps: 30 MHz eCAN clock, 100 ns TQ, 1 + 13 + 6 TQ, sample point 70%
+
+__interrupt void ecan0_isr(void);
+
+// Highest mailboxes first: a frame goes to the highest-numbered matching mailbox that is free
+const CanRxFilter rxFilters[3] =
+{
+    { COMMAND_ID, 0x7FF, 4 },                          // Exactly COMMAND_ID
+    { SENSOR_ID, 0x7F0, 4 },                           // Any of the 16 sensor identifiers
+    { CAN_ID_EXT | 0x18FF0000UL, 0x1FFFFF00UL, 2 },    // Extended 0x18FF00xx, e.g. J1939 proprietary
+};
+
+CanFrame lastFrame;
+volatile Uint32 commandCount;
+volatile Uint32 sensorCount;
+volatile Uint32 extendedCount;
 
 void InitGpio()
 {
@@ -37,39 +61,61 @@ void InitCan()
 
     EALLOW;
     ECanaRegs.CANME.all = 0; // Disable all mailboxes
-    ECanaRegs.CANMD.all = 0x00000000; // Set all mailboxes to receive
     ECanaRegs.CANMC.bit.CCR = 1; // Enable configuration change
     while(ECanaRegs.CANES.bit.CCE != 1); // Wait for configuration change enable
 
-    ECanaRegs.CANBTC.all = 0x00023F00; // Set baud rate to 500 kbps
+    ECanaRegs.CANBTC.all = CAN_BTC; // Set baud rate to 500 kbps
     ECanaRegs.CANMC.bit.CCR = 0; // Disable configuration change
     while(ECanaRegs.CANES.bit.CCE != 0); // Wait for configuration change disable
 
-    ECanaRegs.CANME.all = 0xFFFFFFFF; // Enable all mailboxes
+    CanRxInit(rxFilters, 3, 31); // Mailboxes 31-22 receive, the others stay disabled
     EDIS;
 }
 
-Uint32 CanReceive(Uint16 mailbox)
-{
-    while((ECanaRegs.CANRMP.all & (1 << mailbox)) == 0); // Wait for message
-    Uint32 data = ECanaMboxes.MBOX0.MDL.all; // Read data
-    ECanaRegs.CANRMP.all = (1 << mailbox); // Clear RMP bit
-    return data;
-}
-
 void main(void)
 {
-    Uint32 receivedData;
-
     InitSysCtrl(); // Initialize the CPU and configure the clock
     DINT;          // Disable CPU interrupts
 
     InitGpio();    // Initialize the GPIO
     InitCan();     // Initialize the CAN
 
+    InitPieCtrl(); // Initialize the PIE control registers
+    InitPieVectTable(); // Initialize the PIE vector table
+
+    EALLOW;
+    PieVectTable.ECAN0INTA = &ecan0_isr; // Map ISR to the PIE vector table
+    EDIS;
+
+    IER |= M_INT9; // Enable CPU INT9
+    PieCtrlRegs.PIEIER9.bit.INTx5 = 1; // Enable PIE Group 9 interrupt 5 (ECAN0INTA)
+
+    EINT;  // Enable Global interrupt INTM
+    ERTM;  // Enable Global realtime interrupt DBGM
+
     while(1)
     {
-        receivedData = CanReceive(0); // Receive CAN message
-        // Process received data (e.g., toggle an LED, store in memory, etc.)
+        while(CanRxPop(&lastFrame)) // Process received data (e.g., toggle an LED, store in memory, etc.)
+        {
+            if(lastFrame.id & CAN_ID_EXT)
+            {
+                extendedCount++;
+            }
+            else if(lastFrame.id == COMMAND_ID)
+            {
+                commandCount++;
+            }
+            else
+            {
+                sensorCount++;
+            }
+        }
     }
 }
+
+__interrupt void ecan0_isr(void)
+{
+    CanRxService(); // Empties every full receive mailbox
+
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP9; // Acknowledge interrupt
+}
@@ -0,0 +1,318 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Mailbox loading, priority ranking and interrupt handler of the eCAN transmit queue (see can_tx.h).
+ */
+
+#include "can_tx.h"
+
+#if CAN_TX_QUEUE_SIZE > 32
+#error "CAN_TX_QUEUE_SIZE must fit the 32-bit slot mask"
+#endif
+
+#ifndef __TMS320C2000__
+#define __disable_interrupts()       0
+#define __restore_interrupts(state)  ((void)(state))
+#endif
+
+#define CAN_TPL_MASK  (0x1FUL << ECAN_MSGCTRL_TPL_SHIFT)
+
+CanTx canTx;
+
+/*
+ * Bus arbitration order as a number, lower wins: the 11-bit base identifier first, then a standard frame before an
+ * extended one with the same base, then the 18-bit identifier extension.
+ */
+static Uint32 CanTxKey(Uint32 id)
+{
+    if(id & CAN_ID_EXT)
+    {
+        return (((id >> 18) & 0x7FF) << 19) | (1UL << 18) | (id & 0x3FFFF);
+    }
+    return (id & 0x7FF) << 19;
+}
+
+// 1 if frame a goes before frame b: higher priority, or the same identifier submitted earlier
+static Uint16 CanTxBefore(Uint32 keyA, Uint32 seqA, Uint32 keyB, Uint32 seqB)
+{
+    return keyA < keyB || (keyA == keyB && (Uint32)(seqA - seqB) >= 0x80000000UL);
+}
+
+/*
+ * Use mailboxes as transmit mailboxes on interrupt line 1 (ECAN1INT), together with the abort acknowledge interrupt.
+ * Call with EALLOW set. Returns the mailboxes used.
+ */
+Uint32 CanTxInit(Uint32 mailboxes)
+{
+    canTx.mailboxes = mailboxes;
+    canTx.loaded = 0;
+    canTx.loadedCount = 0;
+    canTx.preempted = 0;
+    canTx.cancelled = 0;
+    canTx.queued = 0;
+    canTx.queueSlots = 0;
+
+    ECAN_WRITE(CANME, ECAN_READ(CANME) & ~mailboxes);  // Enabled when loaded
+    ECAN_WRITE(CANMD, ECAN_READ(CANMD) & ~mailboxes);  // Transmit
+    ECAN_WRITE(CANTA, mailboxes);
+    ECAN_WRITE(CANAA, mailboxes);
+    ECAN_WRITE(CANMIL, ECAN_READ(CANMIL) | mailboxes); // Interrupt line 1
+    ECAN_WRITE(CANMIM, ECAN_READ(CANMIM) | mailboxes); // Transmit acknowledge interrupts
+    ECAN_WRITE(CANGIM, ECAN_READ(CANGIM) | ECAN_GIM_I1EN | ECAN_GIM_GIL | ECAN_GIM_AAIM);
+    return mailboxes;
+}
+
+static void CanTxSetTpl(Uint16 n, Uint16 tpl)
+{
+    volatile struct MBOX *mbox;
+
+    if(canTx.tpl[n] != tpl)
+    {
+        canTx.tpl[n] = tpl;
+        mbox = ECAN_MBOX(n); // MSGCTRL of a transmit mailbox may be written while it waits for the bus
+        mbox->MSGCTRL.all = (mbox->MSGCTRL.all & ~CAN_TPL_MASK) | ((Uint32)tpl << ECAN_MSGCTRL_TPL_SHIFT);
+    }
+}
+
+// Put a frame in free mailbox n; TPL = ECAN_TPL_MAX - rank among the loaded frames, lower ranks move down one
+static void CanTxLoad(Uint16 n, const CanFrame *frame, Uint32 key, Uint32 seq)
+{
+    volatile struct MBOX *mbox = ECAN_MBOX(n);
+    Uint32 bit = 1UL << n;
+    Uint16 rank = 0;
+    Uint16 m;
+
+    for(m = 0; m < ECAN_MAILBOXES; m++)
+    {
+        if(canTx.loaded & (1UL << m))
+        {
+            if(CanTxBefore(canTx.key[m], canTx.seq[m], key, seq))
+            {
+                rank++;
+            }
+            else
+            {
+                CanTxSetTpl(m, canTx.tpl[m] - 1);
+            }
+        }
+    }
+
+    ECAN_WRITE(CANME, ECAN_READ(CANME) & ~bit); // MSGID can only be written while the mailbox is disabled
+    mbox->MSGID.all = EcanMsgId(frame->id);
+    ECAN_WRITE(CANME, ECAN_READ(CANME) | bit);
+    canTx.tpl[n] = ECAN_TPL_MAX - rank;
+    mbox->MSGCTRL.all = (frame->dlc & ECAN_MSGCTRL_DLC) | ((Uint32)canTx.tpl[n] << ECAN_MSGCTRL_TPL_SHIFT);
+    EcanSetData(mbox, frame);
+    canTx.key[n] = key;
+    canTx.seq[n] = seq;
+    canTx.loaded |= bit;
+    canTx.loadedCount++;
+    ECAN_WRITE(CANTRS, bit); // Transmit request
+}
+
+// Mailbox n is empty again: the frames ranked below it move up one
+static void CanTxRelease(Uint16 n)
+{
+    Uint16 m;
+
+    canTx.loaded &= ~(1UL << n);
+    canTx.loadedCount--;
+    for(m = 0; m < ECAN_MAILBOXES; m++)
+    {
+        if((canTx.loaded & (1UL << m)) && CanTxBefore(canTx.key[n], canTx.seq[n], canTx.key[m], canTx.seq[m]))
+        {
+            CanTxSetTpl(m, canTx.tpl[m] + 1);
+        }
+    }
+}
+
+static Uint16 CanTxEnqueue(const CanFrame *frame, Uint32 key, Uint32 seq)
+{
+    Uint16 slot = 0;
+    Uint16 i;
+
+    if(canTx.queued >= CAN_TX_QUEUE_SIZE)
+    {
+        return 0;
+    }
+    while(canTx.queueSlots & (1UL << slot))
+    {
+        slot++;
+    }
+    canTx.queueSlots |= 1UL << slot;
+    canTx.queue[slot] = *frame;
+    canTx.queueKey[slot] = key;
+    canTx.queueSeq[slot] = seq;
+
+    for(i = canTx.queued; i > 0 && CanTxBefore(key, seq, canTx.queueKey[canTx.order[i - 1]], canTx.queueSeq[canTx.order[i - 1]]); i--)
+    {
+        canTx.order[i] = canTx.order[i - 1];
+    }
+    canTx.order[i] = slot;
+    canTx.queued++;
+    return 1;
+}
+
+static Uint16 CanTxHighestFree(void)
+{
+    Uint32 free = canTx.mailboxes & ~canTx.loaded;
+    Uint16 n = ECAN_MAILBOXES - 1;
+
+    while(!(free & (1UL << n)))
+    {
+        n--;
+    }
+    return n;
+}
+
+// Load queued frames, best first, into free mailboxes
+static void CanTxRefill(void)
+{
+    Uint16 slot;
+    Uint16 i;
+
+    while(canTx.queued != 0 && (canTx.mailboxes & ~canTx.loaded) != 0)
+    {
+        slot = canTx.order[0];
+        CanTxLoad(CanTxHighestFree(), &canTx.queue[slot], canTx.queueKey[slot], canTx.queueSeq[slot]);
+        canTx.queued--;
+        for(i = 0; i < canTx.queued; i++)
+        {
+            canTx.order[i] = canTx.order[i + 1];
+        }
+        canTx.queueSlots &= ~(1UL << slot);
+    }
+}
+
+static Uint16 CanTxCount(Uint32 mask)
+{
+    Uint16 count = 0;
+
+    while(mask != 0)
+    {
+        mask &= mask - 1;
+        count++;
+    }
+    return count;
+}
+
+/*
+ * Queue a frame without waiting; returns 0 if the queue is full. If every mailbox is loaded and the frame outranks
+ * the worst loaded one, that one is aborted; CanTxService puts it back in the queue and loads this frame instead.
+ */
+Uint16 CanTxSend(const CanFrame *frame)
+{
+    Uint16 state = __disable_interrupts();
+    Uint32 key = CanTxKey(frame->id);
+    Uint32 seq = canTx.nextSeq++;
+    Uint32 candidates;
+    Uint16 worst = ECAN_MAILBOXES;
+    Uint16 m;
+
+    if((canTx.mailboxes & ~canTx.loaded) != 0)
+    {
+        CanTxLoad(CanTxHighestFree(), frame, key, seq);
+        __restore_interrupts(state);
+        return 1;
+    }
+    // Each pending preemption keeps a queue entry free for the frame it will bring back
+    if(canTx.queued + CanTxCount(canTx.preempted) >= CAN_TX_QUEUE_SIZE || !CanTxEnqueue(frame, key, seq))
+    {
+        canTx.rejected++;
+        __restore_interrupts(state);
+        return 0;
+    }
+
+    candidates = canTx.loaded & ~canTx.preempted & ~canTx.cancelled;
+    for(m = 0; m < ECAN_MAILBOXES; m++)
+    {
+        if((candidates & (1UL << m)) && (worst == ECAN_MAILBOXES
+           || CanTxBefore(canTx.key[worst], canTx.seq[worst], canTx.key[m], canTx.seq[m])))
+        {
+            worst = m;
+        }
+    }
+    if(worst != ECAN_MAILBOXES && CanTxBefore(key, seq, canTx.key[worst], canTx.seq[worst])
+       && canTx.queued + CanTxCount(canTx.preempted) < CAN_TX_QUEUE_SIZE)
+    {
+        canTx.preempted |= 1UL << worst;
+        ECAN_WRITE(CANTRR, 1UL << worst); // Completes with CANAA, or with CANTA if it was already on the bus
+    }
+    __restore_interrupts(state);
+    return 1;
+}
+
+// Frames queued or in mailboxes
+Uint16 CanTxPending(void)
+{
+    return canTx.queued + canTx.loadedCount;
+}
+
+// Drop every frame not yet on the bus, e.g. before going bus-off or changing mode
+void CanTxAbortAll(void)
+{
+    Uint16 state = __disable_interrupts();
+    Uint32 abort = canTx.loaded & ~canTx.cancelled;
+
+    canTx.aborted += canTx.queued;
+    canTx.queued = 0;
+    canTx.queueSlots = 0;
+    canTx.cancelled |= abort;
+    canTx.preempted &= ~abort;
+    ECAN_WRITE(CANTRR, abort);
+    __restore_interrupts(state);
+}
+
+// Call from the ECAN1INT interrupt: release acknowledged and aborted mailboxes and refill them from the queue
+void CanTxService(void)
+{
+    volatile struct MBOX *mbox;
+    CanFrame frame;
+    Uint32 done;
+    Uint32 bit;
+    Uint16 n;
+
+    canTx.interrupts++;
+    while((done = (ECAN_READ(CANTA) | ECAN_READ(CANAA)) & canTx.mailboxes) != 0)
+    {
+        for(n = 0; n < ECAN_MAILBOXES; n++)
+        {
+            bit = 1UL << n;
+            if(!(done & bit))
+            {
+                continue;
+            }
+            if(ECAN_READ(CANTA) & bit) // Sent, even if an abort was requested too late
+            {
+                ECAN_WRITE(CANTA, bit);
+                canTx.sent++;
+            }
+            else
+            {
+                ECAN_WRITE(CANAA, bit);
+                if(canTx.preempted & bit)
+                {
+                    mbox = ECAN_MBOX(n);
+                    frame.id = EcanFrameId(mbox->MSGID.all);
+                    frame.dlc = mbox->MSGCTRL.all & ECAN_MSGCTRL_DLC;
+                    EcanGetData(mbox, &frame);
+                    frame.timestamp = 0;
+                    CanTxEnqueue(&frame, canTx.key[n], canTx.seq[n]); // Space was kept for it
+                    canTx.requeued++;
+                }
+                else
+                {
+                    canTx.aborted++;
+                }
+            }
+            canTx.preempted &= ~bit;
+            canTx.cancelled &= ~bit;
+            CanTxRelease(n);
+        }
+        CanTxRefill();
+    }
+}
@@ -0,0 +1,58 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Non-blocking, priority-ordered eCAN transmit queue for the CAN_Trasmit example. CanTxSend loads a frame straight
+ * into a free transmit mailbox, so every mailbox can hold a frame waiting for the bus, and the module sends the next
+ * one back to back with the last. The transmit priority level (TPL) of each loaded mailbox is kept equal to its rank
+ * by identifier, so the module always offers the bus our highest-priority pending frame.
+ *
+ * Frames that find every mailbox loaded wait in a software queue sorted by identifier. A frame that outranks the worst
+ * loaded frame takes its mailbox: the worse frame is aborted with CANTRR and queued again. Mailboxes are released
+ * and refilled from ECAN1INT on transmit acknowledge (CANTA) and abort acknowledge (CANAA). The engine reaches the
+ * registers through the ECAN_* macros of ../CAN_Receive/ecan.h.
+ */
+
+#ifndef CAN_TX_H
+#define CAN_TX_H
+
+#include "ecan.h"
+
+#define CAN_TX_QUEUE_SIZE   32   // Frames waiting for a mailbox
+
+typedef struct
+{
+    CanFrame queue[CAN_TX_QUEUE_SIZE];      // Waiting frames
+    Uint32 queueKey[CAN_TX_QUEUE_SIZE];
+    Uint32 queueSeq[CAN_TX_QUEUE_SIZE];
+    Uint16 order[CAN_TX_QUEUE_SIZE];        // Queue slots, best first
+    Uint32 queueSlots;                      // Used entries of queue, bit n = slot n
+    Uint16 queued;                          // Entries in order
+    Uint32 key[ECAN_MAILBOXES];             // Arbitration key of the frame in each loaded mailbox
+    Uint32 seq[ECAN_MAILBOXES];             // Submission order, keeps frames with the same identifier in order
+    Uint16 tpl[ECAN_MAILBOXES];             // TPL written to each loaded mailbox
+    Uint32 mailboxes;                       // Transmit mailboxes, bit n = mailbox n
+    Uint32 loaded;                          // Mailboxes holding a frame (CANTRS set or just sent)
+    Uint32 preempted;                       // Mailboxes aborted to make room, their frame is queued again
+    Uint32 cancelled;                       // Mailboxes aborted by CanTxAbortAll, their frame is dropped
+    Uint16 loadedCount;
+    Uint32 nextSeq;
+    volatile Uint32 sent;                   // Frames acknowledged on the bus (CANTA)
+    volatile Uint32 aborted;                // Frames dropped by CanTxAbortAll
+    volatile Uint32 requeued;               // Frames aborted (CANTRR) to make room for a higher-priority one
+    volatile Uint32 rejected;               // CanTxSend calls refused because the queue was full
+    volatile Uint32 interrupts;             // CanTxService calls
+} CanTx;
+
+extern CanTx canTx;
+
+Uint32 CanTxInit(Uint32 mailboxes);
+Uint16 CanTxSend(const CanFrame *frame);
+Uint16 CanTxPending(void);
+void CanTxAbortAll(void);
+void CanTxService(void);
+
+#endif // CAN_TX_H
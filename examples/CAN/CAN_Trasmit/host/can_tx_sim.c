@@ -0,0 +1,323 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Runs the eCAN transmit queue (can_tx.c) on a Linux host against the eCAN register model of the CAN_Receive
+ * example (../../CAN_Receive/host/ecan_model.c). The simulation steps one bit time at a time: the model starts the
+ * mailbox the module would pick whenever the bus is free, and CanTxService runs ISR_LATENCY_US after ECAN1INT is
+ * requested, as the ISR in main.c would.
+ *
+ * The scenarios check that frames leave in identifier order, that a late high-priority frame takes the next slot on
+ * the bus, that preemption and aborts never lose or repeat a frame, and compare bus utilization with one transmit
+ * mailbox (load, wait for CANTA, load again) against all 32 at 500 kbps and 1 Mbps. The exit status is 1 if any
+ * check fails.
+ *
+ * Build: gcc -O2 -I.. -I../../CAN_Receive -I../../CAN_Receive/host -o can_tx_sim can_tx_sim.c ../../CAN_Receive/host/ecan_model.c ../can_tx.c
+ */
+
+#include "can_tx.h"
+#include "ecan_model.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define ISR_LATENCY_US  15      // Interrupt entry plus CanTxService at 60 MHz
+#define LOG_SIZE        4096
+
+static int failures;
+
+static Uint32 bitRate;          // kbps
+static Uint16 busOn;
+static Uint32 busEnd;           // Bit time the frame on the bus ends, 0 when idle
+static Uint32 busyBits;
+static Uint32 now;
+static Uint32 irqSince;
+static Uint16 irqWaiting;
+
+static CanFrame sentLog[LOG_SIZE];
+static Uint16 sentCount;
+
+static void Check(const char *name, int ok)
+{
+    printf("  %-52s %s\n", name, ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        failures++;
+    }
+}
+
+static void Setup(Uint32 mailboxes, Uint32 kbps)
+{
+    EcanModelReset();
+    memset(&canTx, 0, sizeof(canTx));
+    CanTxInit(mailboxes);
+    bitRate = kbps;
+    busOn = 1;
+    busEnd = 0;
+    busyBits = 0;
+    now = 0;
+    irqWaiting = 0;
+    sentCount = 0;
+}
+
+// Bits of a frame including the interframe space, without stuff bits
+static Uint32 FrameBits(Uint16 n)
+{
+    struct MBOX *mbox = EcanModelMbox(n);
+    Uint32 bits = (mbox->MSGID.all & ECAN_MSGID_IDE) ? 67 : 47;
+
+    return bits + 8 * (mbox->MSGCTRL.all & ECAN_MSGCTRL_DLC);
+}
+
+// Let bits bit times pass on the bus and in the CPU
+static void Run(Uint32 bits)
+{
+    Uint32 latency = ISR_LATENCY_US * bitRate / 1000;
+    Uint16 n;
+
+    while(bits-- > 0)
+    {
+        now++;
+        EcanModelAdvance(1);
+        if(busEnd != 0)
+        {
+            busyBits++;
+            if(now >= busEnd)
+            {
+                if(sentCount < LOG_SIZE)
+                {
+                    EcanModelTransmitEnd(&sentLog[sentCount++]);
+                }
+                busEnd = 0;
+            }
+        }
+        if(busEnd == 0 && busOn && (n = EcanModelTransmitStart()) != ECAN_MODEL_NONE)
+        {
+            busEnd = now + FrameBits(n);
+        }
+        if(EcanModelInterrupt(1))
+        {
+            if(!irqWaiting)
+            {
+                irqWaiting = 1;
+                irqSince = now;
+            }
+            if(now - irqSince >= latency)
+            {
+                irqWaiting = 0;
+                CanTxService();
+            }
+        }
+        else
+        {
+            irqWaiting = 0;
+        }
+    }
+}
+
+static void RunUntilIdle(void)
+{
+    Uint32 limit = 2000000;
+
+    while((CanTxPending() != 0 || busEnd != 0 || EcanModelInterrupt(1)) && limit-- > 0)
+    {
+        Run(1);
+    }
+}
+
+static Uint16 Send(Uint32 id, Uint16 seq)
+{
+    CanFrame f;
+    Uint16 i;
+
+    f.id = id;
+    f.dlc = 8;
+    for(i = 0; i < 8; i++)
+    {
+        f.data[i] = (seq * 7 + i) & 0xFF;
+    }
+    f.data[0] = seq & 0xFF;
+    f.data[1] = (seq >> 8) & 0xFF;
+    f.timestamp = 0;
+    return CanTxSend(&f);
+}
+
+static Uint16 Seq(const CanFrame *f)
+{
+    return f->data[0] | (f->data[1] << 8);
+}
+
+static Uint32 RandomId(void)
+{
+    if(rand() % 4 == 0)
+    {
+        return CAN_ID_EXT | (((Uint32)rand() << 8 ^ rand()) & ECAN_EXT_MASK);
+    }
+    return rand() & 0x7FF;
+}
+
+// Bus arbitration order, lower wins (same as CanTxKey)
+static Uint32 ArbitrationKey(Uint32 id)
+{
+    if(id & CAN_ID_EXT)
+    {
+        return (((id >> 18) & 0x7FF) << 19) | (1UL << 18) | (id & 0x3FFFF);
+    }
+    return (id & 0x7FF) << 19;
+}
+
+/*
+ * Every accepted frame was sent exactly once, with the data it was queued with, and frames with the same identifier
+ * kept their order. ids[s] is the identifier given to sequence number s.
+ */
+static int SentOnceInOrder(const Uint32 *ids, Uint16 count)
+{
+    static Uint16 seen[LOG_SIZE];
+    Uint16 last[2048];
+    Uint16 i, s;
+
+    memset(seen, 0, sizeof(seen));
+    memset(last, 0, sizeof(last));
+    for(i = 0; i < sentCount; i++)
+    {
+        s = Seq(&sentLog[i]);
+        if(s >= count || seen[s] || sentLog[i].id != ids[s] || sentLog[i].data[7] != ((s * 7 + 7) & 0xFF))
+        {
+            return 0;
+        }
+        seen[s] = 1;
+        if(!(ids[s] & CAN_ID_EXT))
+        {
+            if(last[ids[s]] != 0 && last[ids[s]] > s + 1)
+            {
+                return 0;
+            }
+            last[ids[s]] = s + 1;
+        }
+    }
+    return sentCount == count;
+}
+
+static double Utilization(Uint32 mailboxes, Uint32 kbps)
+{
+    Uint16 seq = 0;
+    Uint32 t;
+
+    Setup(mailboxes, kbps);
+    for(t = 0; t < 200000; t++)
+    {
+        while(CanTxPending() < 24)
+        {
+            Send(0x300 + (seq & 0x3F), seq);
+            seq++;
+        }
+        Run(1);
+    }
+    return (double)busyBits / now;
+}
+
+int main(void)
+{
+    static Uint32 ids[LOG_SIZE];
+    Uint16 accepted;
+    Uint16 urgentAt = 0;
+    Uint16 ok;
+    Uint16 i;
+    double single, all;
+
+    printf("eCAN transmit queue\n");
+    srand(2);
+
+    // Frames submitted while the bus is held leave sorted by identifier, whichever mailbox they landed in
+    Setup(0xFFFFFFFFUL, 1000);
+    busOn = 0;
+    for(i = 0; i < 48; i++)
+    {
+        ids[i] = RandomId();
+        Send(ids[i], i);
+        Run(40); // Aborts and refills complete
+    }
+    busOn = 1;
+    RunUntilIdle();
+    ok = SentOnceInOrder(ids, 48);
+    for(i = 1; i < sentCount; i++)
+    {
+        if(ArbitrationKey(sentLog[i - 1].id) > ArbitrationKey(sentLog[i].id))
+        {
+            ok = 0;
+        }
+    }
+    Check("48 frames, 32 mailboxes: sent in identifier order", ok);
+    Check("better frames preempted loaded ones", canTx.requeued != 0 && canTx.aborted == 0);
+
+    // A late high-priority frame goes next, behind only the frame already on the bus
+    Setup(0xFFFFFFFFUL, 1000);
+    for(i = 0; i < 48; i++)
+    {
+        ids[i] = 0x700 + i;
+        Send(ids[i], i);
+    }
+    Run(600);
+    ids[48] = 0x010;
+    accepted = sentCount;
+    Send(0x010, 48);
+    RunUntilIdle();
+    for(i = 0; i < sentCount; i++)
+    {
+        if(sentLog[i].id == 0x010)
+        {
+            urgentAt = i;
+        }
+    }
+    Check("late high-priority frame sent next", urgentAt <= accepted + 1 && SentOnceInOrder(ids, 49));
+
+    // Random traffic: nothing lost or repeated through preemption, same-identifier frames stay in order
+    Setup(0xFFFFFFFFUL, 500);
+    accepted = 0;
+    while(accepted < 3000)
+    {
+        ids[accepted] = (rand() % 8 == 0) ? RandomId() : 0x100 + (Uint32)(rand() % 16);
+        if(Send(ids[accepted], accepted))
+        {
+            accepted++;
+        }
+        Run(rand() % 200);
+    }
+    RunUntilIdle();
+    Check("3000 random frames: sent once, in order per id", SentOnceInOrder(ids, accepted));
+    printf("  %lu requeued, %lu rejected, %lu interrupts\n", (unsigned long)canTx.requeued,
+           (unsigned long)canTx.rejected, (unsigned long)canTx.interrupts);
+
+    // CanTxAbortAll: the frame on the bus still completes, everything else is dropped
+    Setup(0x0000FFFFUL, 1000);
+    busOn = 0;
+    for(i = 0; i < 24; i++)
+    {
+        Send(0x400 + i, i);
+    }
+    Run(1);
+    busOn = 1;
+    Run(10); // First frame on the bus
+    CanTxAbortAll();
+    RunUntilIdle();
+    Check("abort during transmission completes with CANTA", canTx.sent == 1 && sentCount == 1);
+    Check("sent + aborted = submitted, mailboxes free", canTx.sent + canTx.aborted == 24 && CanTxPending() == 0
+          && ecanModel.regs[ECAN_CANTRS] == 0);
+
+    // Bus utilization with the queue kept fed
+    single = Utilization(1UL << 31, 500);
+    all = Utilization(0xFFFFFFFFUL, 500);
+    printf("  500 kbps: 1 mailbox %.1f%%, 32 mailboxes %.1f%%\n", single * 100, all * 100);
+    Check("32 mailboxes keep the bus busy at 500 kbps", all > 0.99 && all > single);
+    single = Utilization(1UL << 31, 1000);
+    all = Utilization(0xFFFFFFFFUL, 1000);
+    printf("  1 Mbps:   1 mailbox %.1f%%, 32 mailboxes %.1f%%\n", single * 100, all * 100);
+    Check("32 mailboxes keep the bus busy at 1 Mbps", all > 0.99 && all > single);
+
+    printf(failures ? "%d check(s) failed\n" : "All checks passed\n", failures);
+    return failures != 0;
+}
@@ -2,19 +2,48 @@
  * Author: Kiran Jojare
  * Email: kijo7257@colorado.edu
  * Date: June 19, 2024
- * Version: 1.0
+ * Version: 1.1
  *
  * Description:
  * This code demonstrates how to use the CAN (Controller Area Network) module to send messages on the Texas Instruments C2000 Piccolo LaunchPad Evaluation Kit (LAUNCHHXL-F28027F).
- * The CAN module is configured to communicate at a baud rate of 500 kbps.
+ * The CAN module is configured to communicate at CAN_BITRATE, 500 kbps or 1 Mbps.
  *
  * The code initializes the system control and GPIO settings, configures the CAN module, and sends CAN messages.
+ * CanTxSend (can_tx.c) never waits for the bus: it loads the frame into one of the 32 mailboxes, all used for
+ * transmit, with a transmit priority that keeps the loaded frames in identifier order, or queues it when every
+ * mailbox is full. The ECAN1INT interrupt refills mailboxes as frames are acknowledged, so the module sends frames
+ * back to back. A status frame every 10 ms shares the bus with a bulk stream that keeps the queue fed; the status
+ * frame has the lower identifier and goes out next whenever it is due. Add can_tx.c and can_tx.h from this folder
+ * and ecan.h from ../CAN_Receive to the project.
  *
  * This example is intended to help users get started with basic CAN transmit operations on the F28027F microcontroller.
  */
 
 #include "F2802x_Device.h"
 #include "f2802x_examples.h"
+#include "can_tx.h"
+
+#define CAN_BITRATE  500000      // 500000 or 1000000
+
+#define STATUS_ID    0x080       // Periodic status, every 10 ms
+#define BULK_ID      0x400       // Bulk data, as fast as the bus takes it
+
+/*
+ * Bit timing: the eCAN clock is SYSCLKOUT / 2 = 30 MHz and BRPREG = 2 gives a 100 ns time quantum.
+ * 500 kbps: 20 TQ = 1 + TSEG1 13 + TSEG2 6; 1 Mbps: 10 TQ = 1 + TSEG1 6 + TSEG2 3. Sample point 70%, SJW 2.
+ */
+#if CAN_BITRATE == 1000000
+#define CAN_BTC      0x0002012AUL
+#else
+#define CAN_BTC      0x00020165UL
+#endif
+
+__interrupt void ecan1_isr(void);
+
+CanFrame statusFrame;
+CanFrame bulkFrame;
+Uint16 statusCount;
+Uint16 bulkCount;
 
 void InitGpio()
 {
@@ -37,38 +66,75 @@ void InitCan()
 
     EALLOW;
     ECanaRegs.CANME.all = 0; // Disable all mailboxes
-    ECanaRegs.CANMD.all = 0xFFFFFFFF; // Set all mailboxes to transmit
     ECanaRegs.CANMC.bit.CCR = 1; // Enable configuration change
     while(ECanaRegs.CANES.bit.CCE != 1); // Wait for configuration change enable
 
-    ECanaRegs.CANBTC.all = 0x00023F00; // Set baud rate to 500 kbps
+    ECanaRegs.CANBTC.all = CAN_BTC; // Set baud rate to CAN_BITRATE
     ECanaRegs.CANMC.bit.CCR = 0; // Disable configuration change
     while(ECanaRegs.CANES.bit.CCE != 0); // Wait for configuration change disable
 
-    ECanaRegs.CANME.all = 0xFFFFFFFF; // Enable all mailboxes
+    CanTxInit(0xFFFFFFFF); // All mailboxes transmit, enabled as they are loaded
     EDIS;
 }
 
-void CanTransmit(Uint16 mailbox, Uint16 data)
-{
-    ECanaMboxes.MBOX0.MDH.all = 0x00000000;
-    ECanaMboxes.MBOX0.MDL.all = data;
-    ECanaRegs.CANTRS.all = (1 << mailbox); // Set TRS bit to transmit data
-    while(ECanaRegs.CANTA.all != (1 << mailbox)); // Wait for TAn bit to be set
-    ECanaRegs.CANTA.all = (1 << mailbox); // Clear TAn bit
-}
-
 void main(void)
 {
+    Uint16 ms = 0;
+    Uint16 i;
+
     InitSysCtrl(); // Initialize the CPU and configure the clock
     DINT;          // Disable CPU interrupts
 
     InitGpio();    // Initialize the GPIO
     InitCan();     // Initialize the CAN
 
+    InitPieCtrl(); // Initialize the PIE control registers
+    InitPieVectTable(); // Initialize the PIE vector table
+
+    EALLOW;
+    PieVectTable.ECAN1INTA = &ecan1_isr; // Map ISR to the PIE vector table
+    EDIS;
+
+    IER |= M_INT9; // Enable CPU INT9
+    PieCtrlRegs.PIEIER9.bit.INTx6 = 1; // Enable PIE Group 9 interrupt 6 (ECAN1INTA)
+
+    EINT;  // Enable Global interrupt INTM
+    ERTM;  // Enable Global realtime interrupt DBGM
+
+    statusFrame.id = STATUS_ID;
+    statusFrame.dlc = 2;
+    bulkFrame.id = BULK_ID;
+    bulkFrame.dlc = 8;
+
     while(1)
     {
-        CanTransmit(0, 0xA5A5A5A5); // Send CAN message
-        DELAY_US(1000000); // Delay for 1 second
+        while(CanTxPending() < 16) // Keep the mailboxes busy without filling the queue
+        {
+            bulkFrame.data[0] = bulkCount & 0xFF;
+            bulkFrame.data[1] = (bulkCount >> 8) & 0xFF;
+            for(i = 2; i < 8; i++)
+            {
+                bulkFrame.data[i] = 0xA5;
+            }
+            CanTxSend(&bulkFrame);
+            bulkCount++;
+        }
+
+        DELAY_US(1000);
+        if(++ms == 10)
+        {
+            ms = 0;
+            statusFrame.data[0] = statusCount & 0xFF;
+            statusFrame.data[1] = (statusCount >> 8) & 0xFF;
+            CanTxSend(&statusFrame); // Outranks every bulk frame, so it goes out next
+            statusCount++;
+        }
     }
 }
+
+__interrupt void ecan1_isr(void)
+{
+    CanTxService(); // Releases acknowledged and aborted mailboxes and loads queued frames
+
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP9; // Acknowledge interrupt
+}
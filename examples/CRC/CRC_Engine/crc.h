@@ -0,0 +1,80 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * CRC-8, CRC-16/CCITT and CRC-32 for the SCI, SPI, I2C, eCAN and flash examples.
+ *
+ *     CRC-8             poly 0x07,       init 0x00,       no reflection, check 0xF4
+ *     CRC-16/CCITT      poly 0x1021,     init 0xFFFF,     no reflection, check 0x29B1 (CCITT-FALSE)
+ *     CRC-32            poly 0x04C11DB7, init 0xFFFFFFFF, reflected,     check 0xCBF43926 (zlib, Ethernet)
+ *
+ * Every function takes the CRC so far and returns the updated CRC, so a message split over
+ * several buffers gives the same result as one call over the whole message. Start with
+ * CRC8_INIT, CRC16_INIT or CRC32_INIT. The CRC-32 inversion is done inside the functions
+ * (like zlib), so the returned value is always the final CRC.
+ *
+ * On the C28x a char is 16 bits, so data is passed one byte per Uint16 and the upper 8 bits
+ * are ignored. On a host, data is passed as unsigned char.
+ */
+
+#ifndef CRC_H
+#define CRC_H
+
+#ifdef __TMS320C2000__
+#include "F2802x_Device.h"
+typedef Uint16 CrcByte;  // One byte per 16-bit char
+#else
+#include <stdint.h>
+typedef uint16_t Uint16;
+typedef uint32_t Uint32;
+typedef unsigned char CrcByte;
+#define CRC_SLICE_BY_8   // Slice-by-8 needs 8 x 256 table entries per CRC, host only
+#endif
+
+#define CRC8_INIT  0x00
+#define CRC16_INIT 0xFFFF
+#define CRC32_INIT 0x00000000UL
+
+// 256-entry tables, const so they are placed in flash on the target
+extern const Uint16 crc8Table[256];
+extern const Uint16 crc16Table[256];
+extern const Uint32 crc32Table[256];
+
+// Single-byte updates for code that builds a message one field at a time
+static inline Uint16 Crc8Byte(Uint16 crc, Uint16 byte)
+{
+    return crc8Table[(crc ^ byte) & 0xFF];
+}
+
+static inline Uint16 Crc16Byte(Uint16 crc, Uint16 byte)
+{
+    return ((crc << 8) ^ crc16Table[((crc >> 8) ^ byte) & 0xFF]) & 0xFFFF;
+}
+
+// Works on the inverted register: start from ~CRC32_INIT and invert the result
+static inline Uint32 Crc32Byte(Uint32 crc, Uint16 byte)
+{
+    return (crc >> 8) ^ crc32Table[(crc ^ byte) & 0xFF];
+}
+
+// Reference versions, one bit at a time, no tables
+Uint16 Crc8Bitwise(Uint16 crc, const CrcByte *data, Uint32 length);
+Uint16 Crc16Bitwise(Uint16 crc, const CrcByte *data, Uint32 length);
+Uint32 Crc32Bitwise(Uint32 crc, const CrcByte *data, Uint32 length);
+
+// Table driven, one table lookup per byte
+Uint16 Crc8(Uint16 crc, const CrcByte *data, Uint32 length);
+Uint16 Crc16(Uint16 crc, const CrcByte *data, Uint32 length);
+Uint32 Crc32(Uint32 crc, const CrcByte *data, Uint32 length);
+
+#ifdef CRC_SLICE_BY_8
+// Eight bytes per step with eight independent lookups; call CrcSlice8Init once first
+void CrcSlice8Init(void);
+Uint16 Crc16Slice8(Uint16 crc, const CrcByte *data, Uint32 length);
+Uint32 Crc32Slice8(Uint32 crc, const CrcByte *data, Uint32 length);
+#endif
+
+#endif // CRC_H
@@ -0,0 +1,183 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Checks and benchmarks the CRC module (crc.c) on a Linux host, including the slice-by-8 versions that are only
+ * built for host tools.
+ *
+ * Every variant must give the standard check value for "123456789". Over random messages of 0 to 300 bytes, split
+ * at a random point, the table and slice-by-8 versions must match the bitwise reference, including the 0 to 7 byte
+ * tails that slice-by-8 hands to the table version. It then prints the host time per byte and the throughput of the
+ * bitwise, table and slice-by-8 versions over a 256-byte buffer (the size main.c times on the target) and a 64 KB
+ * buffer, and checks that slice-by-8 beats the table version on the large buffer. The exit status is 1 if any
+ * check fails.
+ *
+ * Build: gcc -O2 -I.. -o crc_bench crc_bench.c ../crc.c
+ */
+
+#include "crc.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define TEST_MESSAGES  20000
+#define TEST_MAX_BYTES 300
+#define BENCH_BYTES    (16UL * 1024 * 1024) // Bytes processed per measurement
+
+static int failures;
+static volatile Uint32 sink;
+static CrcByte benchData[65536];
+
+typedef struct
+{
+    const char *name;
+    Uint32 (*run)(const CrcByte *data, Uint32 length);
+} CrcVariant;
+
+static void Check(const char *name, int ok)
+{
+    printf("  %-52s %s\n", name, ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        failures++;
+    }
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static Uint32 RunCrc8Bitwise(const CrcByte *data, Uint32 length) { return Crc8Bitwise(CRC8_INIT, data, length); }
+static Uint32 RunCrc8(const CrcByte *data, Uint32 length) { return Crc8(CRC8_INIT, data, length); }
+static Uint32 RunCrc16Bitwise(const CrcByte *data, Uint32 length) { return Crc16Bitwise(CRC16_INIT, data, length); }
+static Uint32 RunCrc16(const CrcByte *data, Uint32 length) { return Crc16(CRC16_INIT, data, length); }
+static Uint32 RunCrc16Slice8(const CrcByte *data, Uint32 length) { return Crc16Slice8(CRC16_INIT, data, length); }
+static Uint32 RunCrc32Bitwise(const CrcByte *data, Uint32 length) { return Crc32Bitwise(CRC32_INIT, data, length); }
+static Uint32 RunCrc32(const CrcByte *data, Uint32 length) { return Crc32(CRC32_INIT, data, length); }
+static Uint32 RunCrc32Slice8(const CrcByte *data, Uint32 length) { return Crc32Slice8(CRC32_INIT, data, length); }
+
+static const CrcVariant variants[] =
+{
+    { "Crc8Bitwise",  RunCrc8Bitwise },
+    { "Crc8",         RunCrc8 },
+    { "Crc16Bitwise", RunCrc16Bitwise },
+    { "Crc16",        RunCrc16 },
+    { "Crc16Slice8",  RunCrc16Slice8 },
+    { "Crc32Bitwise", RunCrc32Bitwise },
+    { "Crc32",        RunCrc32 },
+    { "Crc32Slice8",  RunCrc32Slice8 },
+};
+
+#define NUM_VARIANTS (sizeof(variants) / sizeof(variants[0]))
+
+static void TestCheckValues(void)
+{
+    static const CrcByte check[9] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+    static const Uint32 expected[NUM_VARIANTS] =
+        { 0xF4, 0xF4, 0x29B1, 0x29B1, 0x29B1, 0xCBF43926UL, 0xCBF43926UL, 0xCBF43926UL };
+    char label[64];
+    unsigned i;
+
+    for(i = 0; i < NUM_VARIANTS; i++)
+    {
+        sprintf(label, "%s: check value 0x%lX", variants[i].name, (unsigned long)expected[i]);
+        Check(label, variants[i].run(check, 9) == expected[i]);
+    }
+}
+
+// Random messages, each split in two at a random point, against the bitwise reference
+static void TestRandomMessages(void)
+{
+    CrcByte data[TEST_MAX_BYTES];
+    Uint32 length, split, i;
+    Uint16 ref16;
+    Uint32 ref32;
+    int n, ok8 = 1, ok16 = 1, ok32 = 1;
+
+    for(n = 0; n < TEST_MESSAGES; n++)
+    {
+        length = rand() % (TEST_MAX_BYTES + 1);
+        split = rand() % (length + 1);
+        for(i = 0; i < length; i++)
+        {
+            data[i] = (CrcByte)rand();
+        }
+
+        ok8 &= Crc8(Crc8(CRC8_INIT, data, split), data + split, length - split)
+               == Crc8Bitwise(CRC8_INIT, data, length);
+
+        ref16 = Crc16Bitwise(CRC16_INIT, data, length);
+        ok16 &= Crc16(Crc16(CRC16_INIT, data, split), data + split, length - split) == ref16;
+        ok16 &= Crc16Slice8(Crc16Slice8(CRC16_INIT, data, split), data + split, length - split) == ref16;
+
+        ref32 = Crc32Bitwise(CRC32_INIT, data, length);
+        ok32 &= Crc32(Crc32(CRC32_INIT, data, split), data + split, length - split) == ref32;
+        ok32 &= Crc32Slice8(Crc32Slice8(CRC32_INIT, data, split), data + split, length - split) == ref32;
+    }
+    Check("CRC-8: table matches bitwise, split messages", ok8);
+    Check("CRC-16: table and slice-by-8 match bitwise", ok16);
+    Check("CRC-32: table and slice-by-8 match bitwise", ok32);
+}
+
+// Nanoseconds per byte over buffers of the given length
+static double Bench(const CrcVariant *v, Uint32 length)
+{
+    Uint32 runs = BENCH_BYTES / length;
+    Uint32 r;
+    double start;
+
+    if(v->run == RunCrc8Bitwise || v->run == RunCrc16Bitwise || v->run == RunCrc32Bitwise)
+    {
+        runs = runs / 8 + 1; // The bitwise versions are slow, fewer runs are enough
+    }
+    start = Now();
+    for(r = 0; r < runs; r++)
+    {
+        sink += v->run(benchData, length);
+    }
+    return (Now() - start) * 1e9 / ((double)runs * length);
+}
+
+static void BenchAll(void)
+{
+    double ns256[NUM_VARIANTS], ns64k[NUM_VARIANTS];
+    unsigned i;
+
+    for(i = 0; i < sizeof(benchData); i++)
+    {
+        benchData[i] = (CrcByte)rand();
+    }
+
+    printf("Host time per byte and throughput:\n");
+    printf("  variant         256 bytes           64 KB\n");
+    for(i = 0; i < NUM_VARIANTS; i++)
+    {
+        ns256[i] = Bench(&variants[i], 256);
+        ns64k[i] = Bench(&variants[i], sizeof(benchData));
+        printf("  %-12s %6.2f ns %6.0f MB/s  %6.2f ns %6.0f MB/s\n", variants[i].name, ns256[i], 1e3 / ns256[i],
+               ns64k[i], 1e3 / ns64k[i]);
+    }
+    printf("  slice-by-8 over table, 64 KB: CRC-16 %.1fx, CRC-32 %.1fx\n", ns64k[3] / ns64k[4], ns64k[6] / ns64k[7]);
+    Check("CRC-16: slice-by-8 faster than the table version", ns64k[4] < ns64k[3]);
+    Check("CRC-32: slice-by-8 faster than the table version", ns64k[7] < ns64k[6]);
+}
+
+int main(void)
+{
+    srand(1);
+    CrcSlice8Init();
+    TestCheckValues();
+    TestRandomMessages();
+    BenchAll();
+
+    printf(failures ? "%d check(s) failed\n" : "All checks passed\n", failures);
+    return failures != 0;
+}
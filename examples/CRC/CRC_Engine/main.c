@@ -0,0 +1,115 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * This code benchmarks the CRC module (crc.c, crc.h) on the Texas Instruments C2000 Piccolo LaunchPad Evaluation Kit
+ * (LAUNCHHXL-F28027F). The bitwise and 256-entry table versions of CRC-8, CRC-16/CCITT and CRC-32 are checked against
+ * the standard check values, and each one is timed over a 256-byte buffer with CPU Timer 1.
+ *
+ * The results are left in crcBench for the CCS Expressions window. crcBench[i].bytesPerKCycle is the throughput in
+ * bytes per 1000 CPU cycles. The check results are in crcCheckFailures, which should be 0.
+ *
+ * The same crc.c is used by the UART_Telemetry example and its host decoder.
+ */
+
+#include "F2802x_Device.h"
+#include "f2802x_examples.h"
+#include "crc.h"
+
+#define CRC_BENCH_LENGTH   256 // Bytes per timed run
+#define CRC_BENCH_VARIANTS 6
+
+typedef struct
+{
+    Uint32 cycles;          // CPU cycles for CRC_BENCH_LENGTH bytes
+    Uint32 bytesPerKCycle;  // Bytes per 1000 CPU cycles
+    Uint32 crc;             // Result, all variants of one CRC must agree
+} CrcBenchResult;
+
+Uint16 crcBenchData[CRC_BENCH_LENGTH];
+CrcBenchResult crcBench[CRC_BENCH_VARIANTS]; // Crc8Bitwise, Crc8, Crc16Bitwise, Crc16, Crc32Bitwise, Crc32
+Uint16 crcCheckFailures;
+
+const Uint16 crcCheckString[9] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+
+void InitCpuTimer1()
+{
+    EALLOW;
+    CpuTimer1Regs.PRD.all = 0xFFFFFFFF; // Maximum period
+    CpuTimer1Regs.TPR.all = 0;          // Count every SYSCLKOUT cycle
+    CpuTimer1Regs.TPRH.all = 0;
+    CpuTimer1Regs.TCR.bit.TSS = 1;    // Stop the timer
+    CpuTimer1Regs.TCR.bit.TRB = 1;    // Reload the timer
+    CpuTimer1Regs.TCR.bit.TIE = 0;    // No timer interrupt
+    CpuTimer1Regs.TCR.bit.TSS = 0;    // Start the timer
+    EDIS;
+}
+
+// Check every variant against the published check value for "123456789"
+Uint16 CrcSelfTest()
+{
+    Uint16 failures = 0;
+
+    failures += Crc8Bitwise(CRC8_INIT, crcCheckString, 9) != 0xF4;
+    failures += Crc8(CRC8_INIT, crcCheckString, 9) != 0xF4;
+    failures += Crc16Bitwise(CRC16_INIT, crcCheckString, 9) != 0x29B1;
+    failures += Crc16(CRC16_INIT, crcCheckString, 9) != 0x29B1;
+    failures += Crc32Bitwise(CRC32_INIT, crcCheckString, 9) != 0xCBF43926UL;
+    failures += Crc32(CRC32_INIT, crcCheckString, 9) != 0xCBF43926UL;
+
+    // Incremental update over fragments must match a single call
+    failures += Crc16(Crc16(CRC16_INIT, crcCheckString, 4), &crcCheckString[4], 5) != 0x29B1;
+    failures += Crc32(Crc32(CRC32_INIT, crcCheckString, 4), &crcCheckString[4], 5) != 0xCBF43926UL;
+    return failures;
+}
+
+void CrcBenchRun(Uint16 variant)
+{
+    Uint32 start, cycles;
+    Uint32 crc;
+
+    start = CpuTimer1Regs.TIM.all;
+    switch(variant)
+    {
+    case 0: crc = Crc8Bitwise(CRC8_INIT, crcBenchData, CRC_BENCH_LENGTH); break;
+    case 1: crc = Crc8(CRC8_INIT, crcBenchData, CRC_BENCH_LENGTH); break;
+    case 2: crc = Crc16Bitwise(CRC16_INIT, crcBenchData, CRC_BENCH_LENGTH); break;
+    case 3: crc = Crc16(CRC16_INIT, crcBenchData, CRC_BENCH_LENGTH); break;
+    case 4: crc = Crc32Bitwise(CRC32_INIT, crcBenchData, CRC_BENCH_LENGTH); break;
+    default: crc = Crc32(CRC32_INIT, crcBenchData, CRC_BENCH_LENGTH); break;
+    }
+    cycles = start - CpuTimer1Regs.TIM.all; // Timer counts down
+
+    crcBench[variant].cycles = cycles;
+    crcBench[variant].bytesPerKCycle = (CRC_BENCH_LENGTH * 1000UL) / cycles;
+    crcBench[variant].crc = crc;
+}
+
+void main(void)
+{
+    Uint16 i;
+
+    InitSysCtrl(); // Initialize the CPU and configure the clock
+    DINT;          // Disable CPU interrupts
+
+    InitCpuTimer1(); // Free-running cycle counter
+
+    for(i = 0; i < CRC_BENCH_LENGTH; i++)
+    {
+        crcBenchData[i] = (i * 37 + 11) & 0xFF; // Arbitrary test pattern
+    }
+
+    crcCheckFailures = CrcSelfTest();
+
+    while(1)
+    {
+        for(i = 0; i < CRC_BENCH_VARIANTS; i++)
+        {
+            CrcBenchRun(i);
+        }
+        DELAY_US(1000000); // Repeat every second
+    }
+}
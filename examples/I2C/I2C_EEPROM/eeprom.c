@@ -0,0 +1,415 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Write-back page cache and transfer state machine of the 24Cxx EEPROM driver (see eeprom.h).
+ */
+
+#include "eeprom.h"
+
+// Driver operations
+#define EEPROM_OP_IDLE   0
+#define EEPROM_OP_WRITE  1   // Page write of opMask bytes of opLine
+#define EEPROM_OP_FILL   2   // Page read into opLine
+
+#define EEPROM_FULL_PAGE  ((EEPROM_PAGE_SIZE == 32) ? 0xFFFFFFFFUL : ((1UL << EEPROM_PAGE_SIZE) - 1))
+
+Eeprom eeprom;
+
+void EepromInit(Uint16 device)
+{
+    Uint16 i;
+
+    for(i = 0; i < EEPROM_CACHE_LINES; i++)
+    {
+        eeprom.lines[i].page = EEPROM_NO_PAGE;
+        eeprom.lines[i].valid = 0;
+        eeprom.lines[i].dirty = 0;
+    }
+    eeprom.device = device;
+    eeprom.op = EEPROM_OP_IDLE;
+    eeprom.opLine = 0;
+    eeprom.fillPage = EEPROM_NO_PAGE;
+    eeprom.flushAll = 0;
+    eeprom.starved = 0;
+}
+
+// Bits first .. first + count - 1
+static Uint32 EepromMask(Uint16 first, Uint16 count)
+{
+    Uint32 mask = (count == 32) ? 0xFFFFFFFFUL : ((1UL << count) - 1);
+
+    return mask << first;
+}
+
+static EepromLine *EepromLookup(Uint16 page)
+{
+    Uint16 i;
+
+    for(i = 0; i < EEPROM_CACHE_LINES; i++)
+    {
+        if(eeprom.lines[i].page == page)
+        {
+            return &eeprom.lines[i];
+        }
+    }
+    return 0;
+}
+
+// Take an unused line, or the least recently used clean one; 0 if every line is dirty or busy
+static EepromLine *EepromAllocate(Uint16 page)
+{
+    EepromLine *line = 0;
+    EepromLine *l;
+    Uint16 i;
+
+    for(i = 0; i < EEPROM_CACHE_LINES; i++)
+    {
+        l = &eeprom.lines[i];
+        if(l->page == EEPROM_NO_PAGE)
+        {
+            line = l;
+            break;
+        }
+        if(l->dirty == 0 && l != eeprom.opLine && (line == 0 || (Uint32)(l->lastUse - line->lastUse) > 0x80000000UL))
+        {
+            line = l;
+        }
+    }
+    if(line != 0)
+    {
+        line->page = page;
+        line->valid = 0;
+        line->dirty = 0;
+        line->lastUse = ++eeprom.uses;
+    }
+    return line;
+}
+
+static void EepromSetAddress(Uint16 address)
+{
+#if EEPROM_ADDRESS_BYTES == 2
+    eeprom.header[0] = (address >> 8) & 0xFF;
+    eeprom.header[1] = address & 0xFF;
+#else
+    eeprom.header[0] = address & 0xFF;
+#endif
+}
+
+static void EepromSubmit(Uint16 op, EepromLine *line)
+{
+    eeprom.op = op;
+    eeprom.opLine = line;
+    eeprom.transfer.address = eeprom.device;
+    eeprom.transfer.done = 0; // EepromService polls the status
+    if(!I2cSubmit(&eeprom.transfer))
+    {
+        eeprom.op = EEPROM_OP_IDLE; // I2C queue full, try again on the next call
+        eeprom.opLine = 0;
+    }
+}
+
+// Write the dirty bytes from the first one onwards in one page write, bridging clean gaps whose value is known
+static void EepromStartWrite(EepromLine *line)
+{
+    Uint16 first = 0;
+    Uint16 last;
+    Uint16 i;
+
+    while(!(line->dirty & (1UL << first)))
+    {
+        first++;
+    }
+    last = first;
+    for(i = first + 1; i < EEPROM_PAGE_SIZE; i++)
+    {
+        if(line->dirty & (1UL << i))
+        {
+            last = i;
+        }
+        else if(!(line->valid & (1UL << i)))
+        {
+            break; // Unknown byte: it must not be overwritten
+        }
+    }
+
+    EepromSetAddress(line->page * EEPROM_PAGE_SIZE + first);
+    for(i = first; i <= last; i++)
+    {
+        eeprom.header[EEPROM_ADDRESS_BYTES + i - first] = line->data[i];
+    }
+    eeprom.transfer.tx = eeprom.header;
+    eeprom.transfer.txLength = EEPROM_ADDRESS_BYTES + last - first + 1;
+    eeprom.transfer.rx = 0;
+    eeprom.transfer.rxLength = 0;
+    eeprom.opMask = EepromMask(first, last - first + 1);
+    eeprom.rewritten = 0;
+    eeprom.polls = 0;
+    EepromSubmit(EEPROM_OP_WRITE, line);
+}
+
+static void EepromStartFill(EepromLine *line)
+{
+    EepromSetAddress(line->page * EEPROM_PAGE_SIZE);
+    eeprom.transfer.tx = eeprom.header;
+    eeprom.transfer.txLength = EEPROM_ADDRESS_BYTES;
+    eeprom.transfer.rx = eeprom.buffer;
+    eeprom.transfer.rxLength = EEPROM_PAGE_SIZE;
+    eeprom.polls = 0;
+    EepromSubmit(EEPROM_OP_FILL, line);
+}
+
+static void EepromComplete(void)
+{
+    EepromLine *line = eeprom.opLine;
+    Uint16 i;
+
+    if(eeprom.op == EEPROM_OP_WRITE)
+    {
+        line->dirty = (line->dirty & ~eeprom.opMask) | eeprom.rewritten;
+        eeprom.pageWrites++;
+        eeprom.starved = 0;
+    }
+    else
+    {
+        for(i = 0; i < EEPROM_PAGE_SIZE; i++)
+        {
+            if(!(line->dirty & (1UL << i)))
+            {
+                line->data[i] = eeprom.buffer[i]; // Bytes written since the read was started are newer
+            }
+        }
+        line->valid = EEPROM_FULL_PAGE;
+    }
+}
+
+/*
+ * Accept up to length bytes for address onwards into the cache. Returns the number accepted, which is less than
+ * length when the cache has no clean line left; EepromService frees lines by writing them back.
+ */
+Uint16 EepromWrite(Uint16 address, const Uint16 *data, Uint16 length)
+{
+    EepromLine *line;
+    Uint16 accepted = 0;
+    Uint16 offset;
+    Uint16 count;
+    Uint16 i;
+    Uint32 mask;
+
+    if(address >= EEPROM_SIZE)
+    {
+        return 0;
+    }
+    if(length > EEPROM_SIZE - address)
+    {
+        length = EEPROM_SIZE - address;
+    }
+    while(accepted < length)
+    {
+        offset = (address + accepted) % EEPROM_PAGE_SIZE;
+        count = EEPROM_PAGE_SIZE - offset;
+        if(count > length - accepted)
+        {
+            count = length - accepted;
+        }
+
+        line = EepromLookup((address + accepted) / EEPROM_PAGE_SIZE);
+        if(line == 0)
+        {
+            line = EepromAllocate((address + accepted) / EEPROM_PAGE_SIZE);
+            if(line == 0)
+            {
+                eeprom.starved = 1;
+                break;
+            }
+        }
+
+        for(i = 0; i < count; i++)
+        {
+            line->data[offset + i] = data[accepted + i] & 0xFF;
+        }
+        mask = EepromMask(offset, count);
+        line->valid |= mask;
+        line->dirty |= mask;
+        if(line == eeprom.opLine && eeprom.op == EEPROM_OP_WRITE)
+        {
+            eeprom.rewritten |= mask; // The page write in flight carries the old values
+        }
+        line->lastWrite = eeprom.ticks;
+        line->lastUse = ++eeprom.uses;
+        accepted += count;
+    }
+    eeprom.bytesWritten += accepted;
+    return accepted;
+}
+
+/*
+ * Copy length bytes from address onwards. Returns 1 when data is complete. Returns 0 when a page has to be read
+ * first; the read is started by EepromService, so call again later with the same arguments.
+ */
+Uint16 EepromRead(Uint16 address, Uint16 *data, Uint16 length)
+{
+    EepromLine *line;
+    Uint16 done;
+    Uint16 offset;
+    Uint16 count;
+    Uint16 i;
+    Uint32 mask;
+
+    if(address >= EEPROM_SIZE || length > EEPROM_SIZE - address)
+    {
+        return 0;
+    }
+    for(done = 0; done < length; done += count) // Every byte must be in the cache before any is copied
+    {
+        offset = (address + done) % EEPROM_PAGE_SIZE;
+        count = EEPROM_PAGE_SIZE - offset;
+        if(count > length - done)
+        {
+            count = length - done;
+        }
+        line = EepromLookup((address + done) / EEPROM_PAGE_SIZE);
+        mask = EepromMask(offset, count);
+        if(line == 0 || (line->valid & mask) != mask)
+        {
+            if(eeprom.fillPage == EEPROM_NO_PAGE)
+            {
+                eeprom.fillPage = (address + done) / EEPROM_PAGE_SIZE;
+                eeprom.readMisses++;
+            }
+            return 0;
+        }
+    }
+
+    for(done = 0; done < length; done += count)
+    {
+        offset = (address + done) % EEPROM_PAGE_SIZE;
+        count = EEPROM_PAGE_SIZE - offset;
+        if(count > length - done)
+        {
+            count = length - done;
+        }
+        line = EepromLookup((address + done) / EEPROM_PAGE_SIZE);
+        for(i = 0; i < count; i++)
+        {
+            data[done + i] = line->data[offset + i];
+        }
+        line->lastUse = ++eeprom.uses;
+    }
+    eeprom.readHits++;
+    return 1;
+}
+
+// Write every dirty page without waiting for EEPROM_COMBINE_TICKS; EepromIdle tells when it is done
+void EepromFlush(void)
+{
+    eeprom.flushAll = 1;
+}
+
+// 1 when no transfer is in flight and the EEPROM holds everything written
+Uint16 EepromIdle(void)
+{
+    Uint16 i;
+
+    if(eeprom.op != EEPROM_OP_IDLE)
+    {
+        return 0;
+    }
+    for(i = 0; i < EEPROM_CACHE_LINES; i++)
+    {
+        if(eeprom.lines[i].dirty != 0)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+// Main loop only: finish the transfer in flight, then start a page read for a waiting reader or a page write
+void EepromService(void)
+{
+    EepromLine *line;
+    EepromLine *oldest = 0;
+    Uint16 status;
+    Uint16 i;
+    Uint16 pressure;
+
+    if(eeprom.op != EEPROM_OP_IDLE)
+    {
+        status = eeprom.transfer.status;
+        if(status == I2C_STATUS_QUEUED || status == I2C_STATUS_ACTIVE)
+        {
+            return;
+        }
+        if(status == I2C_STATUS_NACK)
+        {
+            eeprom.busBytes++; // Device address only
+            if(++eeprom.polls < EEPROM_POLL_LIMIT)
+            {
+                eeprom.ackPolls++; // Write cycle still running: the retry is the acknowledge poll
+                I2cSubmit(&eeprom.transfer);
+                return;
+            }
+        }
+        if(status == I2C_STATUS_DONE)
+        {
+            eeprom.busBytes += 1 + eeprom.transfer.txLength + (eeprom.transfer.rxLength ? 1 + eeprom.transfer.rxLength : 0);
+            EepromComplete();
+        }
+        else
+        {
+            eeprom.errors++; // Dirty bytes stay dirty and are written again later
+        }
+        if(eeprom.op == EEPROM_OP_FILL && eeprom.fillPage == eeprom.opLine->page)
+        {
+            eeprom.fillPage = EEPROM_NO_PAGE; // The reader retries, and asks again if the read failed
+        }
+        eeprom.op = EEPROM_OP_IDLE;
+        eeprom.opLine = 0;
+    }
+
+    if(eeprom.fillPage != EEPROM_NO_PAGE)
+    {
+        line = EepromLookup(eeprom.fillPage);
+        if(line == 0)
+        {
+            line = EepromAllocate(eeprom.fillPage);
+        }
+        if(line != 0)
+        {
+            EepromStartFill(line);
+            return;
+        }
+    }
+
+    // Write back the page that has waited longest, once it is full, old enough, or its line is needed
+    pressure = eeprom.flushAll || eeprom.starved || eeprom.fillPage != EEPROM_NO_PAGE;
+    for(i = 0; i < EEPROM_CACHE_LINES; i++)
+    {
+        line = &eeprom.lines[i];
+        if(line->dirty != 0
+           && (pressure || line->dirty == EEPROM_FULL_PAGE || (Uint32)(eeprom.ticks - line->lastWrite) >= EEPROM_COMBINE_TICKS)
+           && (oldest == 0 || (Uint32)(line->lastWrite - oldest->lastWrite) > 0x80000000UL))
+        {
+            oldest = line;
+        }
+    }
+    if(oldest != 0)
+    {
+        EepromStartWrite(oldest);
+    }
+    else if(EepromIdle())
+    {
+        eeprom.flushAll = 0;
+        eeprom.starved = 0;
+    }
+}
+
+// Call at a fixed rate (1 ms in main.c)
+void EepromTick(void)
+{
+    eeprom.ticks++;
+}
@@ -0,0 +1,84 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Page-aware driver for 24Cxx I2C EEPROMs with a RAM write-back cache, for the I2C_EEPROM example. EepromWrite only
+ * updates the cache; EepromService, called from the main loop, later writes each page's changed bytes in a single page
+ * write, so many small writes cost one write cycle. Reads are served from the cache when every byte is known, otherwise
+ * the whole page is read into the cache once.
+ *
+ * Transfers go through I2cSubmit of the I2C_Master engine (i2c_master.c). After a page write the EEPROM does not
+ * acknowledge its address until the write cycle ends, so instead of a fixed delay every transfer is simply resubmitted
+ * after a NACK (acknowledge polling). host/eeprom_sim.c runs the driver against a simulated 24C32.
+ */
+
+#ifndef EEPROM_H
+#define EEPROM_H
+
+#include "i2c_master.h"
+
+// 24C32: 4 KB, 32-byte pages, 2 address bytes. For a 24C02 use 256, 8 and 1.
+#define EEPROM_SIZE           4096
+#define EEPROM_PAGE_SIZE      32    // Bytes per page write (at most 32)
+#define EEPROM_ADDRESS_BYTES  2     // Memory address bytes after the device address
+
+#define EEPROM_CACHE_LINES    4     // Cached pages, one page of RAM each
+#define EEPROM_COMBINE_TICKS  20    // EepromTick calls (ms in main.c) a dirty page waits for more writes
+#define EEPROM_POLL_LIMIT     400   // NACKed attempts of one transfer before it is given up (> 5 ms at 400 kHz)
+
+#if EEPROM_PAGE_SIZE > 32
+#error "EEPROM_PAGE_SIZE must fit the 32-bit byte masks"
+#endif
+
+typedef struct
+{
+    Uint16 page;                        // Page number, EEPROM_NO_PAGE when unused
+    Uint32 valid;                       // Bytes of data known to match (or replace) the EEPROM, bit n = byte n
+    Uint32 dirty;                       // Bytes written by the application and not yet by the EEPROM
+    Uint32 lastUse;                     // eeprom.uses at the last access, for least recently used replacement
+    Uint32 lastWrite;                   // eeprom.ticks at the last EepromWrite
+    Uint16 data[EEPROM_PAGE_SIZE];      // One byte per word
+} EepromLine;
+
+typedef struct
+{
+    EepromLine lines[EEPROM_CACHE_LINES];
+    I2cTransaction transfer;            // The one transfer in flight
+    Uint16 header[EEPROM_ADDRESS_BYTES + EEPROM_PAGE_SIZE]; // Memory address followed by page write data
+    Uint16 buffer[EEPROM_PAGE_SIZE];    // Page read data
+    Uint16 device;                      // 7-bit device address
+    Uint16 op;                          // EEPROM_OP_* in eeprom.c
+    EepromLine *opLine;                 // Line being written or filled
+    Uint32 opMask;                      // Bytes of opLine being written
+    Uint32 rewritten;                   // Bytes of opLine written again while the page write was in flight
+    Uint16 polls;                       // NACKs of the current transfer
+    Uint16 fillPage;                    // Page a reader is waiting for, EEPROM_NO_PAGE for none
+    Uint16 flushAll;                    // EepromFlush requested
+    Uint16 starved;                     // EepromWrite found no clean line
+    volatile Uint32 ticks;              // EepromTick calls
+    Uint32 uses;                        // Cache accesses
+    Uint32 bytesWritten;                // Bytes passed to EepromWrite
+    Uint32 pageWrites;                  // Page writes completed (EEPROM write cycles)
+    Uint32 busBytes;                    // Bytes on the bus, device address bytes and NACKed attempts included
+    Uint32 readHits;                    // EepromRead calls served from the cache
+    Uint32 readMisses;                  // Page reads started for EepromRead
+    Uint32 ackPolls;                    // Transfers resubmitted after a NACK
+    Uint32 errors;                      // Transfers given up after EEPROM_POLL_LIMIT NACKs or another error
+} Eeprom;
+
+#define EEPROM_NO_PAGE  0xFFFF
+
+extern Eeprom eeprom;
+
+void EepromInit(Uint16 device);
+Uint16 EepromWrite(Uint16 address, const Uint16 *data, Uint16 length);
+Uint16 EepromRead(Uint16 address, Uint16 *data, Uint16 length);
+void EepromFlush(void);
+Uint16 EepromIdle(void);
+void EepromService(void);
+void EepromTick(void);
+
+#endif // EEPROM_H
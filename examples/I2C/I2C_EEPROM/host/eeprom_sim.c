@@ -0,0 +1,361 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.1
+ *
+ * Description:
+ * Runs the EEPROM driver (eeprom.c) on a Linux host against a simulated 24C32 on a 400 kHz bus. I2cSubmit is
+ * replaced by a transaction-level model: a transfer takes its bytes times 22.5 us, a page write wraps within its
+ * page and starts a 5 ms write cycle, and the device NACKs its address until the cycle ends. The main loop
+ * (EepromService) runs every 10 us of simulated time and EepromTick every millisecond.
+ *
+ * The scenarios check that the EEPROM ends up equal to a reference copy after sequential logging, random writes and
+ * reads, partial pages, rewrites during a page write and a device that stops answering, that the boot counter read of main.c ends when
+ * the device does not answer, and print the page writes
+ * and bus bytes saved against writing every record directly. The exit status is 1 if any check fails.
+ *
+ * Build: gcc -O2 -I.. -I../../I2C_Master -o eeprom_sim eeprom_sim.c ../eeprom.c
+ */
+
+#include "eeprom.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SIM_ADDRESS       0x50
+#define SIM_BYTE_TIME     225UL    // 9 SCL clocks at 400 kHz, in 100 ns units
+#define SIM_WRITE_CYCLE   50000UL  // tWR 5 ms, in 100 ns units
+#define SIM_STEP          100UL    // Main loop period, 10 us
+#define SIM_TICK          10000UL  // EepromTick period, 1 ms
+#define SIM_PAGES         (EEPROM_SIZE / EEPROM_PAGE_SIZE)
+
+typedef struct
+{
+    Uint16 mem[EEPROM_SIZE];
+    Uint32 wear[SIM_PAGES];     // Write cycles per page
+    Uint32 now;                 // 100 ns units
+    Uint32 busFree;             // End of the transfer on the bus
+    Uint32 busyUntil;           // End of the write cycle
+    Uint32 nextTick;
+    I2cTransaction *pending;
+    Uint16 result;              // Status of pending at busFree
+    Uint16 dead;                // NACK everything
+    Uint32 writeCycles;
+} EepromSim;
+
+static EepromSim sim;
+static Uint16 ref[EEPROM_SIZE];
+static int failures;
+
+// Transaction-level I2C master for eeprom.c: one transfer at a time, like the driver uses it
+Uint16 I2cSubmit(I2cTransaction *t)
+{
+    Uint16 pointer;
+    Uint16 page = 0;
+    Uint16 i;
+    Uint32 bytes;
+
+    if(sim.pending != 0)
+    {
+        return 0;
+    }
+    sim.pending = t;
+    t->status = I2C_STATUS_ACTIVE;
+    if(sim.dead || t->address != SIM_ADDRESS || sim.now < sim.busyUntil)
+    {
+        sim.result = I2C_STATUS_NACK;
+        sim.busFree = sim.now + SIM_BYTE_TIME;
+        return 1;
+    }
+
+#if EEPROM_ADDRESS_BYTES == 2
+    pointer = ((t->tx[0] << 8) | t->tx[1]) % EEPROM_SIZE;
+#else
+    pointer = t->tx[0] % EEPROM_SIZE;
+#endif
+    if(t->txLength > EEPROM_ADDRESS_BYTES)
+    {
+        page = pointer / EEPROM_PAGE_SIZE;
+        for(i = EEPROM_ADDRESS_BYTES; i < t->txLength; i++)
+        {
+            sim.mem[pointer] = t->tx[i] & 0xFF;
+            pointer = page * EEPROM_PAGE_SIZE + (pointer + 1) % EEPROM_PAGE_SIZE; // Page writes wrap in the page
+        }
+    }
+    for(i = 0; i < t->rxLength; i++)
+    {
+        t->rx[i] = sim.mem[pointer];
+        pointer = (pointer + 1) % EEPROM_SIZE; // Sequential reads cross pages
+    }
+
+    bytes = 1 + t->txLength + (t->rxLength ? 1 + t->rxLength : 0);
+    sim.busFree = sim.now + bytes * SIM_BYTE_TIME;
+    if(t->txLength > EEPROM_ADDRESS_BYTES && t->rxLength == 0)
+    {
+        sim.busyUntil = sim.busFree + SIM_WRITE_CYCLE; // Write cycle starts at the stop condition
+        sim.wear[page]++;
+        sim.writeCycles++;
+    }
+    sim.result = I2C_STATUS_DONE;
+    return 1;
+}
+
+// Advance simulated time, completing the transfer and ticking the driver on the way
+static void SimStep(void)
+{
+    sim.now += SIM_STEP;
+    if(sim.pending != 0 && sim.now >= sim.busFree)
+    {
+        sim.pending->status = sim.result;
+        sim.pending = 0;
+    }
+    if(sim.now >= sim.nextTick)
+    {
+        sim.nextTick += SIM_TICK;
+        EepromTick();
+    }
+    EepromService();
+}
+
+static void SimRunFor(Uint32 us)
+{
+    Uint32 end = sim.now + us * 10;
+
+    while(sim.now < end)
+    {
+        SimStep();
+    }
+}
+
+static void SimFlush(void)
+{
+    Uint32 guard = 0;
+
+    EepromFlush();
+    while(!EepromIdle() && guard++ < 1000000UL)
+    {
+        SimStep();
+    }
+}
+
+static void SimWrite(Uint16 address, const Uint16 *data, Uint16 length)
+{
+    Uint16 done = 0;
+
+    while(done < length)
+    {
+        done += EepromWrite(address + done, data + done, length - done);
+        if(done < length)
+        {
+            SimStep(); // Cache full: let the driver write a page back
+        }
+    }
+    memcpy(&ref[address], data, length * sizeof(Uint16));
+}
+
+static int SimRead(Uint16 address, Uint16 *data, Uint16 length)
+{
+    Uint32 guard = 0;
+
+    while(!EepromRead(address, data, length))
+    {
+        SimStep();
+        if(guard++ > 1000000UL)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int SimMatches(void)
+{
+    return memcmp(sim.mem, ref, sizeof(ref)) == 0;
+}
+
+static void Check(const char *name, int ok)
+{
+    printf("  %-52s %s\n", name, ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        failures++;
+    }
+}
+
+static void Reset(void)
+{
+    Uint16 i;
+
+    memset(&sim, 0, sizeof(sim));
+    for(i = 0; i < EEPROM_SIZE; i++)
+    {
+        sim.mem[i] = (i * 13 + 7) & 0xFF; // Old contents
+    }
+    memcpy(ref, sim.mem, sizeof(ref));
+    sim.nextTick = SIM_TICK;
+    memset(&eeprom, 0, sizeof(eeprom));
+    EepromInit(SIM_ADDRESS);
+}
+
+int main(void)
+{
+    Uint16 record[8];
+    Uint16 data[64];
+    Uint16 i, n, address, ok;
+    Uint32 busBytes, maxWear, errors;
+    Uint32 records = 1000;
+
+    printf("24C32, %u-byte pages, %u cache lines, 400 kHz\n", EEPROM_PAGE_SIZE, EEPROM_CACHE_LINES);
+
+    // Parameter log: one 4-byte record per millisecond
+    Reset();
+    for(i = 0; i < records; i++)
+    {
+        record[0] = i & 0xFF;
+        record[1] = i >> 8;
+        record[2] = (i * 3) & 0xFF;
+        record[3] = 0xA5;
+        SimWrite(i * 4, record, 4);
+        SimRunFor(1000);
+    }
+    SimFlush();
+    for(maxWear = 0, i = 0; i < SIM_PAGES; i++)
+    {
+        maxWear = (sim.wear[i] > maxWear) ? sim.wear[i] : maxWear;
+    }
+    Check("log of 1000 records matches", SimMatches());
+    Check("one write cycle per page", sim.writeCycles == records * 4 / EEPROM_PAGE_SIZE && maxWear == 1);
+    printf("  write cycles %lu (direct: %lu), bus bytes %lu (direct: %lu + polls)\n",
+           (unsigned long)sim.writeCycles, (unsigned long)records, (unsigned long)eeprom.busBytes,
+           (unsigned long)(records * (1 + EEPROM_ADDRESS_BYTES + 4)));
+
+    // Reads of cached data cost no bus time
+    busBytes = eeprom.busBytes;
+    ok = SimRead((records - 1) * 4, data, 4);
+    Check("read of recently written data served from the cache", ok && data[3] == 0xA5 && eeprom.busBytes == busBytes);
+
+    // A read miss fetches the page once, later reads of it hit
+    ok = SimRead(0x800, data, 16);
+    busBytes = eeprom.busBytes;
+    ok &= SimRead(0x808, data + 16, 8);
+    Check("page read once, then hits", ok && memcmp(data, &ref[0x800], 16 * sizeof(Uint16)) == 0
+          && memcmp(data + 16, &ref[0x808], 8 * sizeof(Uint16)) == 0 && eeprom.busBytes == busBytes);
+
+    // Four full pages at once: each page write waits for the previous write cycle by acknowledge polling
+    Reset();
+    for(i = 0; i < 4 * EEPROM_PAGE_SIZE; i++)
+    {
+        data[i % EEPROM_PAGE_SIZE] = i & 0xFF;
+        if(i % EEPROM_PAGE_SIZE == EEPROM_PAGE_SIZE - 1)
+        {
+            SimWrite(0x600 + i + 1 - EEPROM_PAGE_SIZE, data, EEPROM_PAGE_SIZE);
+        }
+    }
+    busBytes = sim.now;
+    SimFlush();
+    busBytes = (sim.now - busBytes) / 10; // us
+    Check("back-to-back page writes by acknowledge polling", SimMatches() && eeprom.ackPolls > 0 && eeprom.errors == 0
+          && busBytes < 4 * (SIM_WRITE_CYCLE / 10 + 1000));
+    printf("  4 pages written in %lu us, %lu acknowledge polls\n", (unsigned long)busBytes, (unsigned long)eeprom.ackPolls);
+
+    // Bytes 0 and 5 of an uncached page: bytes 1-4 are unknown and must not be written
+    Reset();
+    data[0] = 0x11;
+    SimWrite(0x400, data, 1);
+    data[0] = 0x55;
+    SimWrite(0x405, data, 1);
+    SimFlush();
+    Check("partial page keeps the unknown bytes between", SimMatches() && sim.writeCycles == 2);
+
+    // Same two bytes after the page has been read: one write bridges the known gap
+    Reset();
+    SimRead(0x400, data, 1);
+    data[0] = 0x11;
+    SimWrite(0x400, data, 1);
+    data[0] = 0x55;
+    SimWrite(0x405, data, 1);
+    SimFlush();
+    Check("known gap bridged in one page write", SimMatches() && sim.writeCycles == 1);
+
+    // Rewrite a byte while its page write is in flight
+    Reset();
+    data[0] = 1;
+    SimWrite(0x200, data, 1);
+    EepromFlush();
+    while(sim.pending == 0)
+    {
+        SimStep();
+    }
+    data[0] = 2;
+    SimWrite(0x200, data, 1);
+    SimFlush();
+    Check("rewrite during a page write is written again", SimMatches() && sim.writeCycles == 2);
+
+    // Random writes and reads over a small area: cache replacement, fills and write-backs interleave
+    Reset();
+    srand(7);
+    for(ok = 1, n = 0; n < 20000; n++)
+    {
+        address = rand() % 512;
+        i = 1 + rand() % 40;
+        if(address + i > 512)
+        {
+            i = 512 - address;
+        }
+        if(rand() % 2)
+        {
+            for(busBytes = 0; busBytes < i; busBytes++)
+            {
+                data[busBytes] = rand() & 0xFF;
+            }
+            SimWrite(address, data, i);
+        }
+        else
+        {
+            ok &= SimRead(address, data, i) && memcmp(data, &ref[address], i * sizeof(Uint16)) == 0;
+        }
+        SimRunFor(rand() % 200);
+    }
+    Check("random reads return the latest writes", ok);
+    SimFlush();
+    Check("random writes reach the EEPROM", SimMatches() && eeprom.errors == 0);
+    printf("  %lu bytes written in %lu write cycles, %lu read hits, %lu page reads\n", (unsigned long)eeprom.bytesWritten,
+           (unsigned long)sim.writeCycles, (unsigned long)eeprom.readHits, (unsigned long)eeprom.readMisses);
+
+    // Device stops answering: transfers are given up, the data is kept and written once it is back
+    Reset();
+    sim.dead = 1;
+    for(i = 0; i < 8; i++)
+    {
+        data[i] = 0xC0 + i;
+    }
+    SimWrite(0x300, data, 8);
+    EepromFlush();
+    SimRunFor(50000);
+    Check("no answer: write given up, still dirty", eeprom.errors > 0 && !EepromIdle());
+    sim.dead = 0;
+    SimFlush();
+    Check("device back: data written", SimMatches());
+
+    // Boot counter read of main.c with no device: the page read is given up and counted, so the loop ends
+    Reset();
+    sim.dead = 1;
+    errors = eeprom.errors;
+    for(n = 0; n < 60000 && !EepromRead(0, data, 2); n++)
+    {
+        SimStep();
+        if(eeprom.errors != errors)
+        {
+            break;
+        }
+    }
+    Check("no answer: boot read ends with an error", eeprom.errors != errors && eeprom.fillPage == EEPROM_NO_PAGE);
+    printf("  boot read given up after %.1f ms\n", sim.now / 10000.0);
+    sim.dead = 0;
+    Check("device back: read succeeds", SimRead(0, data, 2) && data[0] == ref[0] && data[1] == ref[1]);
+
+    printf("%s\n", failures ? "FAILED" : "All checks passed");
+    return failures != 0;
+}
@@ -0,0 +1,290 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.1
+ *
+ * Description:
+ * This code demonstrates how to store data in a 24Cxx I2C EEPROM (24C32 at address 0x50) on the Texas Instruments C2000
+ * Piccolo LaunchPad Evaluation Kit (LAUNCHHXL-F28027F). The I2C is configured to communicate at 400 kHz (fast mode).
+ *
+ * A boot counter is read and incremented at startup, then a 4-byte parameter record is logged every 10 ms. The records
+ * go through the write-back cache in eeprom.c, which collects them into page writes (8 records per 32-byte page) and
+ * waits for each EEPROM write cycle by acknowledge polling instead of a fixed delay. Transfers run on the interrupt-driven
+ * engine of the I2C_Master example: add eeprom.c and eeprom.h from this folder and i2c_master.c and i2c_master.h from
+ * ../I2C_Master to the project.
+ *
+ * This example is intended to help users get started with I2C EEPROM storage on the F28027F microcontroller.
+ */
+
+#include "F2802x_Device.h"
+#include "f2802x_examples.h"
+#include "i2c_master.h"
+#include "eeprom.h"
+
+#define EEPROM_DEVICE     0x50      // 24C32 with A2-A0 tied low
+#define I2C_BUS_HZ        400000UL  // SCL frequency, 100000 or 400000
+#define SYSCLK_HZ         60000000UL
+
+#define BOOT_COUNT_ADDR   0x0000    // 2 bytes
+#define BOOT_COUNT_NONE   0         // bootCount if the EEPROM does not answer
+#define LOG_FIRST_ADDR    0x0020    // Log area: page 1 to the end of the EEPROM
+#define LOG_RECORD_BYTES  4
+#define LOG_PERIOD_TICKS  10        // ms between records
+
+// I2CMDR bits
+#define I2C_MDR_FREE 0x4000 // Keep running when the debugger halts
+#define I2C_MDR_STT  0x2000 // Start condition
+#define I2C_MDR_STP  0x0800 // Stop condition after I2CCNT bytes
+#define I2C_MDR_MST  0x0400 // Master mode
+#define I2C_MDR_TRX  0x0200 // Transmitter
+#define I2C_MDR_IRS  0x0020 // Module enabled
+
+__interrupt void i2c_isr(void);
+__interrupt void i2c_fifo_isr(void);
+__interrupt void cpu_timer0_isr(void);
+
+I2cTiming i2cTiming;
+
+Uint16 bootCount;
+Uint16 bootReadFailed;           // The boot counter could not be read, bootCount is BOOT_COUNT_NONE
+Uint16 logAddress = LOG_FIRST_ADDR;
+Uint16 logRecord[LOG_RECORD_BYTES];
+volatile Uint32 logRecords;      // Records accepted by the cache
+volatile Uint32 logDropped;      // Records that found the cache full
+volatile Uint32 mainLoopCount;   // Main loop passes, shows the CPU is free during EEPROM writes
+
+void InitGpio()
+{
+    EALLOW;
+    GpioCtrlRegs.GPBPUD.bit.GPIO32 = 0;   // Enable pull-up on GPIO32 (SDAA)
+    GpioCtrlRegs.GPBPUD.bit.GPIO33 = 0;   // Enable pull-up on GPIO33 (SCLA)
+    GpioCtrlRegs.GPBQSEL1.bit.GPIO32 = 3; // Asynchronous input GPIO32 (SDAA)
+    GpioCtrlRegs.GPBQSEL1.bit.GPIO33 = 3; // Asynchronous input GPIO33 (SCLA)
+    GpioCtrlRegs.GPBMUX1.bit.GPIO32 = 1;  // Configure GPIO32 as SDAA
+    GpioCtrlRegs.GPBMUX1.bit.GPIO33 = 1;  // Configure GPIO33 as SCLA
+    EDIS;
+}
+
+void InitI2C()
+{
+    I2cTimingFor(SYSCLK_HZ, I2C_BUS_HZ, &i2cTiming);
+
+    I2caRegs.I2CMDR.all = 0x0000;  // Hold I2C in reset
+    I2caRegs.I2CSAR = EEPROM_DEVICE; // Set the slave address
+    I2caRegs.I2CPSC.all = i2cTiming.psc; // Prescaler - 10 MHz module clock from 60 MHz SYSCLKOUT
+    I2caRegs.I2CCLKL = i2cTiming.clkl;   // NOTE: must be non zero
+    I2caRegs.I2CCLKH = i2cTiming.clkh;   // NOTE: must be non zero
+    I2caRegs.I2CIER.all = 0x27; // Enable SCD, ARDY, NACK & AL interrupts
+
+    I2caRegs.I2CFFTX.all = 0x6041; // Enable FIFO mode and TX FIFO, TX interrupt level 1 (disabled until I2cSubmit)
+    I2caRegs.I2CFFRX.all = 0x2061; // Enable RX FIFO and its interrupt, level set per transfer
+
+    I2caRegs.I2CMDR.all = I2C_MDR_FREE | I2C_MDR_IRS; // Take I2C out of reset
+}
+
+void InitTimer()
+{
+    InitCpuTimers();
+    ConfigCpuTimer(&CpuTimer0, 60, 1000); // Configure CPU-Timer 0 to interrupt every 1 ms
+
+    EALLOW;
+    PieVectTable.TINT0 = &cpu_timer0_isr; // Map ISR to the PIE vector table
+    EDIS;
+
+    IER |= M_INT1; // Enable CPU INT1
+    PieCtrlRegs.PIEIER1.bit.INTx7 = 1; // Enable PIE Group 1 interrupt 7 (TINT0)
+
+    CpuTimer0Regs.TCR.all = 0x4000; // Start CPU-Timer 0
+}
+
+// Hardware access for i2c_master.c
+void I2cHwSetup(Uint16 address, Uint16 count)
+{
+    I2caRegs.I2CSAR = address;
+    I2caRegs.I2CCNT = count;
+}
+
+void I2cHwStart(Uint16 transmit, Uint16 stop)
+{
+    I2caRegs.I2CMDR.all = I2C_MDR_FREE | I2C_MDR_IRS | I2C_MDR_MST | I2C_MDR_STT
+                        | (transmit ? I2C_MDR_TRX : 0) | (stop ? I2C_MDR_STP : 0);
+}
+
+void I2cHwStop(void)
+{
+    I2caRegs.I2CMDR.bit.STP = 1;
+}
+
+Uint16 I2cHwTxSpace(void)
+{
+    return I2C_FIFO_DEPTH - I2caRegs.I2CFFTX.bit.TXFFST;
+}
+
+void I2cHwWrite(Uint16 data)
+{
+    I2caRegs.I2CDXR = data;
+}
+
+Uint16 I2cHwRxCount(void)
+{
+    return I2caRegs.I2CFFRX.bit.RXFFST;
+}
+
+Uint16 I2cHwRead(void)
+{
+    return I2caRegs.I2CDRR;
+}
+
+void I2cHwRxLevel(Uint16 level)
+{
+    I2caRegs.I2CFFRX.bit.RXFFIL = level;
+}
+
+void I2cHwTxInterrupt(Uint16 enable)
+{
+    I2caRegs.I2CFFTX.bit.TXFFIENA = enable;
+}
+
+void I2cHwFlush(void)
+{
+    I2caRegs.I2CFFTX.bit.TXFFRST = 0; // Reset TX FIFO
+    I2caRegs.I2CFFRX.bit.RXFFRST = 0; // Reset RX FIFO
+    I2caRegs.I2CFFTX.bit.TXFFRST = 1;
+    I2caRegs.I2CFFRX.bit.RXFFRST = 1;
+}
+
+void I2cHwReset(void)
+{
+    InitI2C(); // Resets the module, which also releases SCL and SDA
+}
+
+void main(void)
+{
+    Uint16 value[2];
+    Uint32 bootErrors;
+    Uint32 nextLog;
+
+    InitSysCtrl(); // Initialize the CPU and configure the clock
+    DINT;          // Disable CPU interrupts
+
+    InitGpio();    // Initialize the GPIO
+    InitI2C();     // Initialize the I2C
+    I2cMasterInit();
+    EepromInit(EEPROM_DEVICE);
+
+    InitPieCtrl(); // Initialize the PIE control registers
+    InitPieVectTable(); // Initialize the PIE vector table
+
+    EALLOW;
+    PieVectTable.I2CINT1A = &i2c_isr;      // Map I2C ISR to the PIE vector table
+    PieVectTable.I2CINT2A = &i2c_fifo_isr; // Map I2C FIFO ISR to the PIE vector table
+    EDIS;
+
+    IER |= M_INT8; // Enable CPU INT8
+    PieCtrlRegs.PIEIER8.bit.INTx1 = 1; // Enable PIE Group 8 interrupt 1 (I2CINT1A)
+    PieCtrlRegs.PIEIER8.bit.INTx2 = 1; // Enable PIE Group 8 interrupt 2 (I2CINT2A)
+
+    InitTimer();   // 1 ms tick for I2C timeouts and EEPROM write combining
+
+    EINT;  // Enable Global interrupt INTM
+    ERTM;  // Enable Global realtime interrupt DBGM
+
+    // Boot counter: the first read fetches page 0 into the cache. EepromService counts a page read it gives up on
+    // (no EEPROM, or NACKs beyond EEPROM_POLL_LIMIT) in eeprom.errors, so stop there instead of retrying forever.
+    bootErrors = eeprom.errors;
+    while(!EepromRead(BOOT_COUNT_ADDR, value, 2))
+    {
+        EepromService();
+        if(eeprom.errors != bootErrors)
+        {
+            bootReadFailed = 1;
+            break;
+        }
+    }
+    if(bootReadFailed)
+    {
+        bootCount = BOOT_COUNT_NONE; // Leave the stored counter alone, it may only have been unreadable this time
+    }
+    else
+    {
+        bootCount = (value[0] | (value[1] << 8)) + 1;
+        value[0] = bootCount & 0xFF;
+        value[1] = bootCount >> 8;
+        EepromWrite(BOOT_COUNT_ADDR, value, 2); // The page is cached, so this always fits
+        EepromFlush();
+    }
+
+    nextLog = eeprom.ticks;
+    while(1)
+    {
+        if((int32)(eeprom.ticks - nextLog) >= 0)
+        {
+            nextLog += LOG_PERIOD_TICKS;
+            logRecord[0] = logRecords & 0xFF;
+            logRecord[1] = (logRecords >> 8) & 0xFF;
+            logRecord[2] = bootCount & 0xFF;
+            logRecord[3] = mainLoopCount & 0xFF;
+            if(EepromWrite(logAddress, logRecord, LOG_RECORD_BYTES) == LOG_RECORD_BYTES)
+            {
+                logRecords++;
+                logAddress += LOG_RECORD_BYTES;
+                if(logAddress > EEPROM_SIZE - LOG_RECORD_BYTES)
+                {
+                    logAddress = LOG_FIRST_ADDR; // Wrap around the log area
+                }
+            }
+            else
+            {
+                logDropped++; // A partly accepted record is overwritten by the next one
+            }
+        }
+
+        EepromService(); // Starts page writes and reads, never waits
+
+        mainLoopCount++; // Other work runs here
+    }
+}
+
+// Basic I2C interrupts: arbitration lost, NACK, register access ready and stop condition
+__interrupt void i2c_isr(void)
+{
+    Uint16 code;
+
+    while((code = I2caRegs.I2CISRC.bit.INTCODE) != 0) // Highest priority pending interrupt
+    {
+        if(code <= 6)
+        {
+            I2caRegs.I2CSTR.all = 1 << (code - 1); // Clear the flag (AL, NACK, ARDY, RRDY, XRDY, SCD are bits 0-5)
+        }
+        I2cService(code); // I2C_EVENT_* codes match INTCODE
+    }
+
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP8; // Acknowledge interrupt
+}
+
+// I2C FIFO interrupts
+__interrupt void i2c_fifo_isr(void)
+{
+    if(I2caRegs.I2CFFRX.bit.RXFFINT)
+    {
+        I2cService(I2C_EVENT_RX_FIFO);
+        I2caRegs.I2CFFRX.bit.RXFFINTCLR = 1; // Clear RX FIFO interrupt flag
+    }
+    if(I2caRegs.I2CFFTX.bit.TXFFINT && I2caRegs.I2CFFTX.bit.TXFFIENA)
+    {
+        I2cService(I2C_EVENT_TX_FIFO);
+        I2caRegs.I2CFFTX.bit.TXFFINTCLR = 1; // Clear TX FIFO interrupt flag
+    }
+
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP8; // Acknowledge interrupt
+}
+
+__interrupt void cpu_timer0_isr(void)
+{
+    I2cTick(); // Interrupts do not nest, so this never runs in the middle of an I2C interrupt
+    EepromTick();
+
+    CpuTimer0Regs.TCR.bit.TIF = 1; // Clear Timer interrupt flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP1; // Acknowledge interrupt
+}
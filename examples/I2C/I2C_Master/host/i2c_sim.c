@@ -0,0 +1,429 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Runs the I2C_Master transaction engine (i2c_master.c) on a Linux host against a simulated I2C-A controller and a
+ * simulated slave with a 256-byte register file (first byte written sets the register pointer). The bus advances
+ * one byte (9 SCL clocks) at a time; FIFO and status interrupts are delivered through I2cService as the ISRs in
+ * main.c would, and I2cTick runs every millisecond of simulated time.
+ *
+ * Every scenario (writes, repeated-start reads, FIFO refills, address and data NACK, arbitration loss, a slave that
+ * holds SCL low, a full queue) is run at 100 kHz and 400 kHz. The exit status is 1 if any check fails.
+ *
+ * Build: gcc -O2 -I.. -o i2c_sim i2c_sim.c ../i2c_master.c
+ */
+
+#include "i2c_master.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#define SYSCLK_HZ     60000000UL
+#define SIM_NONE      0xFFFF
+#define SIM_MAX_STEPS 1000000UL
+
+typedef struct
+{
+    // Controller
+    Uint16 address;
+    Uint16 count;          // I2CCNT
+    Uint16 transmit;       // TRX
+    Uint16 stop;           // STP
+    Uint16 active;         // Master owns the bus
+    Uint16 addressPhase;   // Next byte on the bus is the address
+    Uint16 nacked;         // Waiting for I2cHwStop after a NACK
+    Uint16 readyPosted;    // ARDY already raised for this phase
+    Uint16 txFifo[I2C_FIFO_DEPTH];
+    Uint16 txCount;
+    Uint16 rxFifo[I2C_FIFO_DEPTH];
+    Uint16 rxCount;
+    Uint16 rxLevel;
+    Uint16 txInterrupt;
+    Uint16 pending[4];     // Basic interrupts waiting for i2c_isr
+    Uint16 pendingCount;
+    Uint32 repeatedStarts;
+    Uint32 fifoErrors;     // Writes to a full TX FIFO or reads of an empty RX FIFO
+
+    // Slave
+    Uint16 slaveAddress;
+    Uint16 regs[256];
+    Uint16 pointer;
+    Uint16 firstByte;      // Next written byte sets the register pointer
+    Uint16 dataIndex;      // Data bytes received in this write
+    Uint16 nackAt;         // NACK this data byte index, SIM_NONE for never
+    Uint16 arbitrationAt;  // Lose arbitration on this address byte, SIM_NONE for never
+    Uint16 addressCount;
+    Uint32 stuckSteps;     // Byte times the slave holds SCL low
+} I2cSim;
+
+static I2cSim sim;
+static Uint16 bytesPerTick;
+static int failures;
+
+static void SimPost(Uint16 event)
+{
+    sim.pending[sim.pendingCount++] = event;
+}
+
+// Hardware access for i2c_master.c
+void I2cHwSetup(Uint16 address, Uint16 count)
+{
+    sim.address = address;
+    sim.count = count;
+}
+
+void I2cHwStart(Uint16 transmit, Uint16 stop)
+{
+    if(sim.active)
+    {
+        sim.repeatedStarts++;
+    }
+    sim.transmit = transmit;
+    sim.stop = stop;
+    sim.active = 1;
+    sim.addressPhase = 1;
+    sim.nacked = 0;
+    sim.readyPosted = 0;
+}
+
+void I2cHwStop(void)
+{
+    sim.stop = 1;
+}
+
+Uint16 I2cHwTxSpace(void)
+{
+    return I2C_FIFO_DEPTH - sim.txCount;
+}
+
+void I2cHwWrite(Uint16 data)
+{
+    if(sim.txCount == I2C_FIFO_DEPTH)
+    {
+        sim.fifoErrors++;
+        return;
+    }
+    sim.txFifo[sim.txCount++] = data;
+}
+
+Uint16 I2cHwRxCount(void)
+{
+    return sim.rxCount;
+}
+
+Uint16 I2cHwRead(void)
+{
+    Uint16 data;
+
+    if(sim.rxCount == 0)
+    {
+        sim.fifoErrors++;
+        return 0;
+    }
+    data = sim.rxFifo[0];
+    memmove(&sim.rxFifo[0], &sim.rxFifo[1], (--sim.rxCount) * sizeof(sim.rxFifo[0]));
+    return data;
+}
+
+void I2cHwRxLevel(Uint16 level)
+{
+    sim.rxLevel = level;
+}
+
+void I2cHwTxInterrupt(Uint16 enable)
+{
+    sim.txInterrupt = enable;
+}
+
+void I2cHwFlush(void)
+{
+    sim.txCount = 0;
+    sim.rxCount = 0;
+}
+
+void I2cHwReset(void)
+{
+    sim.active = 0;
+    sim.txCount = 0;
+    sim.rxCount = 0;
+    sim.txInterrupt = 0;
+    sim.pendingCount = 0;
+}
+
+// One byte time on the bus
+static void SimBusStep(void)
+{
+    Uint16 data;
+
+    if(!sim.active)
+    {
+        return;
+    }
+    if(sim.stuckSteps != 0)
+    {
+        sim.stuckSteps--; // Slave holds SCL low, nothing moves
+        return;
+    }
+    if(sim.addressPhase)
+    {
+        sim.addressPhase = 0;
+        if(sim.addressCount++ == sim.arbitrationAt)
+        {
+            sim.active = 0; // Another master sent a lower address; the module drops to slave mode
+            sim.txCount = 0;
+            SimPost(I2C_EVENT_ARBITRATION);
+            return;
+        }
+        if(sim.address != sim.slaveAddress)
+        {
+            sim.nacked = 1;
+            SimPost(I2C_EVENT_NACK);
+            return;
+        }
+        if(sim.transmit)
+        {
+            sim.firstByte = 1;
+            sim.dataIndex = 0;
+        }
+        return;
+    }
+    if(sim.nacked)
+    {
+        if(sim.stop)
+        {
+            sim.active = 0;
+            SimPost(I2C_EVENT_STOP);
+        }
+        return;
+    }
+    if(sim.count == 0)
+    {
+        if(sim.stop)
+        {
+            sim.active = 0;
+            SimPost(I2C_EVENT_STOP);
+        }
+        else if(!sim.readyPosted)
+        {
+            sim.readyPosted = 1; // Master holds the bus, waiting for a repeated start
+            SimPost(I2C_EVENT_READY);
+        }
+        return;
+    }
+    if(sim.transmit)
+    {
+        if(sim.txCount == 0)
+        {
+            return; // Transmit underflow: the controller stretches SCL
+        }
+        data = sim.txFifo[0];
+        memmove(&sim.txFifo[0], &sim.txFifo[1], (--sim.txCount) * sizeof(sim.txFifo[0]));
+        if(sim.dataIndex++ == sim.nackAt)
+        {
+            sim.nacked = 1;
+            SimPost(I2C_EVENT_NACK);
+            return;
+        }
+        if(sim.firstByte)
+        {
+            sim.pointer = data & 0xFF;
+            sim.firstByte = 0;
+        }
+        else
+        {
+            sim.regs[sim.pointer] = data & 0xFF;
+            sim.pointer = (sim.pointer + 1) & 0xFF;
+        }
+    }
+    else
+    {
+        if(sim.rxCount == I2C_FIFO_DEPTH)
+        {
+            return; // Receive FIFO full: the controller stretches SCL
+        }
+        sim.rxFifo[sim.rxCount++] = sim.regs[sim.pointer];
+        sim.pointer = (sim.pointer + 1) & 0xFF;
+    }
+    sim.count--;
+}
+
+// Deliver pending interrupts the way i2c_isr and i2c_fifo_isr do
+static void SimInterrupts(void)
+{
+    Uint16 i;
+    Uint16 guard;
+
+    for(i = 0; i < sim.pendingCount; i++)
+    {
+        I2cService(sim.pending[i]);
+    }
+    sim.pendingCount = 0;
+    for(guard = 0; guard < 16; guard++)
+    {
+        if(sim.rxCount != 0 && sim.rxCount >= sim.rxLevel)
+        {
+            I2cService(I2C_EVENT_RX_FIFO);
+        }
+        else if(sim.txInterrupt && sim.txCount <= 1) // TXFFIL is 1 in main.c
+        {
+            I2cService(I2C_EVENT_TX_FIFO);
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+// Run until every transaction has finished; returns the simulated time in microseconds
+static Uint32 SimRun(Uint32 busHz)
+{
+    Uint32 steps = 0;
+
+    SimInterrupts(); // The TX FIFO interrupt enabled by I2cSubmit
+    while(i2cMaster.active != 0 && steps < SIM_MAX_STEPS)
+    {
+        SimBusStep();
+        SimInterrupts();
+        if(++steps % bytesPerTick == 0)
+        {
+            I2cTick();
+            SimInterrupts();
+        }
+    }
+    return (Uint32)((steps * 9ULL * 1000000ULL) / busHz);
+}
+
+static void Check(const char *name, int ok)
+{
+    printf("  %-44s %s\n", name, ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        failures++;
+    }
+}
+
+static void Prepare(I2cTransaction *t, Uint16 address, const Uint16 *tx, Uint16 txLength, Uint16 *rx, Uint16 rxLength)
+{
+    t->address = address;
+    t->tx = tx;
+    t->txLength = txLength;
+    t->rx = rx;
+    t->rxLength = rxLength;
+    t->done = 0;
+    t->status = I2C_STATUS_IDLE;
+}
+
+static void RunScenarios(Uint32 busHz)
+{
+    static const Uint16 writeData[21] = { 0x10, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20 };
+    static const Uint16 reg00[1] = { 0x00 };
+    I2cTransaction t[I2C_QUEUE_SIZE + 1];
+    Uint16 rx[I2C_QUEUE_SIZE][40];
+    I2cTiming timing;
+    Uint16 i, ok;
+    Uint32 us;
+
+    I2cTimingFor(SYSCLK_HZ, busHz, &timing);
+    printf("%lu kHz: I2CPSC %u, I2CCLKL %u, I2CCLKH %u, SCL %lu Hz\n", (unsigned long)(busHz / 1000),
+           timing.psc, timing.clkl, timing.clkh, (unsigned long)timing.busHz);
+    bytesPerTick = (Uint16)(timing.busHz / 9 / 1000); // Bytes per 1 ms tick
+
+    memset(&sim, 0, sizeof(sim));
+    sim.slaveAddress = 0x50;
+    sim.nackAt = SIM_NONE;
+    sim.arbitrationAt = SIM_NONE;
+    for(i = 0; i < 256; i++)
+    {
+        sim.regs[i] = (i * 7 + 3) & 0xFF;
+    }
+    memset(&i2cMaster, 0, sizeof(i2cMaster));
+    I2cMasterInit();
+
+    Prepare(&t[0], 0x50, writeData, 3, 0, 0);
+    I2cSubmit(&t[0]);
+    SimRun(busHz);
+    Check("3-byte write", t[0].status == I2C_STATUS_DONE && sim.regs[0x10] == 1 && sim.regs[0x11] == 2);
+
+    Prepare(&t[0], 0x50, reg00, 1, rx[0], 8);
+    I2cSubmit(&t[0]);
+    us = SimRun(busHz);
+    for(ok = 1, i = 0; i < 8; i++)
+    {
+        ok &= (rx[0][i] == sim.regs[i]);
+    }
+    Check("register read with repeated start", t[0].status == I2C_STATUS_DONE && ok && sim.repeatedStarts == 1);
+    printf("  8-register read takes %lu us\n", (unsigned long)us);
+
+    Prepare(&t[0], 0x50, writeData, 21, 0, 0);
+    Prepare(&t[1], 0x50, writeData, 1, rx[1], 40);
+    I2cSubmit(&t[0]);
+    I2cSubmit(&t[1]);
+    SimRun(busHz);
+    for(ok = 1, i = 0; i < 20; i++)
+    {
+        ok &= (rx[1][i] == i + 1);
+    }
+    Check("20-byte write and 40-byte read (FIFO refills)", t[0].status == I2C_STATUS_DONE && t[1].status == I2C_STATUS_DONE && ok);
+
+    Prepare(&t[0], 0x51, reg00, 1, rx[0], 4);
+    Prepare(&t[1], 0x50, reg00, 1, rx[1], 4);
+    I2cSubmit(&t[0]);
+    I2cSubmit(&t[1]);
+    SimRun(busHz);
+    Check("address NACK, next transaction unaffected", t[0].status == I2C_STATUS_NACK && t[1].status == I2C_STATUS_DONE);
+
+    sim.nackAt = 2;
+    Prepare(&t[0], 0x50, writeData, 6, 0, 0);
+    I2cSubmit(&t[0]);
+    SimRun(busHz);
+    sim.nackAt = SIM_NONE;
+    Check("data NACK on third byte", t[0].status == I2C_STATUS_NACK && sim.txCount == 0);
+
+    sim.arbitrationAt = sim.addressCount;
+    Prepare(&t[0], 0x50, reg00, 1, rx[0], 4);
+    Prepare(&t[1], 0x50, reg00, 1, rx[1], 4);
+    I2cSubmit(&t[0]);
+    I2cSubmit(&t[1]);
+    SimRun(busHz);
+    Check("arbitration loss, next transaction unaffected", t[0].status == I2C_STATUS_ARBITRATION && t[1].status == I2C_STATUS_DONE);
+
+    sim.stuckSteps = 100000;
+    Prepare(&t[0], 0x50, reg00, 1, rx[0], 4);
+    I2cSubmit(&t[0]);
+    us = SimRun(busHz);
+    sim.stuckSteps = 0;
+    Prepare(&t[1], 0x50, reg00, 1, rx[1], 4);
+    I2cSubmit(&t[1]);
+    SimRun(busHz);
+    Check("SCL held low: timeout, then recovery", t[0].status == I2C_STATUS_TIMEOUT && t[1].status == I2C_STATUS_DONE
+          && us >= (I2C_TIMEOUT_TICKS - 1) * 1000UL);
+
+    for(i = 0; i <= I2C_QUEUE_SIZE; i++)
+    {
+        Prepare(&t[i], 0x50, reg00, 1, rx[i % I2C_QUEUE_SIZE], 2);
+    }
+    for(ok = 1, i = 0; i <= I2C_QUEUE_SIZE; i++)
+    {
+        ok &= (I2cSubmit(&t[i]) == (i < I2C_QUEUE_SIZE)); // The engine is idle until the first interrupt, so only 8 fit
+    }
+    SimRun(busHz);
+    for(i = 0; i < I2C_QUEUE_SIZE; i++)
+    {
+        ok &= (t[i].status == I2C_STATUS_DONE);
+    }
+    Check("full queue: 8 run back to back, 9th rejected", ok && i2cMaster.rejected == 1);
+
+    Check("no TX FIFO overflow or RX FIFO underflow", sim.fifoErrors == 0);
+}
+
+int main(void)
+{
+    RunScenarios(100000);
+    RunScenarios(400000);
+    printf("%s\n", failures ? "FAILED" : "All checks passed");
+    return failures != 0;
+}
@@ -0,0 +1,276 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Transaction queue and state machine of the I2C master engine (see i2c_master.h).
+ */
+
+#include "i2c_master.h"
+
+#if (I2C_QUEUE_SIZE & (I2C_QUEUE_SIZE - 1)) != 0
+#error "I2C_QUEUE_SIZE must be a power of two"
+#endif
+
+#ifdef __TMS320C2000__
+#define RING_BARRIER()
+#else
+#define RING_BARRIER() __sync_synchronize()
+#endif
+
+// Engine states
+#define I2C_STATE_IDLE      0
+#define I2C_STATE_WRITE     1   // Sending tx
+#define I2C_STATE_READ      2   // Receiving rx after a (repeated) start
+#define I2C_STATE_STOPPING  3   // Error seen, waiting for our stop condition
+
+I2cMaster i2cMaster;
+
+/*
+ * SCL period = (I2CCLKL + d + I2CCLKH + d) module clocks, with d = 7, 6 or 5 for I2CPSC = 0, 1 or more.
+ * The prescaler brings the module clock to at most I2C_MODULE_HZ, and the period is rounded up so SCL is
+ * never faster than busHz. Fast mode (above 100 kHz) gets a 60% low phase for its 1.3 us minimum low time.
+ */
+void I2cTimingFor(Uint32 sysclkHz, Uint32 busHz, I2cTiming *timing)
+{
+    Uint32 moduleHz;
+    Uint32 total;
+    Uint16 d;
+
+    timing->psc = (Uint16)((sysclkHz + I2C_MODULE_HZ - 1) / I2C_MODULE_HZ - 1);
+    moduleHz = sysclkHz / (timing->psc + 1);
+    d = (timing->psc == 0) ? 7 : (timing->psc == 1) ? 6 : 5;
+
+    total = (moduleHz + busHz - 1) / busHz;
+    total = (total > 2u * d + 2u) ? total - 2u * d : 2;
+    if(busHz > 100000)
+    {
+        timing->clkl = (Uint16)((total * 3 + 4) / 5);
+    }
+    else
+    {
+        timing->clkl = (Uint16)((total + 1) / 2);
+    }
+    timing->clkh = (Uint16)(total - timing->clkl);
+    if(timing->clkh == 0)
+    {
+        timing->clkh = 1; // I2CCLKH must be non zero
+    }
+    timing->busHz = moduleHz / (timing->clkl + timing->clkh + 2 * d);
+}
+
+void I2cMasterInit(void)
+{
+    i2cMaster.head = 0;
+    i2cMaster.tail = 0;
+    i2cMaster.active = 0;
+    i2cMaster.state = I2C_STATE_IDLE;
+}
+
+// Queue a transaction without waiting; returns 0 if the queue is full or the transaction is empty
+Uint16 I2cSubmit(I2cTransaction *t)
+{
+    Uint16 head = i2cMaster.head;
+
+    if((t->txLength == 0 && t->rxLength == 0) || (Uint16)(head - i2cMaster.tail) >= I2C_QUEUE_SIZE)
+    {
+        i2cMaster.rejected++;
+        return 0;
+    }
+    t->status = I2C_STATUS_QUEUED;
+    i2cMaster.queue[head & (I2C_QUEUE_SIZE - 1)] = t;
+    RING_BARRIER(); // Descriptor is visible before the new head
+    i2cMaster.head = head + 1;
+    I2cHwTxInterrupt(1); // The TX FIFO interrupt starts the transaction if the engine is idle
+    return 1;
+}
+
+static void I2cFillTx(I2cTransaction *t)
+{
+    while(i2cMaster.sent < t->txLength && I2cHwTxSpace() != 0)
+    {
+        I2cHwWrite(t->tx[i2cMaster.sent++] & 0xFF);
+    }
+    I2cHwTxInterrupt(i2cMaster.sent < t->txLength);
+}
+
+static void I2cSetRxLevel(I2cTransaction *t)
+{
+    Uint16 remaining = t->rxLength - i2cMaster.received;
+
+    if(remaining != 0)
+    {
+        I2cHwRxLevel(remaining < I2C_FIFO_DEPTH ? remaining : I2C_FIFO_DEPTH);
+    }
+}
+
+static void I2cDrainRx(I2cTransaction *t)
+{
+    Uint16 data;
+
+    while(I2cHwRxCount() != 0)
+    {
+        data = I2cHwRead() & 0xFF;
+        if(i2cMaster.received < t->rxLength)
+        {
+            t->rx[i2cMaster.received++] = data;
+        }
+    }
+    I2cSetRxLevel(t);
+}
+
+static void I2cStartRead(I2cTransaction *t)
+{
+    i2cMaster.state = I2C_STATE_READ;
+    i2cMaster.received = 0;
+    I2cHwTxInterrupt(0);
+    I2cHwSetup(t->address, t->rxLength);
+    I2cSetRxLevel(t);
+    I2cHwStart(0, 1); // Receive rxLength bytes, NACK the last one and stop
+}
+
+// ISR context only: take the next queued transaction, or go idle
+static void I2cStartNext(void)
+{
+    I2cTransaction *t;
+
+    if(i2cMaster.tail == i2cMaster.head)
+    {
+        i2cMaster.active = 0;
+        i2cMaster.state = I2C_STATE_IDLE;
+        I2cHwTxInterrupt(0);
+        return;
+    }
+    RING_BARRIER(); // Read the descriptor only after seeing the new head
+    t = i2cMaster.queue[i2cMaster.tail & (I2C_QUEUE_SIZE - 1)];
+    i2cMaster.tail++;
+
+    i2cMaster.active = t;
+    i2cMaster.sent = 0;
+    i2cMaster.received = 0;
+    i2cMaster.ticks = 0;
+    t->status = I2C_STATUS_ACTIVE;
+
+    if(t->txLength != 0)
+    {
+        i2cMaster.state = I2C_STATE_WRITE;
+        I2cHwSetup(t->address, t->txLength);
+        I2cFillTx(t); // Load the FIFO before the start, so the first byte follows the address
+        I2cHwStart(1, t->rxLength == 0); // Without a stop, the count reaching 0 raises ARDY for the repeated start
+    }
+    else
+    {
+        I2cStartRead(t);
+    }
+}
+
+static void I2cFinish(Uint16 status)
+{
+    I2cTransaction *t = i2cMaster.active;
+
+    switch(status)
+    {
+    case I2C_STATUS_DONE: i2cMaster.completed++; break;
+    case I2C_STATUS_NACK: i2cMaster.nacks++; break;
+    case I2C_STATUS_ARBITRATION: i2cMaster.arbitrationLost++; break;
+    default: i2cMaster.timeouts++; break;
+    }
+    t->status = status;
+    if(t->done != 0)
+    {
+        t->done(t);
+    }
+    I2cStartNext();
+}
+
+// Called from the I2C interrupts with one I2C_EVENT_* at a time
+void I2cService(Uint16 event)
+{
+    I2cTransaction *t = i2cMaster.active;
+
+    switch(event)
+    {
+    case I2C_EVENT_TX_FIFO:
+        if(i2cMaster.state == I2C_STATE_IDLE)
+        {
+            I2cStartNext();
+        }
+        else if(i2cMaster.state == I2C_STATE_WRITE)
+        {
+            I2cFillTx(t);
+        }
+        else
+        {
+            I2cHwTxInterrupt(0);
+        }
+        break;
+
+    case I2C_EVENT_RX_FIFO:
+        if(i2cMaster.state == I2C_STATE_READ)
+        {
+            I2cDrainRx(t);
+        }
+        break;
+
+    case I2C_EVENT_READY:
+        if(i2cMaster.state == I2C_STATE_WRITE && i2cMaster.sent == t->txLength && t->rxLength != 0)
+        {
+            I2cStartRead(t); // Repeated start, the bus is not released between write and read
+        }
+        break;
+
+    case I2C_EVENT_NACK:
+        if(i2cMaster.state == I2C_STATE_WRITE || i2cMaster.state == I2C_STATE_READ)
+        {
+            i2cMaster.error = I2C_STATUS_NACK;
+            i2cMaster.state = I2C_STATE_STOPPING;
+            I2cHwTxInterrupt(0);
+            I2cHwFlush(); // Drop the bytes the slave refused
+            I2cHwStop();
+        }
+        break;
+
+    case I2C_EVENT_STOP:
+        if(i2cMaster.state == I2C_STATE_READ)
+        {
+            I2cDrainRx(t); // Bytes below the RX FIFO interrupt level
+            if(i2cMaster.received == t->rxLength)
+            {
+                I2cFinish(I2C_STATUS_DONE);
+            }
+        }
+        else if(i2cMaster.state == I2C_STATE_WRITE && t->rxLength == 0 && i2cMaster.sent == t->txLength)
+        {
+            I2cFinish(I2C_STATUS_DONE);
+        }
+        else if(i2cMaster.state == I2C_STATE_STOPPING)
+        {
+            I2cFinish(i2cMaster.error);
+        }
+        break;
+
+    case I2C_EVENT_ARBITRATION:
+        if(i2cMaster.state != I2C_STATE_IDLE)
+        {
+            I2cHwTxInterrupt(0);
+            I2cHwFlush(); // The module is now a slave; the next start waits for the bus to be free
+            I2cFinish(I2C_STATUS_ARBITRATION);
+        }
+        break;
+
+    default:
+        break;
+    }
+}
+
+// Call at a fixed rate (1 ms in main.c) from an interrupt that cannot preempt the I2C interrupts
+void I2cTick(void)
+{
+    if(i2cMaster.state != I2C_STATE_IDLE && ++i2cMaster.ticks >= I2C_TIMEOUT_TICKS)
+    {
+        I2cHwReset(); // A slave holding SCL or SDA low, or a lost stop condition
+        I2cFinish(I2C_STATUS_TIMEOUT);
+    }
+}
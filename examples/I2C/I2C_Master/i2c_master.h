@@ -0,0 +1,111 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Interrupt-driven I2C master transaction engine for the I2C_Master example. Transactions (write, read, or write followed by
+ * a repeated start and a read) are queued with I2cSubmit and run one after another from the I2C interrupts, moving data
+ * through the 4-byte FIFOs. NACKs, arbitration loss and timeouts end a transaction with an error status.
+ *
+ * The state machine only touches the I2C module through the I2cHw functions at the end of this file. They are implemented
+ * on the registers in main.c, and by a simulated controller and slave in host/i2c_sim.c, so the same state machine runs on
+ * the C28x and on a host.
+ */
+
+#ifndef I2C_MASTER_H
+#define I2C_MASTER_H
+
+#ifdef __TMS320C2000__
+#include "F2802x_Device.h"
+#else
+#include <stdint.h>
+typedef uint16_t Uint16;
+typedef uint32_t Uint32;
+#endif
+
+#define I2C_FIFO_DEPTH      4    // I2C-A TX/RX FIFO depth
+#define I2C_QUEUE_SIZE      8    // Queued transactions (power of two)
+#define I2C_TIMEOUT_TICKS   10   // I2cTick calls (ms in main.c) before an active transaction is abandoned
+
+#define I2C_MODULE_HZ       10000000UL // I2C module clock target, must be 7-12 MHz
+
+// Transaction status
+#define I2C_STATUS_IDLE         0
+#define I2C_STATUS_QUEUED       1
+#define I2C_STATUS_ACTIVE       2
+#define I2C_STATUS_DONE         3
+#define I2C_STATUS_NACK         4   // Address or data byte not acknowledged
+#define I2C_STATUS_ARBITRATION  5   // Another master won the bus
+#define I2C_STATUS_TIMEOUT      6   // No progress within I2C_TIMEOUT_TICKS, the module was reset
+
+// Events passed to I2cService by the interrupt handlers
+#define I2C_EVENT_ARBITRATION   1   // Arbitration lost (AL)
+#define I2C_EVENT_NACK          2   // No acknowledge (NACK)
+#define I2C_EVENT_READY         3   // Count reached 0 without a stop (ARDY)
+#define I2C_EVENT_STOP          6   // Stop condition detected (SCD)
+#define I2C_EVENT_TX_FIFO       16  // TX FIFO at or below its interrupt level
+#define I2C_EVENT_RX_FIFO       17  // RX FIFO at or above its interrupt level
+
+typedef struct I2cTransaction I2cTransaction;
+
+struct I2cTransaction
+{
+    Uint16 address;                      // 7-bit slave address
+    const Uint16 *tx;                    // Bytes to write first, one per word (e.g. a register address)
+    Uint16 txLength;                     // 0 for a plain read
+    Uint16 *rx;                          // Bytes read after a repeated start, one per word
+    Uint16 rxLength;                     // 0 for a plain write
+    void (*done)(I2cTransaction *t);     // Called from the ISR when the transaction ends, may be 0
+    volatile Uint16 status;              // I2C_STATUS_*
+};
+
+typedef struct
+{
+    Uint16 psc;    // I2CPSC
+    Uint16 clkl;   // I2CCLKL
+    Uint16 clkh;   // I2CCLKH
+    Uint32 busHz;  // Resulting SCL frequency
+} I2cTiming;
+
+typedef struct
+{
+    I2cTransaction *queue[I2C_QUEUE_SIZE];
+    volatile Uint16 head;     // Next free slot (main loop)
+    volatile Uint16 tail;     // Next transaction to start (ISR)
+    I2cTransaction *active;   // Transaction on the bus, 0 when idle
+    Uint16 state;             // I2C_STATE_* in i2c_master.c
+    Uint16 sent;              // Bytes of tx written to the TX FIFO
+    Uint16 received;          // Bytes of rx read from the RX FIFO
+    Uint16 error;             // Status to report once the stop condition is seen
+    Uint16 ticks;             // I2cTick calls since the transaction started
+    Uint32 completed;         // Transactions that ended with I2C_STATUS_DONE
+    Uint32 nacks;             // Transactions that ended with I2C_STATUS_NACK
+    Uint32 arbitrationLost;   // Transactions that ended with I2C_STATUS_ARBITRATION
+    Uint32 timeouts;          // Transactions that ended with I2C_STATUS_TIMEOUT
+    Uint32 rejected;          // I2cSubmit calls refused because the queue was full
+} I2cMaster;
+
+extern I2cMaster i2cMaster;
+
+void I2cTimingFor(Uint32 sysclkHz, Uint32 busHz, I2cTiming *timing);
+void I2cMasterInit(void);
+Uint16 I2cSubmit(I2cTransaction *t);
+void I2cService(Uint16 event);
+void I2cTick(void);
+
+// Hardware access, implemented in main.c (registers) and host/i2c_sim.c (simulated bus)
+void I2cHwSetup(Uint16 address, Uint16 count);      // Slave address and byte count of the next phase
+void I2cHwStart(Uint16 transmit, Uint16 stop);      // (Repeated) start, with a stop after count bytes if stop is 1
+void I2cHwStop(void);                               // Stop condition after a NACK
+Uint16 I2cHwTxSpace(void);                          // Free TX FIFO entries
+void I2cHwWrite(Uint16 data);
+Uint16 I2cHwRxCount(void);                          // Bytes in the RX FIFO
+Uint16 I2cHwRead(void);
+void I2cHwRxLevel(Uint16 level);                    // RX FIFO interrupt level
+void I2cHwTxInterrupt(Uint16 enable);               // Interrupt while the TX FIFO is at or below its level
+void I2cHwFlush(void);                              // Empty both FIFOs
+void I2cHwReset(void);                              // Reset and reinitialize the module after a timeout
+
+#endif // I2C_MASTER_H
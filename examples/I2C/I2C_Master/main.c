@@ -2,50 +2,180 @@
  * Author: Kiran Jojare
  * Email: kijo7257@colorado.edu
  * Date: Mar 21, 2024
- * Version: 1.0
+ * Version: 1.1
  *
  * Description:
  * This code demonstrates how to use the I2C (Inter-Integrated Circuit) module to communicate with an external I2C device as a master
- * on the Texas Instruments C2000 Piccolo LaunchPad Evaluation Kit (LAUNCHHXL-F28027F). The I2C is configured to communicate at a standard speed of 100 kHz.
+ * on the Texas Instruments C2000 Piccolo LaunchPad Evaluation Kit (LAUNCHHXL-F28027F). The I2C is configured to communicate at 400 kHz
+ * (fast mode); set I2C_BUS_HZ to 100000 for standard mode. I2CPSC, I2CCLKL and I2CCLKH are derived from I2C_BUS_HZ.
  *
  * The code initializes the system control and GPIO settings, configures the I2C module, and communicates with an I2C slave device.
+ * Transactions are queued with I2cSubmit and run by the interrupt-driven engine in i2c_master.c: a register read is a write of the
+ * register address followed by a repeated start and a multi-byte read, all through the I2C FIFOs. CPU Timer 0 gives the engine a
+ * 1 ms tick for timeouts. Add i2c_master.c and i2c_master.h from this folder to the project.
  *
  * This example is intended to help users get started with basic I2C master operations on the F28027F microcontroller.
  */
 
 #include "F2802x_Device.h"
 #include "f2802x_examples.h"
+#include "i2c_master.h"
 
-#define I2C_SLAVE_ADDRESS 0x50 // Slave device address
+#define I2C_SLAVE_ADDRESS 0x50      // Slave device address
+#define I2C_BUS_HZ        400000UL  // SCL frequency, 100000 or 400000
+#define SYSCLK_HZ         60000000UL
+
+#define SENSOR_FIRST_REG  0x00      // First register of the block read
+#define SENSOR_READ_BYTES 8         // Registers read per transaction
+#define SENSOR_CONFIG_REG 0x10      // Register written by the demo
+
+// I2CMDR bits
+#define I2C_MDR_FREE 0x4000 // Keep running when the debugger halts
+#define I2C_MDR_STT  0x2000 // Start condition
+#define I2C_MDR_STP  0x0800 // Stop condition after I2CCNT bytes
+#define I2C_MDR_MST  0x0400 // Master mode
+#define I2C_MDR_TRX  0x0200 // Transmitter
+#define I2C_MDR_IRS  0x0020 // Module enabled
+
+__interrupt void i2c_isr(void);
+__interrupt void i2c_fifo_isr(void);
+__interrupt void cpu_timer0_isr(void);
+
+I2cTiming i2cTiming;
+
+Uint16 sensorReg[1] = { SENSOR_FIRST_REG };
+Uint16 sensorData[SENSOR_READ_BYTES];
+Uint16 sensorConfig[2] = { SENSOR_CONFIG_REG, 0 };
+I2cTransaction sensorRead;
+I2cTransaction sensorWrite;
+volatile Uint32 sensorReads;     // Successful block reads
+volatile Uint32 sensorErrors;    // Transactions that ended with an error
+volatile Uint32 mainLoopCount;   // Main loop passes, shows the CPU is free during transfers
+
+void InitGpio()
+{
+    EALLOW;
+    GpioCtrlRegs.GPBPUD.bit.GPIO32 = 0;   // Enable pull-up on GPIO32 (SDAA)
+    GpioCtrlRegs.GPBPUD.bit.GPIO33 = 0;   // Enable pull-up on GPIO33 (SCLA)
+    GpioCtrlRegs.GPBQSEL1.bit.GPIO32 = 3; // Asynchronous input GPIO32 (SDAA)
+    GpioCtrlRegs.GPBQSEL1.bit.GPIO33 = 3; // Asynchronous input GPIO33 (SCLA)
+    GpioCtrlRegs.GPBMUX1.bit.GPIO32 = 1;  // Configure GPIO32 as SDAA
+    GpioCtrlRegs.GPBMUX1.bit.GPIO33 = 1;  // Configure GPIO33 as SCLA
+    EDIS;
+}
 
 void InitI2C()
 {
+    I2cTimingFor(SYSCLK_HZ, I2C_BUS_HZ, &i2cTiming);
+
+    I2caRegs.I2CMDR.all = 0x0000;  // Hold I2C in reset
     I2caRegs.I2CSAR = I2C_SLAVE_ADDRESS; // Set the slave address
-    I2caRegs.I2CPSC.all = 9; // Prescaler - need 7-12 Mhz on module clk (assuming 60 MHz SYSCLKOUT)
-    I2caRegs.I2CCLKL = 10;   // NOTE: must be non zero
-    I2caRegs.I2CCLKH = 5;    // NOTE: must be non zero
-    I2caRegs.I2CIER.all = 0x24; // Enable SCD & ARDY interrupts
+    I2caRegs.I2CPSC.all = i2cTiming.psc; // Prescaler - 10 MHz module clock from 60 MHz SYSCLKOUT
+    I2caRegs.I2CCLKL = i2cTiming.clkl;   // NOTE: must be non zero
+    I2caRegs.I2CCLKH = i2cTiming.clkh;   // NOTE: must be non zero
+    I2caRegs.I2CIER.all = 0x27; // Enable SCD, ARDY, NACK & AL interrupts
 
-    I2caRegs.I2CMDR.all = 0x0020; // Take I2C out of reset
-    I2caRegs.I2CMDR.all = 0x0020; // Release stop condition
-}
+    I2caRegs.I2CFFTX.all = 0x6041; // Enable FIFO mode and TX FIFO, TX interrupt level 1 (disabled until I2cSubmit)
+    I2caRegs.I2CFFRX.all = 0x2061; // Enable RX FIFO and its interrupt, level set per transfer
 
-void I2CWriteData(Uint16 data)
-{
-    while (I2caRegs.I2CMDR.bit.STP == 1); // Wait until the STP bit is cleared
-    I2caRegs.I2CMDR.all = 0x6E20; // Generate START condition, transmit mode
-    I2caRegs.I2CDXR = data; // Send data
-    while (I2caRegs.I2CMDR.bit.STP == 1); // Wait until the STP bit is cleared
+    I2caRegs.I2CMDR.all = I2C_MDR_FREE | I2C_MDR_IRS; // Take I2C out of reset
 }
 
-void InitGpio()
+void InitTimer()
 {
+    InitCpuTimers();
+    ConfigCpuTimer(&CpuTimer0, 60, 1000); // Configure CPU-Timer 0 to interrupt every 1 ms
+
     EALLOW;
-    GpioCtrlRegs.GPAPUD.bit.GPIO32 = 0; // Enable pull-up on GPIO32 (SDAA)
-    GpioCtrlRegs.GPAPUD.bit.GPIO33 = 0; // Enable pull-up on GPIO33 (SCLA)
-    GpioCtrlRegs.GPAMUX1.bit.GPIO32 = 1; // Configure GPIO32 as SDAA
-    GpioCtrlRegs.GPAMUX1.bit.GPIO33 = 1; // Configure GPIO33 as SCLA
+    PieVectTable.TINT0 = &cpu_timer0_isr; // Map ISR to the PIE vector table
     EDIS;
+
+    IER |= M_INT1; // Enable CPU INT1
+    PieCtrlRegs.PIEIER1.bit.INTx7 = 1; // Enable PIE Group 1 interrupt 7 (TINT0)
+
+    CpuTimer0Regs.TCR.all = 0x4000; // Start CPU-Timer 0
+}
+
+// Hardware access for i2c_master.c
+void I2cHwSetup(Uint16 address, Uint16 count)
+{
+    I2caRegs.I2CSAR = address;
+    I2caRegs.I2CCNT = count;
+}
+
+void I2cHwStart(Uint16 transmit, Uint16 stop)
+{
+    I2caRegs.I2CMDR.all = I2C_MDR_FREE | I2C_MDR_IRS | I2C_MDR_MST | I2C_MDR_STT
+                        | (transmit ? I2C_MDR_TRX : 0) | (stop ? I2C_MDR_STP : 0);
+}
+
+void I2cHwStop(void)
+{
+    I2caRegs.I2CMDR.bit.STP = 1;
+}
+
+Uint16 I2cHwTxSpace(void)
+{
+    return I2C_FIFO_DEPTH - I2caRegs.I2CFFTX.bit.TXFFST;
+}
+
+void I2cHwWrite(Uint16 data)
+{
+    I2caRegs.I2CDXR = data;
+}
+
+Uint16 I2cHwRxCount(void)
+{
+    return I2caRegs.I2CFFRX.bit.RXFFST;
+}
+
+Uint16 I2cHwRead(void)
+{
+    return I2caRegs.I2CDRR;
+}
+
+void I2cHwRxLevel(Uint16 level)
+{
+    I2caRegs.I2CFFRX.bit.RXFFIL = level;
+}
+
+void I2cHwTxInterrupt(Uint16 enable)
+{
+    I2caRegs.I2CFFTX.bit.TXFFIENA = enable;
+}
+
+void I2cHwFlush(void)
+{
+    I2caRegs.I2CFFTX.bit.TXFFRST = 0; // Reset TX FIFO
+    I2caRegs.I2CFFRX.bit.RXFFRST = 0; // Reset RX FIFO
+    I2caRegs.I2CFFTX.bit.TXFFRST = 1;
+    I2caRegs.I2CFFRX.bit.RXFFRST = 1;
+}
+
+void I2cHwReset(void)
+{
+    InitI2C(); // Resets the module, which also releases SCL and SDA
+}
+
+// Completion callbacks, run in the I2C interrupts
+void SensorReadDone(I2cTransaction *t)
+{
+    if(t->status == I2C_STATUS_DONE)
+    {
+        sensorReads++;
+    }
+    else
+    {
+        sensorErrors++;
+    }
+}
+
+void SensorWriteDone(I2cTransaction *t)
+{
+    if(t->status != I2C_STATUS_DONE)
+    {
+        sensorErrors++;
+    }
 }
 
 void main(void)
@@ -55,10 +185,96 @@ void main(void)
 
     InitGpio();    // Initialize the GPIO
     InitI2C();     // Initialize the I2C
+    I2cMasterInit();
+
+    InitPieCtrl(); // Initialize the PIE control registers
+    InitPieVectTable(); // Initialize the PIE vector table
+
+    EALLOW;
+    PieVectTable.I2CINT1A = &i2c_isr;      // Map I2C ISR to the PIE vector table
+    PieVectTable.I2CINT2A = &i2c_fifo_isr; // Map I2C FIFO ISR to the PIE vector table
+    EDIS;
+
+    IER |= M_INT8; // Enable CPU INT8
+    PieCtrlRegs.PIEIER8.bit.INTx1 = 1; // Enable PIE Group 8 interrupt 1 (I2CINT1A)
+    PieCtrlRegs.PIEIER8.bit.INTx2 = 1; // Enable PIE Group 8 interrupt 2 (I2CINT2A)
+
+    InitTimer();   // 1 ms tick for I2C timeouts
+
+    EINT;  // Enable Global interrupt INTM
+    ERTM;  // Enable Global realtime interrupt DBGM
+
+    // Register read: write the register address, repeated start, read SENSOR_READ_BYTES
+    sensorRead.address = I2C_SLAVE_ADDRESS;
+    sensorRead.tx = sensorReg;
+    sensorRead.txLength = 1;
+    sensorRead.rx = sensorData;
+    sensorRead.rxLength = SENSOR_READ_BYTES;
+    sensorRead.done = SensorReadDone;
+
+    // Register write: register address and value
+    sensorWrite.address = I2C_SLAVE_ADDRESS;
+    sensorWrite.tx = sensorConfig;
+    sensorWrite.txLength = 2;
+    sensorWrite.rx = 0;
+    sensorWrite.rxLength = 0;
+    sensorWrite.done = SensorWriteDone;
 
     while(1)
     {
-        I2CWriteData(0xA5); // Send data to I2C slave
-        DELAY_US(1000000); // Delay for 1 second
+        if(sensorWrite.status == I2C_STATUS_IDLE || sensorWrite.status >= I2C_STATUS_DONE)
+        {
+            sensorConfig[1] = (sensorConfig[1] + 1) & 0xFF;
+            I2cSubmit(&sensorWrite);
+        }
+        if(sensorRead.status == I2C_STATUS_IDLE || sensorRead.status >= I2C_STATUS_DONE)
+        {
+            I2cSubmit(&sensorRead); // Returns immediately, the ISRs do the transfer
+        }
+
+        mainLoopCount++; // Other work runs here while the transfers are in progress
+        DELAY_US(10000);
+    }
+}
+
+// Basic I2C interrupts: arbitration lost, NACK, register access ready and stop condition
+__interrupt void i2c_isr(void)
+{
+    Uint16 code;
+
+    while((code = I2caRegs.I2CISRC.bit.INTCODE) != 0) // Highest priority pending interrupt
+    {
+        if(code <= 6)
+        {
+            I2caRegs.I2CSTR.all = 1 << (code - 1); // Clear the flag (AL, NACK, ARDY, RRDY, XRDY, SCD are bits 0-5)
+        }
+        I2cService(code); // I2C_EVENT_* codes match INTCODE
     }
+
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP8; // Acknowledge interrupt
+}
+
+// I2C FIFO interrupts
+__interrupt void i2c_fifo_isr(void)
+{
+    if(I2caRegs.I2CFFRX.bit.RXFFINT)
+    {
+        I2cService(I2C_EVENT_RX_FIFO);
+        I2caRegs.I2CFFRX.bit.RXFFINTCLR = 1; // Clear RX FIFO interrupt flag
+    }
+    if(I2caRegs.I2CFFTX.bit.TXFFINT && I2caRegs.I2CFFTX.bit.TXFFIENA)
+    {
+        I2cService(I2C_EVENT_TX_FIFO);
+        I2caRegs.I2CFFTX.bit.TXFFINTCLR = 1; // Clear TX FIFO interrupt flag
+    }
+
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP8; // Acknowledge interrupt
+}
+
+__interrupt void cpu_timer0_isr(void)
+{
+    I2cTick(); // Interrupts do not nest, so this never runs in the middle of an I2C interrupt
+
+    CpuTimer0Regs.TCR.bit.TIF = 1; // Clear Timer interrupt flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP1; // Acknowledge interrupt
 }
@@ -2,13 +2,18 @@
  * Author: Kiran Jojare
  * Email: kijo7257@colorado.edu
  * Date: Mar 30, 2024
- * Version: 1.0
+ * Version: 1.2
  *
  * Description:
  * This code demonstrates how to use the I2C (Inter-Integrated Circuit) module to communicate with an external I2C device as a slave
- * on the Texas Instruments C2000 Piccolo LaunchPad Evaluation Kit (LAUNCHHXL-F28027F). The I2C is configured to communicate at a standard speed of 100 kHz.
+ * on the Texas Instruments C2000 Piccolo LaunchPad Evaluation Kit (LAUNCHHXL-F28027F). The slave works at standard (100 kHz) and fast (400 kHz) speeds.
  *
  * The code initializes the system control and GPIO settings, configures the I2C module as a slave, and communicates with an I2C master device.
+ * The board behaves like a typical I2C peripheral with a register map: the first byte of a write sets the register pointer, and
+ * following bytes are written or read with auto-increment. Status registers are published by the application into a shadow copy
+ * that is swapped in only between transactions, and control registers written by the master are committed at the STOP condition,
+ * so neither side ever sees a multi-byte value half updated. Each byte is handled by one short FIFO interrupt, whose duration
+ * is measured with CPU Timer 1.
  *
  * This example is intended to help users get started with basic I2C slave operations on the F28027F microcontroller.
  */
@@ -18,71 +23,357 @@
 
 #define I2C_SLAVE_ADDRESS 0x50 // Slave device address
 
+#define I2C_STATUS_REGS   16   // Registers 0x00-0x0F: read-only, published by the application
+#define I2C_CONTROL_REGS  16   // Registers 0x10-0x1F: written by the master
+#define I2C_REG_COUNT     (I2C_STATUS_REGS + I2C_CONTROL_REGS) // Pointer wraps at this value (power of two)
+#define I2C_PAD_BYTE      0xFF // Read from registers outside the map
+
+// Basic interrupt codes (I2CISRC.INTCODE)
+#define I2C_INT_SCD       6    // Stop condition detected
+#define I2C_INT_AAS       7    // Addressed as slave
+
+// Example status register layout
+#define REG_SEQUENCE      0x00 // 2 bytes, also repeated at REG_SEQUENCE_END
+#define REG_LOOP_COUNT    0x02 // 4 bytes
+#define REG_SETPOINT_ECHO 0x06 // 2 bytes, last committed setpoint
+#define REG_SEQUENCE_END  0x0E // 2 bytes
+
+// Example control register layout
+#define REG_SETPOINT      0x10 // 2 bytes
+#define REG_MODE          0x12 // 1 byte
+
+#if (I2C_REG_COUNT & (I2C_REG_COUNT - 1)) != 0
+#error "I2C_REG_COUNT must be a power of two"
+#endif
+
 __interrupt void i2c_isr(void);
+__interrupt void i2c_fifo_isr(void);
+
+/*
+ * Register bank. The ISRs serve status[front]; the main loop fills status[front ^ 1] and publishes it.
+ * Master writes land in staging and are copied to control at the STOP condition.
+ */
+typedef struct
+{
+    Uint16 status[2][I2C_STATUS_REGS];
+    Uint16 control[I2C_CONTROL_REGS];  // Committed control registers
+    Uint16 staging[I2C_CONTROL_REGS];  // Control registers being written
+    volatile Uint16 front;             // Status bank being served (ISR, or I2cSlavePublish between transactions)
+    volatile Uint16 pending;           // Back bank published during a transaction, swap at STOP
+    volatile Uint16 busy;              // Addressed, no STOP seen yet
+    Uint16 pointer;                    // Register pointer
+    Uint16 expectPointer;              // Next received byte sets the pointer
+    Uint16 dirtyFirst;                 // Staged control register range, first > last when empty
+    Uint16 dirtyLast;
+    volatile Uint32 reads;             // Read transactions
+    volatile Uint32 writes;            // Write transactions that changed control registers
+    volatile Uint32 swaps;             // Status banks published
+    volatile Uint32 readOnlyWrites;    // Bytes written to status registers and ignored
+} I2cSlave;
+
+I2cSlave i2cSlave;
+
+Uint16 controlCopy[I2C_CONTROL_REGS]; // Main loop copy of the control registers
+volatile Uint32 mainLoopCount;
+volatile Uint32 i2cFifoIsrCycles;     // Duration of the last i2c_fifo_isr
+volatile Uint32 i2cFifoIsrCyclesMax;  // Worst case seen
+volatile Uint32 i2cIsrCycles;         // Duration of the last i2c_isr
+volatile Uint32 i2cIsrCyclesMax;      // Worst case seen
 
 void InitI2C()
 {
     EALLOW;
-    I2caRegs.I2CSAR = I2C_SLAVE_ADDRESS; // Set the slave address
-    I2caRegs.I2CPSC.all = 9; // Prescaler - need 7-12 Mhz on module clk (assuming 60 MHz SYSCLKOUT)
+    I2caRegs.I2CMDR.all = 0x0000;        // Hold I2C in reset
+    I2caRegs.I2COAR = I2C_SLAVE_ADDRESS; // Own (slave) address
+    I2caRegs.I2CPSC.all = 5; // Prescaler - 10 MHz module clock (must be 7-12 MHz) from 60 MHz SYSCLKOUT
     I2caRegs.I2CCLKL = 10;   // NOTE: must be non zero
     I2caRegs.I2CCLKH = 5;    // NOTE: must be non zero
-    I2caRegs.I2CIER.all = 0x24; // Enable SCD & ARDY interrupts
+    I2caRegs.I2CIER.all = 0x60; // Enable AAS & SCD interrupts
 
-    I2caRegs.I2CMDR.all = 0x0020; // Take I2C out of reset
-    I2caRegs.I2CMDR.all = 0x0020; // Release stop condition
+    I2caRegs.I2CFFTX.all = 0x6040; // Enable FIFO mode and TX FIFO, TX interrupt when empty (enabled during reads)
+    I2caRegs.I2CFFRX.all = 0x2061; // Enable RX FIFO, interrupt on every byte
+
+    I2caRegs.I2CMDR.all = 0x0020; // Take I2C out of reset, slave mode
+    EDIS;
+
+    i2cSlave.dirtyFirst = I2C_CONTROL_REGS;
+    i2cSlave.dirtyLast = 0;
+}
+
+void InitCpuTimer1()
+{
+    EALLOW;
+    CpuTimer1Regs.PRD.all = 0xFFFFFFFF; // Maximum period
+    CpuTimer1Regs.TPR.all = 0;          // Count every SYSCLKOUT cycle
+    CpuTimer1Regs.TPRH.all = 0;
+    CpuTimer1Regs.TCR.bit.TSS = 1;    // Stop the timer
+    CpuTimer1Regs.TCR.bit.TRB = 1;    // Reload the timer
+    CpuTimer1Regs.TCR.bit.TIE = 0;    // No timer interrupt
+    CpuTimer1Regs.TCR.bit.TSS = 0;    // Start the timer
     EDIS;
 }
 
 void InitGpio()
 {
     EALLOW;
-    GpioCtrlRegs.GPAPUD.bit.GPIO32 = 0; // Enable pull-up on GPIO32 (SDAA)
-    GpioCtrlRegs.GPAPUD.bit.GPIO33 = 0; // Enable pull-up on GPIO33 (SCLA)
-    GpioCtrlRegs.GPAMUX1.bit.GPIO32 = 1; // Configure GPIO32 as SDAA
-    GpioCtrlRegs.GPAMUX1.bit.GPIO33 = 1; // Configure GPIO33 as SCLA
+    GpioCtrlRegs.GPBPUD.bit.GPIO32 = 0;   // Enable pull-up on GPIO32 (SDAA)
+    GpioCtrlRegs.GPBPUD.bit.GPIO33 = 0;   // Enable pull-up on GPIO33 (SCLA)
+    GpioCtrlRegs.GPBQSEL1.bit.GPIO32 = 3; // Asynchronous input GPIO32 (SDAA)
+    GpioCtrlRegs.GPBQSEL1.bit.GPIO33 = 3; // Asynchronous input GPIO33 (SCLA)
+    GpioCtrlRegs.GPBMUX1.bit.GPIO32 = 1;  // Configure GPIO32 as SDAA
+    GpioCtrlRegs.GPBMUX1.bit.GPIO33 = 1;  // Configure GPIO33 as SCLA
     EDIS;
 }
 
+static inline Uint16 I2cSlaveRegRead(Uint16 reg)
+{
+    if(reg < I2C_STATUS_REGS)
+    {
+        return i2cSlave.status[i2cSlave.front][reg];
+    }
+    return i2cSlave.control[reg - I2C_STATUS_REGS];
+}
+
+static inline void I2cSlaveRegWrite(Uint16 reg, Uint16 value)
+{
+    if(reg < I2C_STATUS_REGS)
+    {
+        i2cSlave.readOnlyWrites++;
+        return;
+    }
+    reg -= I2C_STATUS_REGS;
+    i2cSlave.staging[reg] = value;
+    if(reg < i2cSlave.dirtyFirst)
+    {
+        i2cSlave.dirtyFirst = reg;
+    }
+    if(reg > i2cSlave.dirtyLast)
+    {
+        i2cSlave.dirtyLast = reg;
+    }
+}
+
+// Byte written by the master: the first one of a write sets the pointer, the others go to the staging copy
+static inline void I2cSlaveRxByte(Uint16 data)
+{
+    if(i2cSlave.expectPointer)
+    {
+        i2cSlave.pointer = data & (I2C_REG_COUNT - 1);
+        i2cSlave.expectPointer = 0;
+    }
+    else
+    {
+        I2cSlaveRegWrite(i2cSlave.pointer, data);
+        i2cSlave.pointer = (i2cSlave.pointer + 1) & (I2C_REG_COUNT - 1);
+    }
+}
+
+// Returns the status bank to fill with a complete new snapshot, or 0 while a published one waits for a STOP
+Uint16 *I2cSlaveBeginUpdate(void)
+{
+    if(i2cSlave.pending)
+    {
+        return 0;
+    }
+    return i2cSlave.status[i2cSlave.front ^ 1];
+}
+
+// Publish the bank from I2cSlaveBeginUpdate: now if the bus is idle, otherwise at the STOP of the current transaction
+void I2cSlavePublish(void)
+{
+    Uint16 state = __disable_interrupts();
+
+    if(i2cSlave.busy)
+    {
+        i2cSlave.pending = 1;
+    }
+    else
+    {
+        i2cSlave.front ^= 1; // No byte of a read has been loaded yet; i2c_isr runs after this on an address match
+        i2cSlave.swaps++;
+    }
+    __restore_interrupts(state);
+}
+
+// Copy the committed control registers; a STOP cannot commit in the middle of the copy
+void I2cSlaveReadControl(Uint16 *dest)
+{
+    Uint16 state = __disable_interrupts();
+    Uint16 i;
+
+    for(i = 0; i < I2C_CONTROL_REGS; i++)
+    {
+        dest[i] = i2cSlave.control[i];
+    }
+    __restore_interrupts(state);
+}
+
+// Example snapshot: the sequence number at both ends lets the master check that a block read is consistent
+void BuildStatus(Uint16 *regs, Uint16 seq)
+{
+    Uint16 i;
+
+    for(i = 0; i < I2C_STATUS_REGS; i++)
+    {
+        regs[i] = 0;
+    }
+    regs[REG_SEQUENCE] = seq & 0xFF;
+    regs[REG_SEQUENCE + 1] = (seq >> 8) & 0xFF;
+    regs[REG_LOOP_COUNT] = mainLoopCount & 0xFF;
+    regs[REG_LOOP_COUNT + 1] = (mainLoopCount >> 8) & 0xFF;
+    regs[REG_LOOP_COUNT + 2] = (mainLoopCount >> 16) & 0xFF;
+    regs[REG_LOOP_COUNT + 3] = (mainLoopCount >> 24) & 0xFF;
+    regs[REG_SETPOINT_ECHO] = controlCopy[REG_SETPOINT - I2C_STATUS_REGS];
+    regs[REG_SETPOINT_ECHO + 1] = controlCopy[REG_SETPOINT - I2C_STATUS_REGS + 1];
+    regs[REG_SEQUENCE_END] = seq & 0xFF;
+    regs[REG_SEQUENCE_END + 1] = (seq >> 8) & 0xFF;
+}
+
 void main(void)
 {
+    Uint16 *regs;
+    Uint16 seq = 0;
+
     InitSysCtrl(); // Initialize the CPU and configure the clock
     DINT;          // Disable CPU interrupts
 
     InitGpio();    // Initialize the GPIO
     InitI2C();     // Initialize the I2C
+    InitCpuTimer1(); // Cycle counter for the ISR durations
 
     InitPieCtrl(); // Initialize the PIE control registers
     InitPieVectTable(); // Initialize the PIE vector table
 
     EALLOW;
-    PieVectTable.I2CINT1A = &i2c_isr; // Map ISR to the PIE vector table
+    PieVectTable.I2CINT1A = &i2c_isr;      // Map I2C ISR to the PIE vector table
+    PieVectTable.I2CINT2A = &i2c_fifo_isr; // Map I2C FIFO ISR to the PIE vector table
     EDIS;
 
     IER |= M_INT8; // Enable CPU INT8
-    PieCtrlRegs.PIEIER8.bit.INTx1 = 1; // Enable PIE Group 8 interrupt 1
+    PieCtrlRegs.PIEIER8.bit.INTx1 = 1; // Enable PIE Group 8 interrupt 1 (I2CINT1A)
+    PieCtrlRegs.PIEIER8.bit.INTx2 = 1; // Enable PIE Group 8 interrupt 2 (I2CINT2A)
 
     EINT;  // Enable Global interrupt INTM
     ERTM;  // Enable Global realtime interrupt DBGM
 
     while(1)
     {
-        // Wait for I2C communication
+        I2cSlaveReadControl(controlCopy); // Setpoint and mode from the master
+
+        regs = I2cSlaveBeginUpdate();
+        if(regs != 0)
+        {
+            BuildStatus(regs, seq++);
+            I2cSlavePublish();
+        }
+
+        mainLoopCount++;
+        DELAY_US(1000);
     }
 }
 
+/*
+ * Address match and STOP. I2CINT1A has priority over I2CINT2A, so bytes of the previous write, such as the register
+ * pointer before a repeated start, can still be in the RX FIFO. They are handled first, or a read would start at the
+ * old pointer and a STOP would commit without the last byte.
+ */
 __interrupt void i2c_isr(void)
 {
-    if (I2caRegs.I2CISRC.bit.INTCODE == 0x6) // Receive data
+    Uint32 start = CpuTimer1Regs.TIM.all;
+    Uint16 code;
+    Uint16 i;
+    Uint32 cycles;
+
+    while((code = I2caRegs.I2CISRC.bit.INTCODE) != 0) // Reading I2CISRC clears AAS and SCD
     {
-        Uint16 receivedData = I2caRegs.I2CDRR;
-        // Process received data
+        while(I2caRegs.I2CFFRX.bit.RXFFST != 0)
+        {
+            I2cSlaveRxByte(I2caRegs.I2CDRR & 0xFF);
+        }
+
+        if(code == I2C_INT_AAS) // Start or repeated start with our address
+        {
+            i2cSlave.busy = 1;
+            if(I2caRegs.I2CSTR.bit.SDIR) // Master reads: load the first byte, SCL is stretched until then
+            {
+                i2cSlave.reads++;
+                I2caRegs.I2CFFTX.bit.TXFFRST = 0; // Drop a byte left from an earlier read
+                I2caRegs.I2CFFTX.bit.TXFFRST = 1;
+                I2caRegs.I2CDXR = I2cSlaveRegRead(i2cSlave.pointer);
+                i2cSlave.pointer = (i2cSlave.pointer + 1) & (I2C_REG_COUNT - 1);
+                I2caRegs.I2CFFTX.bit.TXFFINTCLR = 1;
+                I2caRegs.I2CFFTX.bit.TXFFIENA = 1;
+            }
+            else // Master writes: the first byte is the register pointer
+            {
+                i2cSlave.expectPointer = 1;
+            }
+        }
+        else if(code == I2C_INT_SCD)
+        {
+            if(I2caRegs.I2CFFTX.bit.TXFFIENA)
+            {
+                // The byte loaded after the master's NACK was never sent, so step the pointer back over it
+                i2cSlave.pointer = (i2cSlave.pointer - I2caRegs.I2CFFTX.bit.TXFFST) & (I2C_REG_COUNT - 1);
+                I2caRegs.I2CFFTX.bit.TXFFIENA = 0;
+                I2caRegs.I2CFFTX.bit.TXFFRST = 0; // Drop it
+                I2caRegs.I2CFFTX.bit.TXFFRST = 1;
+            }
+            if(i2cSlave.dirtyFirst <= i2cSlave.dirtyLast) // Commit the control registers written in this transaction
+            {
+                for(i = i2cSlave.dirtyFirst; i <= i2cSlave.dirtyLast; i++)
+                {
+                    i2cSlave.control[i] = i2cSlave.staging[i];
+                }
+                i2cSlave.dirtyFirst = I2C_CONTROL_REGS;
+                i2cSlave.dirtyLast = 0;
+                i2cSlave.writes++;
+            }
+            if(i2cSlave.pending)
+            {
+                i2cSlave.front ^= 1;
+                i2cSlave.pending = 0;
+                i2cSlave.swaps++;
+            }
+            i2cSlave.busy = 0;
+        }
     }
-    else if (I2caRegs.I2CISRC.bit.INTCODE == 0x8) // Transmit data
+
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP8; // Acknowledge interrupt
+
+    cycles = start - CpuTimer1Regs.TIM.all; // Timer counts down
+    i2cIsrCycles = cycles;
+    if(cycles > i2cIsrCyclesMax)
     {
-        I2caRegs.I2CDXR = 0xA5; // Send data
+        i2cIsrCyclesMax = cycles;
+    }
+}
+
+// One byte per interrupt in each direction, constant time
+__interrupt void i2c_fifo_isr(void)
+{
+    Uint32 start = CpuTimer1Regs.TIM.all;
+    Uint32 cycles;
+
+    while(I2caRegs.I2CFFRX.bit.RXFFST != 0) // Byte written by the master
+    {
+        I2cSlaveRxByte(I2caRegs.I2CDRR & 0xFF);
+    }
+    I2caRegs.I2CFFRX.bit.RXFFINTCLR = 1; // Clear RX FIFO interrupt flag
+
+    if(I2caRegs.I2CFFTX.bit.TXFFIENA && I2caRegs.I2CFFTX.bit.TXFFST == 0) // Master is reading: queue the next byte
+    {
+        I2caRegs.I2CDXR = I2cSlaveRegRead(i2cSlave.pointer);
+        i2cSlave.pointer = (i2cSlave.pointer + 1) & (I2C_REG_COUNT - 1);
+        I2caRegs.I2CFFTX.bit.TXFFINTCLR = 1; // Clear TX FIFO interrupt flag
     }
 
-    I2caRegs.I2CSTR.bit.SCD = 1; // Clear stop condition detected
     PieCtrlRegs.PIEACK.all = PIEACK_GROUP8; // Acknowledge interrupt
+
+    cycles = start - CpuTimer1Regs.TIM.all; // Timer counts down
+    i2cFifoIsrCycles = cycles;
+    if(cycles > i2cFifoIsrCyclesMax)
+    {
+        i2cFifoIsrCyclesMax = cycles;
+    }
 }
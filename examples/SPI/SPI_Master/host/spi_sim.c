@@ -0,0 +1,501 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Runs the SPI_Master transaction engine (spi_master.c) on a Linux host against a simulated SPI-A with the settings of
+ * main.c: SYSCLKOUT 60 MHz, LSPCLK 15 MHz, SPIBRR 14 (1 MHz SPI clock, 60 CPU cycles per bit), 4-level TX and RX
+ * FIFOs and loop-back mode. The model steps one CPU cycle at a time. A character is loaded from the TX FIFO into the
+ * shift register as soon as the previous one is done, with the SPICHAR length in force at that moment, and SPIDAT
+ * shifts left so the bits above the character hold what was sent. The RX FIFO interrupt is raised while RXFFST is
+ * at least RXFFIL and the TX FIFO interrupt while TXFFIENA is set and the TX FIFO is empty; each one keeps the CPU
+ * for SIM_ISR_CYCLES (PIE entry, context save and the ISR body) and runs SpiRxService or SpiTxService at the end.
+ *
+ * The checks cover one transaction and a full queue of back-to-back transactions: data, completion order, chip
+ * select around every transaction, FIFO overflow, and the share of the time the SPI clock runs. The same 63-byte
+ * transfer is then timed with 8-bit and packed 16-bit characters at SPIBRR 14 and 3, and 3000 random batches mix
+ * both character sizes, odd lengths and missing TX or RX buffers; they check the bytes, the number of characters
+ * shifted (so each odd tail went out as one 8-bit character) and every SPICHAR switch. The exit status is 1 if any
+ * check fails.
+ *
+ * Build: gcc -O2 -I.. -o spi_sim spi_sim.c ../spi_master.c
+ */
+
+#include "spi_master.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SYSCLK_HZ          60000000UL
+#define SIM_LSPCLK_DIV     4      // LOSPCP reset value: LSPCLK = SYSCLKOUT / 4
+#define SIM_BRR            14     // SPI_BRR of main.c
+#define SIM_FAST_BRR       3      // 3.75 MHz SPI clock
+#define SIM_ISR_CYCLES     160    // CPU cycles from interrupt request to the end of the ISR
+#define SIM_MAX_CYCLES     10000000UL
+#define SIM_TRANSFER_BYTES 16
+#define SIM_BENCH_BYTES    63     // SPI_BENCH_LENGTH of main.c
+#define SIM_BATCHES        3000
+#define SIM_MAX_BYTES      65
+
+typedef struct
+{
+    // SPI-A
+    Uint32 bitCycles;      // CPU cycles per SPI clock
+    Uint16 charBits;       // SPICCR.SPICHAR + 1
+    Uint16 txFifo[SPI_FIFO_DEPTH];
+    Uint16 txCount;
+    Uint16 rxFifo[SPI_FIFO_DEPTH];
+    Uint16 rxCount;
+    Uint16 rxLevel;        // RXFFIL
+    Uint16 txInterrupt;    // TXFFIENA
+    Uint16 shiftWord;      // SPIDAT
+    Uint16 shiftBits;      // Length of the character in SPIDAT
+    Uint32 shiftLeft;      // CPU cycles until the character in SPIDAT is done, 0 when the line is idle
+    Uint32 fifoErrors;     // Writes to a full TX FIFO, reads of an empty RX FIFO and RX FIFO overflows
+    Uint32 charSwitches;   // SPICHAR changes
+    Uint32 lateSwitches;   // SPICHAR changes with a character in the FIFO or the shift register
+    Uint32 characters;     // Characters shifted
+
+    // Chip select
+    Uint16 selected;
+    Uint32 selects;
+    Uint32 unselected;     // Characters shifted with chip select inactive
+    Uint32 earlyDeselects; // Chip select released with characters left to shift
+
+    // CPU
+    Uint32 now;            // CPU cycles
+    Uint32 isrLeft;        // Cycles until the running ISR ends, 0 when no ISR runs
+    Uint16 isrRx;          // The running ISR is the RX FIFO interrupt
+    Uint32 isrs;
+    Uint32 spuriousIsrs;   // RX FIFO interrupts that found the FIFO empty
+    Uint32 busyCycles;     // Cycles with the SPI clock running
+    Uint32 firstBit;       // Start of the first character of the run
+    Uint32 lastBit;        // End of the last character of the run
+} SpiSim;
+
+static SpiSim sim;
+static int failures;
+static SpiTransaction *completions[SPI_QUEUE_SIZE + 1];
+static Uint16 completionCount;
+
+// Hardware access for spi_master.c
+void SpiHwCharBits(Uint16 bits)
+{
+    sim.charSwitches++;
+    if(sim.txCount != 0 || sim.shiftLeft != 0)
+    {
+        sim.lateSwitches++;
+    }
+    sim.charBits = bits;
+}
+
+void SpiHwWrite(Uint16 word)
+{
+    if(sim.txCount == SPI_FIFO_DEPTH)
+    {
+        sim.fifoErrors++;
+        return;
+    }
+    sim.txFifo[sim.txCount++] = word;
+}
+
+Uint16 SpiHwRxCount(void)
+{
+    return sim.rxCount;
+}
+
+Uint16 SpiHwRead(void)
+{
+    Uint16 word;
+
+    if(sim.rxCount == 0)
+    {
+        sim.fifoErrors++;
+        return 0;
+    }
+    word = sim.rxFifo[0];
+    memmove(&sim.rxFifo[0], &sim.rxFifo[1], (--sim.rxCount) * sizeof(sim.rxFifo[0]));
+    return word;
+}
+
+void SpiHwRxLevel(Uint16 level)
+{
+    sim.rxLevel = level;
+}
+
+void SpiHwTxInterrupt(Uint16 enable)
+{
+    sim.txInterrupt = enable;
+}
+
+static void SimChipSelect(Uint16 active)
+{
+    if(active)
+    {
+        sim.selects++;
+    }
+    else if(sim.txCount != 0 || sim.shiftLeft != 0)
+    {
+        sim.earlyDeselects++;
+    }
+    sim.selected = active;
+}
+
+static void SimDone(SpiTransaction *t)
+{
+    if(completionCount <= SPI_QUEUE_SIZE)
+    {
+        completions[completionCount++] = t;
+    }
+}
+
+static void SimReset(Uint16 brr)
+{
+    memset(&sim, 0, sizeof(sim));
+    sim.bitCycles = (brr + 1UL) * SIM_LSPCLK_DIV;
+    sim.charBits = 8; // InitSpi
+    sim.rxLevel = 1;
+    completionCount = 0;
+    memset(&spiMaster, 0, sizeof(spiMaster));
+    SpiMasterInit();
+}
+
+// One CPU cycle
+static void SimStep(void)
+{
+    Uint16 mask;
+
+    if(sim.shiftLeft != 0)
+    {
+        sim.busyCycles++;
+        if(--sim.shiftLeft == 0)
+        {
+            // Loop-back: SPISOMI is SPISIMO, so SPIDAT shifts its own top bits back in at the bottom
+            mask = (1U << sim.shiftBits) - 1;
+            sim.shiftWord = (Uint16)((sim.shiftWord << sim.shiftBits) | ((sim.shiftWord >> (16 - sim.shiftBits)) & mask));
+            if(sim.rxCount == SPI_FIFO_DEPTH)
+            {
+                sim.fifoErrors++; // RXFFOVF, the character is lost
+            }
+            else
+            {
+                sim.rxFifo[sim.rxCount++] = sim.shiftWord;
+            }
+            sim.lastBit = sim.now;
+        }
+    }
+    if(sim.shiftLeft == 0 && sim.txCount != 0)
+    {
+        sim.shiftWord = sim.txFifo[0];
+        memmove(&sim.txFifo[0], &sim.txFifo[1], (--sim.txCount) * sizeof(sim.txFifo[0]));
+        sim.shiftBits = sim.charBits;
+        sim.shiftLeft = sim.shiftBits * sim.bitCycles;
+        sim.characters++;
+        sim.unselected += !sim.selected;
+        if(sim.firstBit == 0)
+        {
+            sim.firstBit = sim.now;
+        }
+    }
+
+    if(sim.isrLeft != 0)
+    {
+        if(--sim.isrLeft == 0)
+        {
+            if(sim.isrRx)
+            {
+                sim.spuriousIsrs += sim.rxCount == 0;
+                SpiRxService();
+            }
+            else
+            {
+                SpiTxService();
+            }
+        }
+    }
+    else if(sim.rxCount >= sim.rxLevel && sim.rxCount != 0)
+    {
+        sim.isrRx = 1;
+        sim.isrLeft = SIM_ISR_CYCLES;
+        sim.isrs++;
+    }
+    else if(sim.txInterrupt && sim.txCount == 0) // TXFFIL is 0 in main.c
+    {
+        sim.isrRx = 0;
+        sim.isrLeft = SIM_ISR_CYCLES;
+        sim.isrs++;
+    }
+    sim.now++;
+}
+
+// Run until the queue is empty and the SPI is idle; returns the CPU cycles taken
+static Uint32 SimRun(void)
+{
+    Uint32 start = sim.now;
+
+    while((spiMaster.active != 0 || spiMaster.head != spiMaster.tail || sim.isrLeft != 0 || sim.txInterrupt) &&
+          sim.now - start < SIM_MAX_CYCLES)
+    {
+        SimStep();
+    }
+    return sim.now - start;
+}
+
+static void Check(const char *name, int ok)
+{
+    printf("  %-52s %s\n", name, ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        failures++;
+    }
+}
+
+static void Prepare(SpiTransaction *t, const SpiDevice *device, const Uint16 *tx, Uint16 *rx, Uint16 length)
+{
+    t->device = device;
+    t->tx = tx;
+    t->rx = rx;
+    t->length = length;
+    t->done = SimDone;
+    t->status = SPI_IDLE;
+}
+
+// Share of the time from the first to the last bit that the SPI clock runs
+static double LineBusy(void)
+{
+    return (double)sim.busyCycles / (sim.lastBit - sim.firstBit);
+}
+
+static void TestSingle(void)
+{
+    static const SpiDevice device8 = { SimChipSelect, 8 };
+    SpiTransaction t;
+    Uint16 tx[SIM_TRANSFER_BYTES], rx[SIM_TRANSFER_BYTES];
+    Uint16 i;
+    Uint32 cycles;
+    double busy, overall;
+
+    SimReset(SIM_BRR);
+    for(i = 0; i < SIM_TRANSFER_BYTES; i++)
+    {
+        tx[i] = (i * 37 + 11) & 0xFF;
+        rx[i] = 0xFFFF;
+    }
+    Prepare(&t, &device8, tx, rx, SIM_TRANSFER_BYTES);
+    Check("16-byte transaction accepted", SpiSubmit(&t));
+    cycles = SimRun();
+    busy = LineBusy();
+    overall = (double)sim.busyCycles / cycles;
+    printf("  one transaction: %lu cycles from SpiSubmit, line busy %.1f%% from first to last bit, %.1f%% overall,"
+           " %lu interrupts\n", (unsigned long)cycles, 100.0 * busy, 100.0 * overall, (unsigned long)sim.isrs);
+
+    Check("loop-back data matches", memcmp(tx, rx, sizeof(tx)) == 0);
+    Check("status SPI_DONE, callback called once", t.status == SPI_DONE && completionCount == 1);
+    Check("chip select held for every character", sim.selects == 1 && sim.unselected == 0 &&
+          sim.earlyDeselects == 0 && !sim.selected);
+    Check("no gap between characters", busy >= 0.999);
+    Check("line busy at least 95% from SpiSubmit to completion", overall >= 0.95);
+    Check("no FIFO overflow or underflow, no spurious interrupt", sim.fifoErrors == 0 && sim.spuriousIsrs == 0);
+}
+
+static void TestQueue(void)
+{
+    static const SpiDevice device8 = { SimChipSelect, 8 };
+    SpiTransaction t[SPI_QUEUE_SIZE + 1], empty;
+    Uint16 tx[SPI_QUEUE_SIZE][SIM_TRANSFER_BYTES], rx[SPI_QUEUE_SIZE][SIM_TRANSFER_BYTES];
+    Uint16 i, j, ok = 1;
+    Uint32 cycles, isrCycles, gap;
+    double busy, cpu;
+
+    SimReset(SIM_BRR);
+    for(i = 0; i < SPI_QUEUE_SIZE; i++)
+    {
+        for(j = 0; j < SIM_TRANSFER_BYTES; j++)
+        {
+            tx[i][j] = (i * 29 + j * 7) & 0xFF;
+        }
+        Prepare(&t[i], &device8, tx[i], rx[i], SIM_TRANSFER_BYTES);
+        ok &= SpiSubmit(&t[i]);
+    }
+    Prepare(&t[SPI_QUEUE_SIZE], &device8, tx[0], rx[0], SIM_TRANSFER_BYTES);
+    Prepare(&empty, &device8, tx[0], rx[0], 0);
+    Check("queue of 8 accepted, 9th and empty one rejected",
+          ok && !SpiSubmit(&t[SPI_QUEUE_SIZE]) && !SpiSubmit(&empty) && spiMaster.rejected == 2);
+
+    cycles = SimRun();
+    busy = LineBusy();
+    isrCycles = sim.isrs * SIM_ISR_CYCLES;
+    cpu = (double)isrCycles / cycles;
+    gap = (sim.lastBit - sim.firstBit - sim.busyCycles) / (SPI_QUEUE_SIZE - 1);
+    printf("  %d queued transactions: %lu cycles, line busy %.1f%%, %lu cycles between transactions\n",
+           SPI_QUEUE_SIZE, (unsigned long)cycles, 100.0 * busy, (unsigned long)gap);
+    printf("  %lu interrupts, %.1f%% of the CPU in ISRs\n", (unsigned long)sim.isrs, 100.0 * cpu);
+
+    for(i = 0; i < SPI_QUEUE_SIZE; i++)
+    {
+        ok &= memcmp(tx[i], rx[i], sizeof(tx[i])) == 0 && t[i].status == SPI_DONE;
+    }
+    Check("every transaction looped back its data", ok);
+    ok = completionCount == SPI_QUEUE_SIZE;
+    for(i = 0; i < completionCount; i++)
+    {
+        ok &= completions[i] == &t[i];
+    }
+    Check("completed in submission order", ok && spiMaster.completed == SPI_QUEUE_SIZE);
+    Check("chip select around each transaction", sim.selects == SPI_QUEUE_SIZE && sim.unselected == 0 &&
+          sim.earlyDeselects == 0 && !sim.selected);
+    Check("next transaction starts within one interrupt time", gap <= SIM_ISR_CYCLES + 2);
+    Check("line busy at least 98% across the queue", busy >= 0.98);
+    Check("ISRs take less than 20% of the CPU", cpu < 0.20);
+    Check("no FIFO overflow or underflow, no spurious interrupt", sim.fifoErrors == 0 && sim.spuriousIsrs == 0);
+}
+
+// Characters and SPICHAR switches the engine should use for a transaction, starting from *bits
+static Uint32 ExpectedCharacters(const SpiTransaction *t, Uint16 *bits, Uint32 *switches)
+{
+    if(*bits != t->device->charBits)
+    {
+        *bits = t->device->charBits;
+        (*switches)++;
+    }
+    if(*bits == 8)
+    {
+        return t->length;
+    }
+    if(t->length & 1)
+    {
+        *bits = 8; // Odd tail
+        (*switches)++;
+    }
+    return t->length / 2 + (t->length & 1);
+}
+
+/*
+ * One 63-byte transfer with each character size, as SpiBenchRun in main.c. Either one may take up to four
+ * interrupt times more than the line: starting from SpiSubmit, completing, and for 16-bit characters draining
+ * the FIFO before the odd tail switches SPICHAR.
+ */
+static void TestCharSizes(Uint16 brr, Uint16 interruptPercent)
+{
+    static const SpiDevice device8 = { SimChipSelect, 8 };
+    static const SpiDevice device16 = { SimChipSelect, 16 };
+    const SpiDevice *devices[2] = { &device8, &device16 };
+    SpiTransaction t;
+    Uint16 tx[SIM_BENCH_BYTES], rx[SIM_BENCH_BYTES];
+    Uint32 cycles[2], interrupts[2], line;
+    Uint16 i, mode, ok = 1;
+    char name[64];
+
+    for(i = 0; i < SIM_BENCH_BYTES; i++)
+    {
+        tx[i] = (i * 37 + 11) & 0xFF;
+    }
+    for(mode = 0; mode < 2; mode++)
+    {
+        SimReset(brr);
+        memset(rx, 0, sizeof(rx));
+        Prepare(&t, devices[mode], tx, rx, SIM_BENCH_BYTES);
+        SpiSubmit(&t);
+        cycles[mode] = SimRun();
+        interrupts[mode] = spiMaster.isrCount;
+        ok &= memcmp(tx, rx, sizeof(tx)) == 0 && t.status == SPI_DONE && sim.fifoErrors == 0 &&
+              sim.lateSwitches == 0;
+    }
+    line = SIM_BENCH_BYTES * 8 * sim.bitCycles;
+    printf("  %d bytes at SPIBRR %u (line time %lu cycles):\n", SIM_BENCH_BYTES, brr, (unsigned long)line);
+    printf("    8-bit  %6lu cycles, %3lu RX interrupts, %4.1f%% of the CPU in ISRs\n", (unsigned long)cycles[0],
+           (unsigned long)interrupts[0], 100.0 * (interrupts[0] + 1) * SIM_ISR_CYCLES / cycles[0]);
+    printf("    16-bit %6lu cycles, %3lu RX interrupts, %4.1f%% of the CPU in ISRs\n", (unsigned long)cycles[1],
+           (unsigned long)interrupts[1], 100.0 * (interrupts[1] + 1) * SIM_ISR_CYCLES / cycles[1]);
+
+    sprintf(name, "SPIBRR %u: both sizes loop back the data", brr);
+    Check(name, ok);
+    sprintf(name, "SPIBRR %u: 16-bit, at most %u%% of the interrupts", brr, interruptPercent);
+    Check(name, interrupts[1] * 100 <= interrupts[0] * interruptPercent);
+    sprintf(name, "SPIBRR %u: both within 4 interrupts of the line time", brr);
+    Check(name, cycles[0] <= line + 4 * SIM_ISR_CYCLES && cycles[1] <= line + 4 * SIM_ISR_CYCLES);
+}
+
+// Random batches of queued transactions: both character sizes, odd lengths, missing TX or RX buffers
+static void TestRandomBatches(void)
+{
+    static const SpiDevice device8 = { SimChipSelect, 8 };
+    static const SpiDevice device16 = { SimChipSelect, 16 };
+    static Uint16 tx[SPI_QUEUE_SIZE][SIM_MAX_BYTES], rx[SPI_QUEUE_SIZE][SIM_MAX_BYTES];
+    SpiTransaction t[SPI_QUEUE_SIZE];
+    Uint32 batch, characters = 0, switches = 0, shifted = 0, switched = 0, oddTails = 0;
+    Uint32 dataErrors = 0, orderErrors = 0, hwErrors = 0;
+    Uint16 i, j, count, bits, expected;
+
+    srand(1);
+    for(batch = 0; batch < SIM_BATCHES; batch++)
+    {
+        SimReset((batch & 1) ? SIM_FAST_BRR : SIM_BRR);
+        bits = 8;
+        count = 1 + rand() % SPI_QUEUE_SIZE;
+        for(i = 0; i < count; i++)
+        {
+            Prepare(&t[i], (rand() & 1) ? &device16 : &device8, tx[i], rx[i],
+                    (rand() % 4 != 0) ? 1 + 2 * (rand() % (SIM_MAX_BYTES / 2)) : 2 + 2 * (rand() % (SIM_MAX_BYTES / 2)));
+            for(j = 0; j < t[i].length; j++)
+            {
+                tx[i][j] = rand() & 0xFF;
+                rx[i][j] = 0xFFFF;
+            }
+            if(rand() % 8 == 0)
+            {
+                t[i].tx = 0; // Sends SPI_DUMMY_BYTE
+            }
+            else if(rand() % 8 == 0)
+            {
+                t[i].rx = 0; // Discards the received bytes
+            }
+            oddTails += t[i].device->charBits == 16 && (t[i].length & 1);
+            characters += ExpectedCharacters(&t[i], &bits, &switches);
+            SpiSubmit(&t[i]);
+        }
+        SimRun();
+        if(spiMaster.completed != count)
+        {
+            orderErrors++;
+            break; // Stalled, the rest would only time out too
+        }
+
+        for(i = 0; i < count; i++)
+        {
+            for(j = 0; t[i].rx != 0 && j < t[i].length; j++)
+            {
+                expected = (t[i].tx != 0) ? tx[i][j] : SPI_DUMMY_BYTE;
+                dataErrors += rx[i][j] != expected;
+            }
+            orderErrors += i >= completionCount || completions[i] != &t[i] || t[i].status != SPI_DONE;
+        }
+        hwErrors += sim.fifoErrors + sim.spuriousIsrs + sim.lateSwitches + sim.unselected + sim.earlyDeselects;
+        shifted += sim.characters;
+        switched += sim.charSwitches;
+    }
+    printf("  %d random batches: %lu characters, %lu SPICHAR switches, %lu odd 16-bit tails\n",
+           SIM_BATCHES, (unsigned long)shifted, (unsigned long)switched, (unsigned long)oddTails);
+
+    Check("3000 random batches, odd lengths: bytes loop back", dataErrors == 0);
+    Check("every transaction completes, in order", orderErrors == 0);
+    Check("16-bit packing, one 8-bit character per odd tail", shifted == characters);
+    Check("SPICHAR switched only when needed", switched == switches);
+    Check("no SPICHAR switch with a character in flight", hwErrors == 0);
+}
+
+int main(void)
+{
+    printf("SPI clock %lu Hz, %d CPU cycles per bit, %d cycles per interrupt\n",
+           SYSCLK_HZ / ((SIM_BRR + 1) * SIM_LSPCLK_DIV), (SIM_BRR + 1) * SIM_LSPCLK_DIV, SIM_ISR_CYCLES);
+    TestSingle();
+    TestQueue();
+    TestCharSizes(SIM_BRR, 60);
+    TestCharSizes(SIM_FAST_BRR, 90); // The ISR reads 3 characters at a time, so 8-bit needs fewer interrupts
+    TestRandomBatches();
+    printf(failures ? "%d check(s) failed\n" : "All checks passed\n", failures);
+    return failures != 0;
+}
@@ -2,19 +2,59 @@
  * Author: Kiran Jojare
  * Email: kijo7257@colorado.edu
  * Date: Apr 6, 2024
- * Version: 1.0
+ * Version: 1.3
  *
  * Description:
  * This code demonstrates how to use the SPI (Serial Peripheral Interface) module to communicate with an external SPI device as a master
  * on the Texas Instruments C2000 Piccolo LaunchPad Evaluation Kit (LAUNCHHXL-F28027F). The SPI is configured to communicate at a standard speed of 1 MHz.
  *
  * The code initializes the system control and GPIO settings, configures the SPI module, and communicates with an SPI slave device.
+ * Transfers are described by transaction descriptors (device, TX buffer, RX buffer, length and completion callback) that are
+ * queued with SpiSubmit. The SPI FIFO interrupts move up to 4 characters at a time, so the CPU is free while a multi-byte transfer runs.
+ * Each device selects 8-bit characters or packed 16-bit characters, which carry two bytes per FIFO write and halve the number of
+ * interrupts. The bytes appear on the wire in the same order in both modes.
+ * The SPI is left in loop-back mode, so every received byte should equal the byte sent.
+ *
+ * At startup the same bulk transfer is timed with both character sizes; the results are left in spiBench.
+ *
+ * The transaction engine is in spi_master.c and spi_master.h; add both files from this folder to the project. This file
+ * implements its SpiHw functions on the SPI-A registers, and host/spi_sim.c runs the same engine on a simulated SPI-A.
  *
  * This example is intended to help users get started with basic SPI master operations on the F28027F microcontroller.
  */
 
 #include "F2802x_Device.h"
 #include "f2802x_examples.h"
+#include "spi_master.h"
+
+#define SPI_BRR          14   // LSPCLK 15 MHz / (14 + 1) = 1 MHz SPI clock
+#define SPI_READ_LENGTH  8    // Bytes per demo transaction
+#define SPI_BENCH_LENGTH 63   // Bytes per benchmark transfer, odd to include the 16-bit tail
+#define SPI_BENCH_MODES  2    // 8-bit, packed 16-bit
+
+__interrupt void spia_rx_isr(void);
+__interrupt void spia_tx_isr(void);
+
+typedef struct
+{
+    Uint32 cycles;            // SpiSubmit to completion
+    Uint32 interrupts;        // RX FIFO interrupts for the transfer
+    Uint32 errors;            // Bytes that did not loop back
+} SpiBenchResult;
+
+void SpiChipSelectGpio19(Uint16 active);
+
+const SpiDevice spiDevice8 = { SpiChipSelectGpio19, 8 };
+const SpiDevice spiDevice16 = { SpiChipSelectGpio19, 16 };
+
+Uint16 spiReadTx[SPI_READ_LENGTH];
+Uint16 spiReadRx[SPI_READ_LENGTH];
+SpiTransaction spiRead;
+Uint16 spiBenchTx[SPI_BENCH_LENGTH];
+Uint16 spiBenchRx[SPI_BENCH_LENGTH];
+SpiBenchResult spiBench[SPI_BENCH_MODES]; // 8-bit, packed 16-bit
+volatile Uint32 spiLoopbackErrors; // Received bytes that differ from the bytes sent
+volatile Uint32 mainLoopCount;     // Main loop passes, shows the CPU is free during transfers
 
 void InitGpio()
 {
@@ -22,15 +62,16 @@ void InitGpio()
     GpioCtrlRegs.GPAPUD.bit.GPIO16 = 0; // Enable pull-up on GPIO16 (SPISIMOA)
     GpioCtrlRegs.GPAPUD.bit.GPIO17 = 0; // Enable pull-up on GPIO17 (SPISOMIA)
     GpioCtrlRegs.GPAPUD.bit.GPIO18 = 0; // Enable pull-up on GPIO18 (SPICLKA)
-    GpioCtrlRegs.GPAPUD.bit.GPIO19 = 0; // Enable pull-up on GPIO19 (SPISTEA)
+    GpioCtrlRegs.GPAPUD.bit.GPIO19 = 0; // Enable pull-up on GPIO19 (chip select)
     GpioCtrlRegs.GPAQSEL2.bit.GPIO16 = 3; // Asynchronous input GPIO16 (SPISIMOA)
     GpioCtrlRegs.GPAQSEL2.bit.GPIO17 = 3; // Asynchronous input GPIO17 (SPISOMIA)
     GpioCtrlRegs.GPAQSEL2.bit.GPIO18 = 3; // Asynchronous input GPIO18 (SPICLKA)
-    GpioCtrlRegs.GPAQSEL2.bit.GPIO19 = 3; // Asynchronous input GPIO19 (SPISTEA)
     GpioCtrlRegs.GPAMUX2.bit.GPIO16 = 1;  // Configure GPIO16 as SPISIMOA
     GpioCtrlRegs.GPAMUX2.bit.GPIO17 = 1;  // Configure GPIO17 as SPISOMIA
     GpioCtrlRegs.GPAMUX2.bit.GPIO18 = 1;  // Configure GPIO18 as SPICLKA
-    GpioCtrlRegs.GPAMUX2.bit.GPIO19 = 1;  // Configure GPIO19 as SPISTEA
+    GpioDataRegs.GPASET.bit.GPIO19 = 1;   // Chip select inactive (high)
+    GpioCtrlRegs.GPAMUX2.bit.GPIO19 = 0;  // GPIO19 as GPIO, driven by the chip-select callback
+    GpioCtrlRegs.GPADIR.bit.GPIO19 = 1;   // GPIO19 as output
     EDIS;
 }
 
@@ -40,29 +81,183 @@ void InitSpi()
     SysCtrlRegs.PCLKCR0.bit.SPIAENCLK = 1; // Enable SPI-A clock
     SpiaRegs.SPICCR.all = 0x0047; // 8-bit character, Loop-back mode, Enable SPI
     SpiaRegs.SPICTL.all = 0x0006; // Master mode, Enable transmission
-    SpiaRegs.SPIBRR = 0x007F; // Baud rate
+    SpiaRegs.SPIBRR = SPI_BRR;    // Baud rate
+    SpiaRegs.SPIFFTX.all = 0xC040; // Enable FIFO enhancements, TX FIFO interrupt level 0 (disabled until SpiSubmit)
+    SpiaRegs.SPIFFRX.all = 0x0061; // Enable RX FIFO interrupt, level set per transfer
+    SpiaRegs.SPIFFCT.all = 0x0;    // No delay between characters
     SpiaRegs.SPICCR.bit.SPISWRESET = 1; // Release SPI from reset
+    SpiaRegs.SPIFFTX.bit.TXFIFO = 1;     // Release TX FIFO from reset
+    SpiaRegs.SPIFFRX.bit.RXFIFORESET = 1; // Release RX FIFO from reset
     SpiaRegs.SPIPRI.bit.FREE = 1; // Free run, continue SPI operation
     EDIS;
+
+    SpiMasterInit();
+}
+
+void InitCpuTimer1()
+{
+    EALLOW;
+    CpuTimer1Regs.PRD.all = 0xFFFFFFFF; // Maximum period
+    CpuTimer1Regs.TPR.all = 0;          // Count every SYSCLKOUT cycle
+    CpuTimer1Regs.TPRH.all = 0;
+    CpuTimer1Regs.TCR.bit.TSS = 1;    // Stop the timer
+    CpuTimer1Regs.TCR.bit.TRB = 1;    // Reload the timer
+    CpuTimer1Regs.TCR.bit.TIE = 0;    // No timer interrupt
+    CpuTimer1Regs.TCR.bit.TSS = 0;    // Start the timer
+    EDIS;
+}
+
+// Hardware access for spi_master.c
+void SpiHwCharBits(Uint16 bits)
+{
+    SpiaRegs.SPICCR.bit.SPICHAR = bits - 1;
+}
+
+void SpiHwWrite(Uint16 word)
+{
+    SpiaRegs.SPITXBUF = word;
+}
+
+Uint16 SpiHwRxCount(void)
+{
+    return SpiaRegs.SPIFFRX.bit.RXFFST;
+}
+
+Uint16 SpiHwRead(void)
+{
+    return SpiaRegs.SPIRXBUF;
+}
+
+void SpiHwRxLevel(Uint16 level)
+{
+    SpiaRegs.SPIFFRX.bit.RXFFIL = level;
+}
+
+void SpiHwTxInterrupt(Uint16 enable)
+{
+    SpiaRegs.SPIFFTX.bit.TXFFIENA = enable;
+}
+
+void SpiChipSelectGpio19(Uint16 active)
+{
+    if(active)
+    {
+        GpioDataRegs.GPACLEAR.bit.GPIO19 = 1; // Select the slave (active low)
+    }
+    else
+    {
+        GpioDataRegs.GPASET.bit.GPIO19 = 1;
+    }
 }
 
-void SpiTransmit(Uint16 data)
+// Completion callback, runs in the SPI RX ISR
+void SpiCheckLoopback(SpiTransaction *t)
 {
-    while(SpiaRegs.SPISTS.bit.BUFFULL_FLAG); // Wait if buffer is full
-    SpiaRegs.SPITXBUF = data; // Transmit data
+    Uint16 i;
+
+    for(i = 0; i < t->length; i++)
+    {
+        if(t->rx[i] != (t->tx[i] & 0xFF)) // Loop-back mode returns the bytes sent
+        {
+            spiLoopbackErrors++;
+        }
+    }
+}
+
+// Time one bulk transfer from SpiSubmit to completion with the given device
+void SpiBenchRun(Uint16 mode, const SpiDevice *device)
+{
+    SpiTransaction t;
+    Uint32 start;
+    Uint32 isrStart = spiMaster.isrCount;
+    Uint32 errorStart = spiLoopbackErrors;
+
+    t.device = device;
+    t.tx = spiBenchTx;
+    t.rx = spiBenchRx;
+    t.length = SPI_BENCH_LENGTH;
+    t.done = SpiCheckLoopback;
+
+    start = CpuTimer1Regs.TIM.all;
+    SpiSubmit(&t);
+    while(t.status != SPI_DONE);
+    spiBench[mode].cycles = start - CpuTimer1Regs.TIM.all; // Timer counts down
+    spiBench[mode].interrupts = spiMaster.isrCount - isrStart;
+    spiBench[mode].errors = spiLoopbackErrors - errorStart;
 }
 
 void main(void)
 {
+    Uint16 i;
+    Uint16 pattern = 0;
+
     InitSysCtrl(); // Initialize the CPU and configure the clock
     DINT;          // Disable CPU interrupts
 
     InitGpio();    // Initialize the GPIO
     InitSpi();     // Initialize the SPI
+    InitCpuTimer1(); // Free-running cycle counter
+
+    InitPieCtrl(); // Initialize the PIE control registers
+    InitPieVectTable(); // Initialize the PIE vector table
+
+    EALLOW;
+    PieVectTable.SPIRXINTA = &spia_rx_isr; // Map RX ISR to the PIE vector table
+    PieVectTable.SPITXINTA = &spia_tx_isr; // Map TX ISR to the PIE vector table
+    EDIS;
+
+    IER |= M_INT6; // Enable CPU INT6
+    PieCtrlRegs.PIEIER6.bit.INTx1 = 1; // Enable PIE Group 6 interrupt 1 (SPI-A RX)
+    PieCtrlRegs.PIEIER6.bit.INTx2 = 1; // Enable PIE Group 6 interrupt 2 (SPI-A TX)
+
+    EINT;  // Enable Global interrupt INTM
+    ERTM;  // Enable Global realtime interrupt DBGM
+
+    for(i = 0; i < SPI_BENCH_LENGTH; i++)
+    {
+        spiBenchTx[i] = (i * 37 + 11) & 0xFF;
+    }
+    SpiBenchRun(0, &spiDevice8);
+    SpiBenchRun(1, &spiDevice16);
+
+    spiRead.device = &spiDevice8;
+    spiRead.tx = spiReadTx;
+    spiRead.rx = spiReadRx;
+    spiRead.length = SPI_READ_LENGTH;
+    spiRead.done = SpiCheckLoopback;
+    spiRead.status = SPI_IDLE;
 
     while(1)
     {
-        SpiTransmit(0xA5); // Send data to SPI slave
-        DELAY_US(1000000); // Delay for 1 second
+        if(spiRead.status == SPI_IDLE || spiRead.status == SPI_DONE)
+        {
+            for(i = 0; i < SPI_READ_LENGTH; i++)
+            {
+                spiReadTx[i] = (pattern + i) & 0xFF; // e.g. register address followed by dummy bytes
+            }
+            pattern++;
+            SpiSubmit(&spiRead); // Returns immediately, the ISRs do the transfer
+        }
+
+        mainLoopCount++; // Other work runs here while the transfer is in progress
+        DELAY_US(1000);
     }
 }
+
+__interrupt void spia_rx_isr(void)
+{
+    SpiRxService();
+
+    SpiaRegs.SPIFFRX.bit.RXFFOVFCLR = 1; // Clear overflow flag
+    SpiaRegs.SPIFFRX.bit.RXFFINTCLR = 1; // Clear RX interrupt flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP6; // Acknowledge interrupt
+}
+
+// Only used to start a transaction when the SPI is idle
+__interrupt void spia_tx_isr(void)
+{
+    SpiTxService();
+
+    SpiaRegs.SPIFFTX.bit.TXFFINTCLR = 1; // Clear TX interrupt flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP6; // Acknowledge interrupt
+}
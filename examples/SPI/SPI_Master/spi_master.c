@@ -0,0 +1,188 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Transaction queue and FIFO handling of the SPI master engine (see spi_master.h).
+ */
+
+#include "spi_master.h"
+
+#if (SPI_QUEUE_SIZE & (SPI_QUEUE_SIZE - 1)) != 0
+#error "SPI_QUEUE_SIZE must be a power of two"
+#endif
+
+#ifdef __TMS320C2000__
+#define RING_BARRIER()
+#else
+#define RING_BARRIER() __sync_synchronize()
+#endif
+
+SpiMaster spiMaster;
+
+void SpiMasterInit(void)
+{
+    spiMaster.head = 0;
+    spiMaster.tail = 0;
+    spiMaster.active = 0;
+    spiMaster.inFlight = 0;
+    spiMaster.charBits = 8; // InitSpi sets 8-bit characters
+}
+
+// Queue a transaction without waiting; returns 0 if the queue is full or the transaction is empty
+Uint16 SpiSubmit(SpiTransaction *t)
+{
+    Uint16 head = spiMaster.head;
+
+    if(t->length == 0 || (Uint16)(head - spiMaster.tail) >= SPI_QUEUE_SIZE)
+    {
+        spiMaster.rejected++;
+        return 0;
+    }
+    t->status = SPI_QUEUED;
+    spiMaster.queue[head & (SPI_QUEUE_SIZE - 1)] = t;
+    RING_BARRIER(); // Descriptor is visible before the new head
+    spiMaster.head = head + 1;
+    SpiHwTxInterrupt(1); // SpiTxService starts the transaction if the SPI is idle
+    return 1;
+}
+
+// Only called with no characters in flight, so no character is shifted with the wrong length
+static void SpiSetCharBits(Uint16 bits)
+{
+    if(spiMaster.charBits != bits)
+    {
+        SpiHwCharBits(bits);
+        spiMaster.charBits = bits;
+    }
+}
+
+static Uint16 SpiTxByte(const SpiTransaction *t, Uint16 i)
+{
+    return (t->tx != 0) ? (t->tx[i] & 0xFF) : SPI_DUMMY_BYTE;
+}
+
+// Keep up to SPI_FIFO_DEPTH characters in flight, which also keeps the RX FIFO from overflowing
+static void SpiFill(SpiTransaction *t)
+{
+    Uint16 word;
+
+    if(spiMaster.charBits == 16 && spiMaster.inFlight == 0 && t->length - spiMaster.sent == 1)
+    {
+        SpiSetCharBits(8); // Odd tail: the last byte goes out as an 8-bit character
+    }
+
+    while(spiMaster.inFlight < SPI_FIFO_DEPTH && spiMaster.sent < t->length)
+    {
+        if(spiMaster.charBits == 16)
+        {
+            if(t->length - spiMaster.sent < 2)
+            {
+                break; // Odd tail waits until the 16-bit characters are done
+            }
+            word = (SpiTxByte(t, spiMaster.sent) << 8) | SpiTxByte(t, spiMaster.sent + 1); // First byte is shifted out first
+            spiMaster.sent += 2;
+        }
+        else
+        {
+            word = SpiTxByte(t, spiMaster.sent) << 8; // TX data is left-justified in SPITXBUF
+            spiMaster.sent++;
+        }
+        SpiHwWrite(word);
+        spiMaster.inFlight++;
+    }
+    SpiHwRxLevel((spiMaster.inFlight < SPI_RX_LEVEL) ? spiMaster.inFlight : SPI_RX_LEVEL);
+}
+
+// ISR context only: take the next queued transaction, or go idle
+static void SpiStartNext(void)
+{
+    SpiTransaction *t;
+
+    if(spiMaster.tail == spiMaster.head)
+    {
+        spiMaster.active = 0;
+        return;
+    }
+    RING_BARRIER(); // Read the descriptor only after seeing the new head
+    t = spiMaster.queue[spiMaster.tail & (SPI_QUEUE_SIZE - 1)];
+    spiMaster.tail++;
+
+    spiMaster.active = t;
+    spiMaster.sent = 0;
+    spiMaster.received = 0;
+    t->status = SPI_ACTIVE;
+    SpiSetCharBits(t->device->charBits);
+    if(t->device->chipSelect != 0)
+    {
+        t->device->chipSelect(1);
+    }
+    SpiFill(t);
+}
+
+void SpiRxService(void)
+{
+    SpiTransaction *t = spiMaster.active;
+    Uint16 count = SpiHwRxCount(); // Read every received character
+    Uint16 word;
+
+    while(count--)
+    {
+        word = SpiHwRead(); // RX data is right-justified in SPIRXBUF
+        if(t != 0 && spiMaster.inFlight != 0)
+        {
+            spiMaster.inFlight--;
+            if(spiMaster.charBits == 16)
+            {
+                if(t->rx != 0)
+                {
+                    t->rx[spiMaster.received] = word >> 8;
+                    t->rx[spiMaster.received + 1] = word & 0xFF;
+                }
+                spiMaster.received += 2;
+            }
+            else
+            {
+                if(t->rx != 0)
+                {
+                    t->rx[spiMaster.received] = word & 0xFF;
+                }
+                spiMaster.received++;
+            }
+        }
+    }
+    spiMaster.isrCount++;
+
+    if(t != 0)
+    {
+        if(spiMaster.received == t->length)
+        {
+            if(t->device->chipSelect != 0)
+            {
+                t->device->chipSelect(0);
+            }
+            t->status = SPI_DONE;
+            spiMaster.completed++;
+            if(t->done != 0)
+            {
+                t->done(t);
+            }
+            SpiStartNext(); // Back-to-back transactions without returning to the main loop
+        }
+        else
+        {
+            SpiFill(t);
+        }
+    }
+}
+
+void SpiTxService(void)
+{
+    SpiHwTxInterrupt(0);
+    if(spiMaster.active == 0)
+    {
+        SpiStartNext();
+    }
+}
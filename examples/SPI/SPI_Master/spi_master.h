@@ -0,0 +1,92 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Interrupt-driven SPI master transaction engine for the SPI_Master example. Transactions (device, TX buffer, RX buffer,
+ * length and completion callback) are queued with SpiSubmit and run back to back from the SPI interrupts, keeping up to
+ * SPI_FIFO_DEPTH characters in flight. Each device selects 8-bit characters or packed 16-bit characters, which carry two
+ * bytes per FIFO write; the bytes appear on the wire in the same order in both modes.
+ *
+ * The engine only touches the SPI module through the SpiHw functions at the end of this file. They are implemented on the
+ * registers in main.c, and by a simulated SPI-A with cycle timing in host/spi_sim.c, so the same engine runs on the C28x
+ * and on a host.
+ */
+
+#ifndef SPI_MASTER_H
+#define SPI_MASTER_H
+
+#ifdef __TMS320C2000__
+#include "F2802x_Device.h"
+#else
+#include <stdint.h>
+typedef uint16_t Uint16;
+typedef uint32_t Uint32;
+#endif
+
+#define SPI_FIFO_DEPTH   4    // SPI-A TX/RX FIFO depth
+#define SPI_RX_LEVEL     2    // RX FIFO interrupt level; later characters keep shifting while the ISR runs
+#define SPI_QUEUE_SIZE   8    // Queued transactions (power of two)
+#define SPI_DUMMY_BYTE   0xFF // Sent when a transaction has no TX buffer
+
+// Transaction status
+#define SPI_IDLE    0
+#define SPI_QUEUED  1
+#define SPI_ACTIVE  2
+#define SPI_DONE    3
+
+typedef struct
+{
+    void (*chipSelect)(Uint16 active);   // Called with 1 before the first byte and 0 after the last, may be 0
+    Uint16 charBits;                     // 8, or 16 to pack two bytes per SPI character
+} SpiDevice;
+
+typedef struct SpiTransaction SpiTransaction;
+
+struct SpiTransaction
+{
+    const SpiDevice *device;
+    const Uint16 *tx;                    // Bytes to send, one per word; 0 sends SPI_DUMMY_BYTE
+    Uint16 *rx;                          // Received bytes, one per word; 0 discards them
+    Uint16 length;                       // Number of bytes
+    void (*done)(SpiTransaction *t);     // Called from the ISR when the transfer is complete, may be 0
+    volatile Uint16 status;              // SPI_IDLE, SPI_QUEUED, SPI_ACTIVE or SPI_DONE
+};
+
+/*
+ * Transaction queue. SpiSubmit (main loop) is the only writer of head and the
+ * ISRs are the only writers of tail, like the UART_Communication ring buffer.
+ */
+typedef struct
+{
+    SpiTransaction *queue[SPI_QUEUE_SIZE];
+    volatile Uint16 head;     // Next free slot (main loop)
+    volatile Uint16 tail;     // Next transaction to start (ISR)
+    SpiTransaction *active;   // Transaction on the bus, 0 when idle
+    Uint16 sent;              // Bytes of the active transaction written to the TX FIFO
+    Uint16 received;          // Bytes of the active transaction read from the RX FIFO
+    Uint16 inFlight;          // Characters written to the TX FIFO and not yet read back
+    Uint16 charBits;          // Current SPICCR character length
+    Uint32 completed;         // Transactions finished
+    Uint32 rejected;          // SpiSubmit calls refused because the queue was full
+    Uint32 isrCount;          // RX FIFO interrupts serviced
+} SpiMaster;
+
+extern SpiMaster spiMaster;
+
+void SpiMasterInit(void);
+Uint16 SpiSubmit(SpiTransaction *t);
+void SpiRxService(void);      // Body of the RX FIFO interrupt
+void SpiTxService(void);      // Body of the TX FIFO interrupt, starts a transaction when the SPI is idle
+
+// Hardware access, implemented in main.c (registers) and host/spi_sim.c (simulated SPI-A)
+void SpiHwCharBits(Uint16 bits);                    // SPICCR.SPICHAR = bits - 1
+void SpiHwWrite(Uint16 word);                       // SPITXBUF, left-justified
+Uint16 SpiHwRxCount(void);                          // Characters in the RX FIFO
+Uint16 SpiHwRead(void);                             // SPIRXBUF, right-justified
+void SpiHwRxLevel(Uint16 level);                    // RX FIFO interrupt level
+void SpiHwTxInterrupt(Uint16 enable);               // Interrupt while the TX FIFO is empty
+
+#endif // SPI_MASTER_H
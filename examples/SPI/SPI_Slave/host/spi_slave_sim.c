@@ -0,0 +1,353 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Runs the SPI_Slave double buffer (spi_slave.c) on a Linux host against a simulated SPI-A in slave mode and a master
+ * that clocks 8-bit words at 1 MHz (480 CPU cycles per word at 60 MHz) with no gap between the words of a frame. The
+ * model steps one CPU cycle at a time. The slave loads SPIDAT from the TX FIFO when the master starts a word; if the
+ * FIFO is empty it counts an underrun and sends what is left in SPIDAT. The RX FIFO interrupt (RXFFST at least
+ * SPI_RX_LEVEL) and XINT1 (chip select released, higher priority) keep the CPU for SIM_ISR_CYCLES each and run
+ * SpiSlaveRxService or SpiSlaveFrameEnd at the end. The rest of the CPU time goes to a main loop that builds a
+ * response one word at a time, so the interrupts preempt it mid-frame, and publishes it at random points.
+ *
+ * The master sends 100k frames, most of them SPI_FRAME_WORDS long and the rest shorter or longer, and leaves at
+ * least SIM_GAP_MIN cycles between them. Every response carries a sequence number in all of its words, so a frame
+ * that mixes two responses is detected. The exit status is 1 if any check fails.
+ *
+ * Build: gcc -O2 -I.. -o spi_slave_sim spi_slave_sim.c ../spi_slave.c
+ */
+
+#include "spi_slave.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SIM_WORD_CYCLES   (SPI_CHAR_BITS * 60) // 1 MHz SPI clock, 60 CPU cycles per bit
+#define SIM_ISR_CYCLES    160      // CPU cycles from interrupt request to the end of the ISR
+#define SIM_GAP_MIN       (2 * SIM_ISR_CYCLES + 40) // An RX FIFO ISR may still run when chip select rises
+#define SIM_GAP_MAX       2000
+#define SIM_MAX_WORDS     12       // Longest master frame
+#define SIM_FRAMES        100000L
+
+typedef struct
+{
+    // SPI-A, slave mode
+    Uint16 txFifo[SPI_FIFO_DEPTH];
+    Uint16 txCount;
+    Uint16 rxFifo[SPI_FIFO_DEPTH];
+    Uint16 rxCount;
+    Uint16 shiftWord;       // SPIDAT
+    Uint32 underruns;       // Words started with an empty TX FIFO
+    Uint32 fifoErrors;      // Writes to a full TX FIFO, reads of an empty RX FIFO and RX FIFO overflows
+
+    // Master
+    Uint16 selected;        // Chip select active
+    Uint16 length;          // Words in the current frame
+    Uint16 index;           // Word being clocked
+    Uint16 sent[SIM_MAX_WORDS];
+    Uint16 received[SIM_MAX_WORDS];
+    Uint32 wordLeft;        // Cycles until the current word is done
+    Uint32 gapLeft;         // Cycles until the next frame starts
+    long frames;
+    long shortFrames;
+    long longFrames;
+    Uint16 lastLength;      // Length of the frame that SpiSlaveFrameEnd closes
+    Uint16 lastSent[SIM_MAX_WORDS];
+
+    // CPU
+    Uint32 isrLeft;         // Cycles until the running ISR ends, 0 when no ISR runs
+    Uint16 isrXint;         // The running ISR is XINT1
+    Uint16 xintPending;     // Chip-select rising edge latched
+    Uint32 isrCycles;
+    Uint32 now;
+
+    // Main loop
+    Uint16 *frame;          // Buffer being built, 0 between responses
+    Uint16 word;            // Next word of the buffer to write
+    Uint32 mainLeft;        // Cycles until the main loop's next step
+    Uint32 seq;             // Sequence number of the next response
+    Uint32 published;       // Sequence number of the last published response, 0 before the first
+    Uint16 unsent;          // A response was published after the last frame end
+
+    // Results
+    Uint32 expected;        // Sequence number the current frame must carry, 0 for the reset contents
+    long torn;              // Frames with words from more than one response
+    long stale;             // Consistent frames that are not the newest published response
+    long rxErrors;          // Master words not stored in spiSlave.rx
+    long distinct;          // Published responses the master has seen
+    Uint32 lastSeen;
+} SpiSlaveSim;
+
+static SpiSlaveSim sim;
+static int failures;
+
+// Hardware access for spi_slave.c
+void SpiSlaveHwReset(void)
+{
+    sim.txCount = 0;
+    sim.rxCount = 0;
+    sim.shiftWord = 0;
+}
+
+Uint16 SpiSlaveHwTxCount(void)
+{
+    return sim.txCount;
+}
+
+void SpiSlaveHwWrite(Uint16 word)
+{
+    if(sim.txCount == SPI_FIFO_DEPTH)
+    {
+        sim.fifoErrors++;
+        return;
+    }
+    sim.txFifo[sim.txCount++] = word;
+}
+
+Uint16 SpiSlaveHwRxCount(void)
+{
+    return sim.rxCount;
+}
+
+Uint16 SpiSlaveHwRead(void)
+{
+    Uint16 word;
+
+    if(sim.rxCount == 0)
+    {
+        sim.fifoErrors++;
+        return 0;
+    }
+    word = sim.rxFifo[0];
+    memmove(&sim.rxFifo[0], &sim.rxFifo[1], (--sim.rxCount) * sizeof(sim.rxFifo[0]));
+    return word;
+}
+
+// Word i of response seq; every word depends on seq, so words of two responses never fit one sequence number
+static Uint16 ResponseWord(Uint32 seq, Uint16 i)
+{
+    if(seq == 0)
+    {
+        return 0; // Reset contents of the buffers
+    }
+    return (Uint16)((seq + i * 37) & 0xFF);
+}
+
+static void Check(const char *name, int ok)
+{
+    printf("  %-52s %s\n", name, ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        failures++;
+    }
+}
+
+// Compare what the master read with the response it should have got
+static void MasterFrameDone(void)
+{
+    Uint16 i, n = (sim.length < SPI_FRAME_WORDS) ? sim.length : SPI_FRAME_WORDS;
+    Uint32 seq;
+    int consistent = 1;
+
+    // The sequence number is recovered from the first word: (seq + 0 * 37) & 0xFF, or the reset contents
+    seq = (sim.received[0] == 0 && sim.expected == 0) ? 0 : (sim.expected & ~0xFFUL) | sim.received[0];
+    for(i = 0; i < sim.length; i++)
+    {
+        consistent &= sim.received[i] == ((i < n) ? ResponseWord(seq, i) : SPI_PAD_WORD);
+    }
+    if(!consistent)
+    {
+        sim.torn++;
+    }
+    else if(seq != sim.expected)
+    {
+        sim.stale++;
+    }
+    if(consistent && seq != 0 && seq != sim.lastSeen)
+    {
+        sim.distinct++;
+        sim.lastSeen = seq;
+    }
+
+    sim.frames++;
+    sim.shortFrames += sim.length < SPI_FRAME_WORDS;
+    sim.longFrames += sim.length > SPI_FRAME_WORDS;
+    sim.lastLength = sim.length;
+    memcpy(sim.lastSent, sim.sent, sizeof(sim.sent));
+}
+
+static void MasterStep(void)
+{
+    Uint16 i;
+
+    if(!sim.selected)
+    {
+        if(sim.frames == SIM_FRAMES || --sim.gapLeft != 0)
+        {
+            return;
+        }
+        sim.selected = 1;
+        sim.length = (rand() % 4 != 0) ? SPI_FRAME_WORDS : 1 + rand() % SIM_MAX_WORDS;
+        for(i = 0; i < sim.length; i++)
+        {
+            sim.sent[i] = rand() & 0xFF;
+        }
+        sim.index = 0;
+        sim.wordLeft = 0;
+    }
+    if(sim.wordLeft == 0)
+    {
+        if(sim.index == sim.length)
+        {
+            sim.selected = 0; // Release chip select, the rising edge raises XINT1
+            sim.xintPending = 1;
+            sim.gapLeft = SIM_GAP_MIN + rand() % (SIM_GAP_MAX - SIM_GAP_MIN);
+            MasterFrameDone();
+            return;
+        }
+        if(sim.txCount != 0) // First clock edge: SPIDAT takes the next TX word
+        {
+            sim.shiftWord = sim.txFifo[0];
+            memmove(&sim.txFifo[0], &sim.txFifo[1], (--sim.txCount) * sizeof(sim.txFifo[0]));
+        }
+        else
+        {
+            sim.underruns++;
+        }
+        sim.wordLeft = SIM_WORD_CYCLES;
+    }
+    if(--sim.wordLeft == 0)
+    {
+        // SPIDAT shifts out its top bits and takes the master's word in at the bottom
+        sim.received[sim.index] = (sim.shiftWord >> SPI_TX_SHIFT) & SPI_RX_MASK;
+        sim.shiftWord = (Uint16)((sim.shiftWord << SPI_CHAR_BITS) | sim.sent[sim.index]);
+        if(sim.rxCount == SPI_FIFO_DEPTH)
+        {
+            sim.fifoErrors++; // RXFFOVF, the word is lost
+        }
+        else
+        {
+            sim.rxFifo[sim.rxCount++] = sim.shiftWord;
+        }
+        sim.index++;
+    }
+}
+
+// Main loop: build the next response one word at a time and publish it
+static void MainStep(void)
+{
+    if(sim.mainLeft != 0 && --sim.mainLeft != 0)
+    {
+        return;
+    }
+    if(sim.frame == 0)
+    {
+        sim.frame = SpiSlaveBeginFrame();
+        sim.word = 0;
+        sim.mainLeft = 1 + rand() % 100;
+        return;
+    }
+    if(sim.word < SPI_FRAME_WORDS)
+    {
+        sim.frame[sim.word] = ResponseWord(sim.seq, sim.word);
+        sim.word++;
+        sim.mainLeft = 1 + rand() % 100; // ISRs may run between any two words
+        return;
+    }
+    SpiSlavePublish();
+    sim.published = sim.seq++;
+    sim.unsent = 1;
+    sim.frame = 0;
+    sim.mainLeft = 1 + rand() % 6000; // Other work in the main loop
+}
+
+static void FrameEnd(void)
+{
+    Uint16 i, n;
+
+    SpiSlaveFrameEnd();
+
+    n = (sim.lastLength < SPI_FRAME_WORDS) ? sim.lastLength : SPI_FRAME_WORDS;
+    if(spiSlave.rxLength != sim.lastLength)
+    {
+        sim.rxErrors++;
+    }
+    for(i = 0; i < n; i++)
+    {
+        sim.rxErrors += spiSlave.rx[i] != sim.lastSent[i];
+    }
+    if(sim.unsent)
+    {
+        sim.expected = sim.published; // The next frame carries the newest published response
+        sim.unsent = 0;
+    }
+}
+
+static void SimStep(void)
+{
+    MasterStep();
+
+    if(sim.isrLeft != 0)
+    {
+        sim.isrCycles++;
+        if(--sim.isrLeft == 0)
+        {
+            if(sim.isrXint)
+            {
+                FrameEnd();
+            }
+            else
+            {
+                SpiSlaveRxService();
+            }
+        }
+    }
+    else if(sim.xintPending)
+    {
+        sim.xintPending = 0;
+        sim.isrXint = 1;
+        sim.isrLeft = SIM_ISR_CYCLES;
+    }
+    else if(sim.rxCount >= SPI_RX_LEVEL)
+    {
+        sim.isrXint = 0;
+        sim.isrLeft = SIM_ISR_CYCLES;
+    }
+    else
+    {
+        MainStep();
+    }
+    sim.now++;
+}
+
+int main(void)
+{
+    srand(1);
+    sim.seq = 1;
+    sim.gapLeft = SIM_GAP_MIN;
+    SpiSlaveInit();
+
+    while(sim.frames < SIM_FRAMES || sim.xintPending || sim.isrLeft != 0)
+    {
+        SimStep();
+    }
+
+    printf("%ld frames (%ld short, %ld long), %lu responses published, %ld seen by the master\n",
+           sim.frames, sim.shortFrames, sim.longFrames, (unsigned long)sim.published, sim.distinct);
+    printf("%.1f%% of the CPU in ISRs\n", 100.0 * sim.isrCycles / sim.now);
+
+    Check("100k frames, no torn frames", sim.frames == SIM_FRAMES && sim.torn == 0);
+    Check("every frame is the newest published response", sim.stale == 0);
+    Check("every published response reaches the master", sim.distinct + 1 >= (long)sim.published); // Bar the last
+    Check("master words stored in spiSlave.rx", sim.rxErrors == 0);
+    Check("frames, short and long frames counted", spiSlave.frames == (Uint32)sim.frames &&
+          spiSlave.shortFrames == (Uint32)sim.shortFrames && spiSlave.longFrames == (Uint32)sim.longFrames);
+    Check("no TX FIFO underrun, no FIFO overflow", sim.underruns == 0 && sim.fifoErrors == 0);
+
+    printf(failures ? "%d check(s) failed\n" : "All checks passed\n", failures);
+    return failures != 0;
+}
@@ -2,19 +2,33 @@
  * Author: Kiran Jojare
  * Email: kijo7257@colorado.edu
  * Date: Apr 21, 2024
- * Version: 1.0
+ * Version: 1.2
  *
  * Description:
  * This code demonstrates how to use the SPI (Serial Peripheral Interface) module to communicate with an external SPI device as a slave
  * on the Texas Instruments C2000 Piccolo LaunchPad Evaluation Kit (LAUNCHHXL-F28027F). The SPI is configured to communicate at a standard speed of 1 MHz.
  *
  * The code initializes the system control and GPIO settings, configures the SPI module as a slave, and communicates with an SPI master device.
+ * The application publishes its next response frame into a double buffer ahead of time. When the master releases chip select (SPISTEA),
+ * an external interrupt swaps the buffers and preloads the SPI TX FIFO with the start of the new frame, so the response is ready before the
+ * master's next clock edge. The SPI RX FIFO interrupt keeps the TX FIFO topped up for the rest of the frame, so the master always reads
+ * one consistent frame at the full clock rate.
+ *
+ * The double buffer is in spi_slave.c and spi_slave.h; add both files from this folder to the project. This file implements
+ * its SpiSlaveHw functions on the SPI-A registers, and host/spi_slave_sim.c runs the same code against a simulated master.
  *
  * This example is intended to help users get started with basic SPI slave operations on the F28027F microcontroller.
  */
 
 #include "F2802x_Device.h"
 #include "f2802x_examples.h"
+#include "spi_slave.h"
+
+__interrupt void spia_rx_isr(void);
+__interrupt void xint1_isr(void);
+
+volatile Uint32 spiPublishSkipped; // Updates skipped because the previous frame had not been sent yet
+volatile Uint32 mainLoopCount;
 
 void InitGpio()
 {
@@ -31,36 +45,79 @@ void InitGpio()
     GpioCtrlRegs.GPAMUX2.bit.GPIO17 = 1;  // Configure GPIO17 as SPISOMIA
     GpioCtrlRegs.GPAMUX2.bit.GPIO18 = 1;  // Configure GPIO18 as SPICLKA
     GpioCtrlRegs.GPAMUX2.bit.GPIO19 = 1;  // Configure GPIO19 as SPISTEA
+    GpioIntRegs.GPIOXINT1SEL.bit.GPIOSEL = 19; // XINT1 also watches GPIO19 (SPISTEA)
     EDIS;
+
+    XIntruptRegs.XINT1CR.bit.POLARITY = 1; // Interrupt on the rising edge (chip select released)
+    XIntruptRegs.XINT1CR.bit.ENABLE = 1;   // Enable XINT1
 }
 
 void InitSpi()
 {
     EALLOW;
     SysCtrlRegs.PCLKCR0.bit.SPIAENCLK = 1; // Enable SPI-A clock
-    SpiaRegs.SPICCR.all = 0x0047; // 8-bit character, Loop-back mode, Enable SPI
-    SpiaRegs.SPICTL.all = 0x0006; // Slave mode, Enable transmission
-    SpiaRegs.SPIBRR = 0x007F; // Baud rate
-    SpiaRegs.SPICCR.bit.SPISWRESET = 1; // Release SPI from reset
+    SpiaRegs.SPICCR.all = 0x0007; // 8-bit character, Enable SPI
+    SpiaRegs.SPICTL.all = 0x0002; // Slave mode, Enable transmission
+    SpiaRegs.SPIBRR = 0x007F; // Baud rate (used in master mode only, the master provides the clock)
+    SpiaRegs.SPIFFTX.all = 0xC040; // Enable FIFO enhancements, TX FIFO interrupt not used
+    SpiaRegs.SPIFFRX.all = 0x0060 | SPI_RX_LEVEL; // Enable RX FIFO interrupt
+    SpiaRegs.SPIFFCT.all = 0x0;
     SpiaRegs.SPIPRI.bit.FREE = 1; // Free run, continue SPI operation
     EDIS;
+
+    SpiSlaveInit(); // Releases the SPI and FIFOs from reset with the first words loaded
+}
+
+// Hardware access for spi_slave.c
+void SpiSlaveHwReset(void)
+{
+    SpiaRegs.SPICCR.bit.SPISWRESET = 0;  // Clear the shift register
+    SpiaRegs.SPIFFTX.bit.TXFIFO = 0;     // Reset TX FIFO
+    SpiaRegs.SPIFFRX.bit.RXFIFORESET = 0; // Reset RX FIFO
+    SpiaRegs.SPICCR.bit.SPISWRESET = 1;
+    SpiaRegs.SPIFFTX.bit.TXFIFO = 1;
+    SpiaRegs.SPIFFRX.bit.RXFIFORESET = 1;
+    SpiaRegs.SPIFFRX.bit.RXFFOVFCLR = 1;  // Clear overflow flag
+    SpiaRegs.SPIFFRX.bit.RXFFINTCLR = 1;  // Clear RX interrupt flag
+}
+
+Uint16 SpiSlaveHwTxCount(void)
+{
+    return SpiaRegs.SPIFFTX.bit.TXFFST;
+}
+
+void SpiSlaveHwWrite(Uint16 word)
+{
+    SpiaRegs.SPITXBUF = word;
+}
+
+Uint16 SpiSlaveHwRxCount(void)
+{
+    return SpiaRegs.SPIFFRX.bit.RXFFST;
 }
 
-Uint16 SpiReceive()
+Uint16 SpiSlaveHwRead(void)
 {
-    while(SpiaRegs.SPISTS.bit.INT_FLAG == 0); // Wait for data
-    return SpiaRegs.SPIRXBUF; // Receive data
+    return SpiaRegs.SPIRXBUF;
 }
 
-void SpiTransmit(Uint16 data)
+// Example response: a sequence number at both ends lets the master check that the frame is consistent
+void BuildResponse(Uint16 *frame, Uint16 seq, Uint32 count)
 {
-    while(SpiaRegs.SPISTS.bit.BUFFULL_FLAG); // Wait if buffer is full
-    SpiaRegs.SPITXBUF = data; // Transmit data
+    frame[0] = seq & 0xFF;
+    frame[1] = count & 0xFF;
+    frame[2] = (count >> 8) & 0xFF;
+    frame[3] = (count >> 16) & 0xFF;
+    frame[4] = (count >> 24) & 0xFF;
+    frame[5] = spiSlave.rx[0] & 0xFF; // First word of the last request, e.g. a command
+    frame[6] = spiSlave.rxLength & 0xFF;
+    frame[7] = seq & 0xFF;
 }
 
 void main(void)
 {
-    Uint16 receivedData;
+    Uint16 *frame;
+    Uint16 seq = 0;
 
     InitSysCtrl(); // Initialize the CPU and configure the clock
     DINT;          // Disable CPU interrupts
@@ -68,9 +125,53 @@ void main(void)
     InitGpio();    // Initialize the GPIO
     InitSpi();     // Initialize the SPI
 
+    InitPieCtrl(); // Initialize the PIE control registers
+    InitPieVectTable(); // Initialize the PIE vector table
+
+    EALLOW;
+    PieVectTable.SPIRXINTA = &spia_rx_isr; // Map SPI RX ISR to the PIE vector table
+    PieVectTable.XINT1 = &xint1_isr;       // Map chip-select ISR to the PIE vector table
+    EDIS;
+
+    IER |= M_INT1; // Enable CPU INT1 (XINT1)
+    IER |= M_INT6; // Enable CPU INT6 (SPI-A)
+    PieCtrlRegs.PIEIER1.bit.INTx4 = 1; // Enable PIE Group 1 interrupt 4 (XINT1)
+    PieCtrlRegs.PIEIER6.bit.INTx1 = 1; // Enable PIE Group 6 interrupt 1 (SPI-A RX)
+
+    EINT;  // Enable Global interrupt INTM
+    ERTM;  // Enable Global realtime interrupt DBGM
+
     while(1)
     {
-        receivedData = SpiReceive(); // Receive data from SPI master
-        SpiTransmit(receivedData); // Echo received data back to SPI master
+        frame = SpiSlaveBeginFrame();
+        if(frame != 0)
+        {
+            BuildResponse(frame, seq++, mainLoopCount); // Takes as long as it needs, the ISRs never read this buffer
+            SpiSlavePublish();
+        }
+        else
+        {
+            spiPublishSkipped++;
+        }
+
+        mainLoopCount++; // Other work runs here, the SPI needs no polling
+        DELAY_US(100);
     }
 }
+
+__interrupt void spia_rx_isr(void)
+{
+    SpiSlaveRxService();
+
+    SpiaRegs.SPIFFRX.bit.RXFFOVFCLR = 1; // Clear overflow flag
+    SpiaRegs.SPIFFRX.bit.RXFFINTCLR = 1; // Clear RX interrupt flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP6; // Acknowledge interrupt
+}
+
+// Chip select released: the frame is over, so switch to the newest published buffer and arm the next frame
+__interrupt void xint1_isr(void)
+{
+    SpiSlaveFrameEnd();
+
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP1; // Acknowledge interrupt
+}
@@ -0,0 +1,118 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Response buffers and FIFO handling of the SPI slave (see spi_slave.h).
+ */
+
+#include "spi_slave.h"
+
+SpiSlave spiSlave;
+
+// Load the TX FIFO from the front buffer until it is full
+static void SpiSlaveFill(void)
+{
+    const Uint16 *frame = spiSlave.tx[spiSlave.front];
+
+    while(SpiSlaveHwTxCount() < SPI_FIFO_DEPTH)
+    {
+        if(spiSlave.txPos < SPI_FRAME_WORDS)
+        {
+            SpiSlaveHwWrite(frame[spiSlave.txPos++] << SPI_TX_SHIFT);
+        }
+        else
+        {
+            SpiSlaveHwWrite(SPI_PAD_WORD << SPI_TX_SHIFT);
+        }
+    }
+}
+
+// Discard what is left of the last frame and preload the first words of the next one
+static void SpiSlaveArm(void)
+{
+    SpiSlaveHwReset();
+    spiSlave.txPos = 0;
+    spiSlave.rxPos = 0;
+    SpiSlaveFill();
+}
+
+void SpiSlaveInit(void)
+{
+    spiSlave.front = 0;
+    spiSlave.pending = 0;
+    SpiSlaveArm();
+}
+
+// Returns the buffer to fill with the next response, or 0 if the last published one has not been sent yet
+Uint16 *SpiSlaveBeginFrame(void)
+{
+    if(spiSlave.pending)
+    {
+        return 0;
+    }
+    return spiSlave.tx[spiSlave.front ^ 1];
+}
+
+// Hand the buffer from SpiSlaveBeginFrame to the ISR; it is sent from the next frame on
+void SpiSlavePublish(void)
+{
+    spiSlave.pending = 1;
+}
+
+void SpiSlaveRxService(void)
+{
+    Uint16 count = SpiSlaveHwRxCount(); // Read every received word
+    Uint16 word;
+
+    while(count--)
+    {
+        word = SpiSlaveHwRead() & SPI_RX_MASK;
+        if(spiSlave.rxPos < SPI_FRAME_WORDS)
+        {
+            spiSlave.rx[spiSlave.rxPos] = word;
+        }
+        spiSlave.rxPos++;
+    }
+    SpiSlaveFill(); // Keep the next words ready
+}
+
+// Chip select released: the frame is over, so switch to the newest published buffer and arm the next frame
+void SpiSlaveFrameEnd(void)
+{
+    Uint16 word;
+
+    while(SpiSlaveHwRxCount() != 0) // Words below the RX FIFO interrupt level
+    {
+        word = SpiSlaveHwRead() & SPI_RX_MASK;
+        if(spiSlave.rxPos < SPI_FRAME_WORDS)
+        {
+            spiSlave.rx[spiSlave.rxPos] = word;
+        }
+        spiSlave.rxPos++;
+    }
+
+    if(spiSlave.rxPos != 0) // Ignore glitches without any clocks
+    {
+        if(spiSlave.rxPos < SPI_FRAME_WORDS)
+        {
+            spiSlave.shortFrames++;
+        }
+        else if(spiSlave.rxPos > SPI_FRAME_WORDS)
+        {
+            spiSlave.longFrames++;
+        }
+        spiSlave.rxLength = spiSlave.rxPos;
+        spiSlave.frames++;
+
+        if(spiSlave.pending)
+        {
+            spiSlave.front ^= 1;
+            spiSlave.pending = 0; // The old front buffer is free for the main loop
+            spiSlave.swaps++;
+        }
+        SpiSlaveArm();
+    }
+}
@@ -0,0 +1,70 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Double-buffered SPI slave of the SPI_Slave example. The application fills the back buffer with SpiSlaveBeginFrame
+ * and hands it over with SpiSlavePublish; SpiSlaveFrameEnd (chip select released) swaps it in and preloads the TX FIFO,
+ * and SpiSlaveRxService (RX FIFO interrupt) keeps the TX FIFO topped up for the rest of the frame.
+ *
+ * The engine only touches the SPI module through the SpiSlaveHw functions at the end of this file. They are implemented
+ * on the registers in main.c, and by a simulated SPI-A and master in host/spi_slave_sim.c.
+ */
+
+#ifndef SPI_SLAVE_H
+#define SPI_SLAVE_H
+
+#ifdef __TMS320C2000__
+#include "F2802x_Device.h"
+#else
+#include <stdint.h>
+typedef uint16_t Uint16;
+typedef uint32_t Uint32;
+#endif
+
+#define SPI_CHAR_BITS    8    // Bits per SPI character
+#define SPI_TX_SHIFT     (16 - SPI_CHAR_BITS)      // TX data is left-justified in SPITXBUF
+#define SPI_RX_MASK      ((1 << SPI_CHAR_BITS) - 1) // RX data is right-justified in SPIRXBUF
+#define SPI_FIFO_DEPTH   4    // SPI-A TX/RX FIFO depth
+#define SPI_RX_LEVEL     2    // RX FIFO interrupt level, leaves 2 words in the TX FIFO while the ISR runs
+#define SPI_FRAME_WORDS  8    // Words in a response frame
+#define SPI_PAD_WORD     0xFF // Sent if the master clocks more words than a frame holds
+
+/*
+ * Double-buffered response. The ISRs only send tx[front]; the main loop only writes tx[front ^ 1],
+ * and only while pending is 0. Setting pending hands the back buffer over, and SpiSlaveFrameEnd swaps
+ * the buffers at the end of a frame, so a frame never mixes old and new data.
+ */
+typedef struct
+{
+    Uint16 tx[2][SPI_FRAME_WORDS];
+    Uint16 rx[SPI_FRAME_WORDS]; // Words received from the master in the current frame
+    volatile Uint16 front;      // Buffer being sent (ISR)
+    volatile Uint16 pending;    // Back buffer published, swap at the next chip-select release
+    Uint16 txPos;               // Next word of tx[front] to load into the TX FIFO
+    Uint16 rxPos;               // Words received in the current frame
+    volatile Uint16 rxLength;   // Words received in the last complete frame
+    volatile Uint32 frames;     // Frames completed (chip-select releases)
+    volatile Uint32 swaps;      // Frames that started with a newly published buffer
+    volatile Uint32 shortFrames; // Master released chip select before the end of the frame
+    volatile Uint32 longFrames;  // Master clocked more than SPI_FRAME_WORDS words
+} SpiSlave;
+
+extern SpiSlave spiSlave;
+
+void SpiSlaveInit(void);            // After the SPI is configured; releases it from reset with the first words loaded
+Uint16 *SpiSlaveBeginFrame(void);
+void SpiSlavePublish(void);
+void SpiSlaveRxService(void);       // Body of the SPI RX FIFO interrupt
+void SpiSlaveFrameEnd(void);        // Body of the chip-select release interrupt
+
+// Hardware access, implemented in main.c (registers) and host/spi_slave_sim.c (simulated SPI-A)
+void SpiSlaveHwReset(void);         // Reset the shift register and both FIFOs, clear the RX flags
+Uint16 SpiSlaveHwTxCount(void);     // Words in the TX FIFO
+void SpiSlaveHwWrite(Uint16 word);  // SPITXBUF
+Uint16 SpiSlaveHwRxCount(void);     // Words in the RX FIFO
+Uint16 SpiSlaveHwRead(void);        // SPIRXBUF
+
+#endif // SPI_SLAVE_H
@@ -0,0 +1,219 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Tests the UART ring buffer (ring.h) on a Linux host, first from a single thread and then with a producer thread
+ * and a consumer thread running concurrently on the same ring, as scia_rx_isr and the main loop (or the main loop and
+ * scia_tx_isr) do on the target.
+ *
+ * Single thread: every slot can be used, Put fails on a full ring and Get on an empty one, Write and Read accept
+ * partial lengths and report them, and the free-running indices wrap through 0xFFFF without losing data.
+ * Concurrent: the producer sends a counting byte sequence through a small ring with random mixes of Put and Write,
+ * the consumer takes it out with random mixes of Get and Read, and every byte must arrive exactly once and in order;
+ * the fill level seen by the consumer must never exceed the ring size. It prints the throughput as a relative
+ * measure. The exit status is 1 if any check fails.
+ *
+ * Build: gcc -O2 -I.. -o ring_stress ring_stress.c -pthread
+ */
+
+#include "ring.h"
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define STRESS_RING_SIZE  16        // Small, so the producer and the consumer keep colliding
+#define STRESS_BYTES      20000000UL
+#define STRESS_CHUNK      23        // Largest Write / Read length, above the ring size
+
+static int failures;
+static RingBuffer stressRing;
+static Uint16 stressStorage[STRESS_RING_SIZE];
+
+typedef struct
+{
+    unsigned long received;   // Bytes taken out in order
+    unsigned long errors;     // Bytes out of sequence
+    unsigned long overfilled; // Fill levels above the ring size seen by the consumer
+    unsigned int seed;
+} Consumer;
+
+static void Check(const char *name, int ok)
+{
+    printf("  %-52s %s\n", name, ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        failures++;
+    }
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void TestSingleThread(void)
+{
+    Uint16 storage[8];
+    Uint16 data[12], out[12];
+    RingBuffer rb;
+    Uint16 i, value = 0, ok = 1;
+
+    RingBufferInit(&rb, storage, 8);
+    for(i = 0; i < 8; i++)
+    {
+        ok &= RingBufferPut(&rb, i);
+    }
+    Check("all 8 slots usable, Put fails when full", ok && !RingBufferPut(&rb, 8) && RingBufferFree(&rb) == 0);
+    for(i = 0; i < 8; i++)
+    {
+        ok &= RingBufferGet(&rb, &value) && value == i;
+    }
+    Check("Get returns in order, fails when empty", ok && !RingBufferGet(&rb, &value) && RingBufferCount(&rb) == 0);
+
+    for(i = 0; i < 12; i++)
+    {
+        data[i] = 0x100 + i; // Upper byte must be dropped
+    }
+    ok = (RingBufferWrite(&rb, data, 5) == 5) && (RingBufferWrite(&rb, data + 5, 7) == 3);
+    Check("Write accepts only what fits and reports it", ok && RingBufferFree(&rb) == 0);
+    ok = (RingBufferRead(&rb, out, 3) == 3) && (RingBufferRead(&rb, out + 3, 12) == 5);
+    for(i = 0; i < 8; i++)
+    {
+        ok &= (out[i] == i);
+    }
+    Check("Read returns partial lengths, bytes masked to 8 bits", ok && RingBufferCount(&rb) == 0);
+
+    rb.head = 0xFFFA; // Indices about to wrap modulo 2^16
+    rb.tail = 0xFFFA;
+    ok = (RingBufferWrite(&rb, data, 8) == 8) && (rb.head == 0x0002) && (RingBufferCount(&rb) == 8);
+    ok &= !RingBufferPut(&rb, 0);
+    ok &= (RingBufferRead(&rb, out, 12) == 8);
+    for(i = 0; i < 8; i++)
+    {
+        ok &= (out[i] == i);
+    }
+    Check("indices wrap through 0xFFFF without losing data", ok && RingBufferCount(&rb) == 0);
+}
+
+static void *Producer(void *arg)
+{
+    Uint16 chunk[STRESS_CHUNK];
+    unsigned int seed = 12345;
+    unsigned long sent = 0;
+    Uint16 length, i;
+
+    (void)arg;
+    while(sent < STRESS_BYTES)
+    {
+        if(rand_r(&seed) & 1)
+        {
+            if(RingBufferPut(&stressRing, (Uint16)(sent & 0xFF)))
+            {
+                sent++;
+            }
+            else
+            {
+                sched_yield(); // Ring full, let the consumer run
+            }
+        }
+        else
+        {
+            length = 1 + rand_r(&seed) % STRESS_CHUNK;
+            if(length > STRESS_BYTES - sent)
+            {
+                length = (Uint16)(STRESS_BYTES - sent);
+            }
+            for(i = 0; i < length; i++)
+            {
+                chunk[i] = (Uint16)((sent + i) & 0xFF);
+            }
+            length = RingBufferWrite(&stressRing, chunk, length);
+            if(length == 0)
+            {
+                sched_yield();
+            }
+            sent += length;
+        }
+    }
+    return NULL;
+}
+
+static void *ConsumerThread(void *arg)
+{
+    Consumer *c = (Consumer *)arg;
+    Uint16 chunk[STRESS_CHUNK];
+    Uint16 count, i, value;
+
+    while(c->received < STRESS_BYTES)
+    {
+        if(RingBufferCount(&stressRing) > STRESS_RING_SIZE)
+        {
+            c->overfilled++;
+        }
+        if(rand_r(&c->seed) & 1)
+        {
+            if(RingBufferGet(&stressRing, &value))
+            {
+                c->errors += (value != (c->received & 0xFF));
+                c->received++;
+            }
+            else
+            {
+                sched_yield(); // Ring empty, let the producer run
+            }
+        }
+        else
+        {
+            count = RingBufferRead(&stressRing, chunk, 1 + rand_r(&c->seed) % STRESS_CHUNK);
+            for(i = 0; i < count; i++)
+            {
+                c->errors += (chunk[i] != ((c->received + i) & 0xFF));
+            }
+            c->received += count;
+            if(count == 0)
+            {
+                sched_yield();
+            }
+        }
+    }
+    return NULL;
+}
+
+static void TestConcurrent(void)
+{
+    pthread_t producer, consumer;
+    Consumer c = { 0, 0, 0, 6789 };
+    double start, seconds;
+
+    RingBufferInit(&stressRing, stressStorage, STRESS_RING_SIZE);
+    start = Now();
+    pthread_create(&consumer, NULL, ConsumerThread, &c);
+    pthread_create(&producer, NULL, Producer, NULL);
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+    seconds = Now() - start;
+
+    printf("    %lu bytes through a %d-slot ring in %.2f s (%.1f MB/s)\n", c.received, STRESS_RING_SIZE, seconds,
+           c.received / seconds * 1e-6);
+    Check("concurrent: every byte once and in order", c.errors == 0 && c.received == STRESS_BYTES);
+    Check("concurrent: fill level never above the ring size", c.overfilled == 0);
+    Check("concurrent: ring empty at the end", RingBufferCount(&stressRing) == 0);
+}
+
+int main(void)
+{
+    TestSingleThread();
+    TestConcurrent();
+
+    printf(failures ? "%d check(s) failed\n" : "All checks passed\n", failures);
+    return failures != 0;
+}
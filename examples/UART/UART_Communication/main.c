@@ -2,19 +2,44 @@
  * Author: Kiran Jojare
  * Email: kijo7257@colorado.edu
  * Date: Feb 26, 2024
- * Version: 1.0
+ * Version: 1.3
  *
  * Description:
  * This code demonstrates how to use the UART (Universal Asynchronous Receiver/Transmitter) module to send and receive data on the Texas Instruments C2000 Piccolo LaunchPad Evaluation Kit (LAUNCHHXL-F28027F).
  * The UART is configured to communicate at a baud rate of 9600.
  *
- * The code initializes the system control and GPIO settings, configures the UART module, and sends/receives data.
+ * The code initializes the system control and GPIO settings, configures the UART module, and sends/receives data through
+ * lock-free single-producer/single-consumer ring buffers. The transmit and receive interrupts move data between the buffers
+ * and the SCI FIFOs, so SciaTx and SciaRead never wait for the line and report how many bytes they handled.
+ * Each TX interrupt fills every free slot of the 4-deep TX FIFO, and each RX interrupt drains the whole RX FIFO.
+ * The ring buffer is implemented in ring.h; add it from this folder to the project.
  *
  * This example is intended to help users get started with basic UART operations on the F28027F microcontroller.
  */
 
 #include "F2802x_Device.h"
 #include "f2802x_examples.h"
+#include "ring.h"
+
+#define SCI_TX_BUFFER_SIZE 64 // Transmit ring size (power of two)
+#define SCI_RX_BUFFER_SIZE 64 // Receive ring size (power of two)
+#define SCI_FIFO_DEPTH     4  // SCI-A TX/RX FIFO depth
+#define SCI_TX_FIFO_LEVEL  0  // TX FIFO interrupt when TXFFST <= level; 0 refills while the last character is still shifting out
+
+#if ((SCI_TX_BUFFER_SIZE & (SCI_TX_BUFFER_SIZE - 1)) != 0) || ((SCI_RX_BUFFER_SIZE & (SCI_RX_BUFFER_SIZE - 1)) != 0)
+#error "SCI buffer sizes must be powers of two"
+#endif
+
+__interrupt void scia_rx_isr(void);
+__interrupt void scia_tx_isr(void);
+
+Uint16 sciTxStorage[SCI_TX_BUFFER_SIZE];
+Uint16 sciRxStorage[SCI_RX_BUFFER_SIZE];
+RingBuffer sciTxRing;
+RingBuffer sciRxRing;
+volatile Uint32 sciRxDropCount; // Received bytes lost because the RX ring was full
+volatile Uint32 sciTxIsrCount;  // Number of TX interrupts serviced
+volatile Uint32 sciTxByteCount; // Number of characters written to the TX FIFO
 
 void InitGpio()
 {
@@ -29,6 +54,9 @@ void InitGpio()
 
 void InitScia()
 {
+    RingBufferInit(&sciTxRing, sciTxStorage, SCI_TX_BUFFER_SIZE);
+    RingBufferInit(&sciRxRing, sciRxStorage, SCI_RX_BUFFER_SIZE);
+
     EALLOW;
     SysCtrlRegs.PCLKCR0.bit.SCIAENCLK = 1; // Enable SCI-A clock
     SciaRegs.SCICCR.all = 0x0007;         // 1 stop bit, No loopback, No parity, 8 char bits, async mode, idle-line protocol
@@ -37,22 +65,53 @@ void InitScia()
     SciaRegs.SCICTL1.all = 0x0023;        // Relinquish SCI from Reset
     SciaRegs.SCIHBAUD = 0x0001;           // Set baud rate to 9600
     SciaRegs.SCILBAUD = 0x00E7;
+    SciaRegs.SCIFFTX.all = 0xC000 | SCI_TX_FIFO_LEVEL; // Enable FIFO enhancements, TX FIFO interrupt enabled when data is queued
+    SciaRegs.SCIFFRX.all = 0x0021;        // Enable RX FIFO interrupt, set RX FIFO level to 1
+    SciaRegs.SCIFFCT.all = 0x0;
+    SciaRegs.SCIFFTX.bit.TXFIFOXRESET = 1; // Release TX FIFO from reset
+    SciaRegs.SCIFFRX.bit.RXFIFORESET = 1;  // Release RX FIFO from reset
     EDIS;
 }
 
-void SciaTx(char *msg)
+// Queue bytes for transmission without waiting; returns the number of bytes accepted
+Uint16 SciaWrite(const Uint16 *data, Uint16 length)
+{
+    Uint16 accepted = RingBufferWrite(&sciTxRing, data, length);
+
+    if(accepted != 0)
+    {
+        SciaRegs.SCIFFTX.bit.TXFFIENA = 1; // Let scia_tx_isr drain the ring
+    }
+    return accepted;
+}
+
+// Queue a string for transmission without waiting; returns the number of characters accepted
+Uint16 SciaTx(char *msg)
 {
-    int i;
-    for(i = 0; msg[i] != '\0'; i++)
+    Uint16 accepted = 0;
+
+    while(msg[accepted] != '\0' && RingBufferPut(&sciTxRing, (Uint16)msg[accepted] & 0xFF))
     {
-        while(SciaRegs.SCIFFTX.bit.TXFFST != 0); // Wait until TX FIFO is empty
-        SciaRegs.SCITXBUF = msg[i]; // Send character
+        accepted++;
     }
+    if(accepted != 0)
+    {
+        SciaRegs.SCIFFTX.bit.TXFFIENA = 1; // Let scia_tx_isr drain the ring
+    }
+    return accepted;
+}
+
+// Read up to maxLength received bytes without waiting; returns the number of bytes read
+Uint16 SciaRead(Uint16 *data, Uint16 maxLength)
+{
+    return RingBufferRead(&sciRxRing, data, maxLength);
 }
 
 void main(void)
 {
     char msg[] = "Hello, UART!";
+    Uint16 rxData[16];
+    Uint16 rxCount;
 
     InitSysCtrl(); // Initialize the CPU and configure the clock
     DINT;          // Disable CPU interrupts
@@ -60,9 +119,65 @@ void main(void)
     InitGpio();    // Initialize the GPIO
     InitScia();    // Initialize the UART
 
+    InitPieCtrl(); // Initialize the PIE control registers
+    InitPieVectTable(); // Initialize the PIE vector table
+
+    EALLOW;
+    PieVectTable.SCIRXINTA = &scia_rx_isr; // Map RX ISR to the PIE vector table
+    PieVectTable.SCITXINTA = &scia_tx_isr; // Map TX ISR to the PIE vector table
+    EDIS;
+
+    IER |= M_INT9; // Enable CPU INT9
+    PieCtrlRegs.PIEIER9.bit.INTx1 = 1; // Enable PIE Group 9 interrupt 1 (RX)
+    PieCtrlRegs.PIEIER9.bit.INTx2 = 1; // Enable PIE Group 9 interrupt 2 (TX)
+
+    EINT;  // Enable Global interrupt INTM
+    ERTM;  // Enable Global realtime interrupt DBGM
+
     while(1)
     {
-        SciaTx(msg); // Send message
+        SciaTx(msg); // Queue message, returns immediately
+
+        rxCount = SciaRead(rxData, 16); // Collect received bytes, returns immediately
+        // Process rxCount received bytes
+
         DELAY_US(1000000); // Delay for 1 second
     }
 }
+
+__interrupt void scia_rx_isr(void)
+{
+    Uint16 pending = SciaRegs.SCIFFRX.bit.RXFFST; // Drain the whole RX FIFO
+
+    while(pending--)
+    {
+        if(!RingBufferPut(&sciRxRing, SciaRegs.SCIRXBUF.all & 0xFF)) // Read received character
+        {
+            sciRxDropCount++; // RX ring full
+        }
+    }
+
+    SciaRegs.SCIFFRX.bit.RXFFINTCLR = 1; // Clear RX interrupt flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP9; // Acknowledge interrupt
+}
+
+__interrupt void scia_tx_isr(void)
+{
+    Uint16 freeSlots = SCI_FIFO_DEPTH - SciaRegs.SCIFFTX.bit.TXFFST; // Fill every free FIFO slot
+    Uint16 txChar;
+
+    while(freeSlots--)
+    {
+        if(!RingBufferGet(&sciTxRing, &txChar))
+        {
+            SciaRegs.SCIFFTX.bit.TXFFIENA = 0; // Ring empty, stop TX interrupts until more data is queued
+            break;
+        }
+        SciaRegs.SCITXBUF = txChar; // Send next character
+        sciTxByteCount++;
+    }
+    sciTxIsrCount++;
+
+    SciaRegs.SCIFFTX.bit.TXFFINTCLR = 1; // Clear TX interrupt flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP9; // Acknowledge interrupt
+}
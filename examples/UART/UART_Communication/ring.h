@@ -0,0 +1,136 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Lock-free single-producer/single-consumer ring buffer shared by the UART examples (UART_Communication,
+ * UART_Interrupt, UART_Transmit_Receive_Interrupt, UART_Receive_Echo, UART_Shell, UART_Telemetry and UART_Logging).
+ * The producer only writes head and the consumer only writes tail, so an interrupt and the main loop (or two
+ * interrupts) can share a ring without disabling interrupts. Both indices run freely and wrap modulo 2^16;
+ * head - tail is the fill level, so every slot can be used. The size must be a power of two.
+ *
+ * The functions do not touch peripheral registers. host/ring_stress.c runs a producer and a consumer thread on the
+ * same ring.
+ */
+
+#ifndef RING_H
+#define RING_H
+
+#ifdef __TMS320C2000__
+#include "F2802x_Device.h"
+#else
+#include <stdint.h>
+typedef uint16_t Uint16;
+#endif
+
+/*
+ * The C28x compiler keeps volatile accesses in program order. Host builds used for
+ * concurrent producer/consumer stress tests need a real memory barrier.
+ */
+#ifdef __TMS320C2000__
+#define RING_BARRIER()
+#else
+#define RING_BARRIER() __sync_synchronize()
+#endif
+
+typedef struct
+{
+    Uint16 *data;          // Storage, size is a power of two
+    Uint16 mask;           // Size - 1
+    volatile Uint16 head;  // Next write position (producer)
+    volatile Uint16 tail;  // Next read position (consumer)
+} RingBuffer;
+
+static inline void RingBufferInit(RingBuffer *rb, Uint16 *storage, Uint16 size)
+{
+    rb->data = storage;
+    rb->mask = size - 1;
+    rb->head = 0;
+    rb->tail = 0;
+}
+
+static inline Uint16 RingBufferCount(const RingBuffer *rb)
+{
+    return (Uint16)(rb->head - rb->tail);
+}
+
+static inline Uint16 RingBufferFree(const RingBuffer *rb)
+{
+    return (Uint16)(rb->mask + 1 - (Uint16)(rb->head - rb->tail));
+}
+
+// Producer side: returns 0 if the ring is full
+static inline Uint16 RingBufferPut(RingBuffer *rb, Uint16 value)
+{
+    Uint16 head = rb->head;
+
+    if((Uint16)(head - rb->tail) > rb->mask)
+    {
+        return 0;
+    }
+    rb->data[head & rb->mask] = value;
+    RING_BARRIER(); // Data is visible before the new head
+    rb->head = head + 1;
+    return 1;
+}
+
+// Consumer side: returns 0 if the ring is empty
+static inline Uint16 RingBufferGet(RingBuffer *rb, Uint16 *value)
+{
+    Uint16 tail = rb->tail;
+
+    if(tail == rb->head)
+    {
+        return 0;
+    }
+    RING_BARRIER(); // Read data only after seeing the new head
+    *value = rb->data[tail & rb->mask];
+    RING_BARRIER(); // Data is read before the slot is released
+    rb->tail = tail + 1;
+    return 1;
+}
+
+// Producer side: copies as many bytes as fit and returns the number accepted
+static inline Uint16 RingBufferWrite(RingBuffer *rb, const Uint16 *data, Uint16 length)
+{
+    Uint16 head = rb->head;
+    Uint16 space = rb->mask + 1 - (Uint16)(head - rb->tail);
+    Uint16 i;
+
+    if(length > space)
+    {
+        length = space;
+    }
+    for(i = 0; i < length; i++)
+    {
+        rb->data[(head + i) & rb->mask] = data[i] & 0xFF; // One byte per 16-bit char
+    }
+    RING_BARRIER();
+    rb->head = head + length; // Publish all bytes at once
+    return length;
+}
+
+// Consumer side: copies up to maxLength bytes and returns the number read
+static inline Uint16 RingBufferRead(RingBuffer *rb, Uint16 *data, Uint16 maxLength)
+{
+    Uint16 tail = rb->tail;
+    Uint16 count = (Uint16)(rb->head - tail);
+    Uint16 i;
+
+    if(maxLength > count)
+    {
+        maxLength = count;
+    }
+    RING_BARRIER();
+    for(i = 0; i < maxLength; i++)
+    {
+        data[i] = rb->data[(tail + i) & rb->mask];
+    }
+    RING_BARRIER();
+    rb->tail = tail + maxLength; // Release all slots at once
+    return maxLength;
+}
+
+#endif // RING_H
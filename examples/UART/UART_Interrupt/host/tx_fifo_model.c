@@ -0,0 +1,254 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Models the SCI-A transmitter of the UART_Interrupt and UART_Transmit_Receive_Interrupt examples on a Linux host,
+ * one bit time per step: the 4-deep TX FIFO, the shift register (10 bits per character), the TX FIFO interrupt that
+ * is raised while TXFFST <= SCI_TX_FIFO_LEVEL and serviced a given latency later, and received characters that are
+ * echoed. The TX interrupt either writes one character per interrupt (the original scia_tx_isr) or fills every free
+ * FIFO slot (the current one). Echoes are either written straight into SCITXBUF by scia_rx_isr, or queued in the ring
+ * of ring.h and sent by scia_tx_isr ahead of the message (the current examples).
+ *
+ * It prints the TX interrupts per kilobyte sent and the line utilisation for each FIFO level and ISR latency.
+ * Filling every slot must need at most a quarter of the interrupts at level 0 and keep the line saturated while
+ * the latency is shorter than the time left before the FIFO underruns. With echoes arriving while the message
+ * streams, every queued echo must be sent once and in order; writing echoes straight into SCITXBUF loses the ones
+ * that arrive while the burst-filled FIFO is full. The exit status is 1 if any check fails.
+ *
+ * Build: gcc -O2 -I../../UART_Communication -o tx_fifo_model tx_fifo_model.c
+ */
+
+#include "ring.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define SCI_FIFO_DEPTH     4     // SCI-A TX FIFO depth
+#define SCI_CHAR_BITS      10    // Start bit, 8 data bits, stop bit
+#define SCI_ECHO_BUFFER_SIZE 16  // Echo ring size of main.c
+#define MODEL_BYTES        102400L // Bytes sent per measurement (100 kB)
+#define ECHO_FLAG          0x100 // Marks echoed characters in the model FIFO
+
+#define ISR_PER_BYTE       0     // One character per TX interrupt
+#define ISR_BURST_FILL     1     // Fill every free FIFO slot per TX interrupt
+
+static int failures;
+
+typedef struct
+{
+    int policy;          // ISR_PER_BYTE or ISR_BURST_FILL
+    int level;           // SCI_TX_FIFO_LEVEL
+    int latency;         // Bit times from the interrupt request to the ISR writing the FIFO
+    int echoInterval;    // Mean bit times between received characters, 0 for none
+    int echoQueued;      // 1: echoes queued in the ring and sent first by the TX ISR, 0: written to SCITXBUF
+} ModelConfig;
+
+typedef struct
+{
+    long isrs;           // TX interrupts serviced
+    long bytes;          // Characters shifted out
+    long busyBits;       // Bit times the line was sending
+    long bits;           // Bit times simulated
+    long echoesReceived;
+    long echoesSent;
+    long echoesDropped;  // Lost in a full FIFO or a full echo ring
+    long echoesOutOfOrder;
+    long echoDelayMax;   // Longest bit times from reception to the start of the echo
+} ModelResult;
+
+static void Check(const char *name, int ok)
+{
+    printf("  %-52s %s\n", name, ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        failures++;
+    }
+}
+
+// Received characters arrive at most at the line rate, on average every echoInterval bit times
+static long NextEcho(const ModelConfig *cfg, long t)
+{
+    return t + SCI_CHAR_BITS + rand() % (2 * (cfg->echoInterval - SCI_CHAR_BITS) + 1);
+}
+
+static void RunModel(const ModelConfig *cfg, ModelResult *r)
+{
+    Uint16 fifo[SCI_FIFO_DEPTH];   // Characters in the TX FIFO, oldest first
+    Uint16 echoStorage[SCI_ECHO_BUFFER_SIZE];
+    long echoTime[256];            // Reception time of each echo in flight, by echo number modulo 256
+    RingBuffer echoRing;
+    int txffst = 0;                // TXFFST
+    int shifting = 0;              // Bits left in the shift register
+    long isrDue = -1;              // Bit time the pending TX interrupt is serviced, -1 if none
+    long nextEcho;
+    Uint16 echoNext = 0, echoExpected = 0, txChar;
+    long t;
+    int i, freeSlots;
+
+    *r = (ModelResult){ 0 };
+    RingBufferInit(&echoRing, echoStorage, SCI_ECHO_BUFFER_SIZE);
+    srand(1);
+    nextEcho = cfg->echoInterval ? NextEcho(cfg, 0) : -1;
+
+    for(t = 0; r->bytes < MODEL_BYTES; t++)
+    {
+        // Shift register: one bit per step, reload from the FIFO when the last bit has gone
+        if(shifting == 0 && txffst > 0)
+        {
+            txChar = fifo[0];
+            for(i = 1; i < txffst; i++)
+            {
+                fifo[i - 1] = fifo[i];
+            }
+            txffst--;
+            shifting = SCI_CHAR_BITS;
+            r->bytes++;
+            if(txChar & ECHO_FLAG)
+            {
+                r->echoesOutOfOrder += ((txChar & 0xFF) != (echoExpected & 0xFF));
+                if(t - echoTime[txChar & 0xFF] > r->echoDelayMax)
+                {
+                    r->echoDelayMax = t - echoTime[txChar & 0xFF];
+                }
+                echoExpected = (txChar & 0xFF) + 1;
+                r->echoesSent++;
+            }
+        }
+        if(shifting > 0)
+        {
+            shifting--;
+            r->busyBits++;
+        }
+
+        // A received character: scia_rx_isr echoes it (none near the end, so every echo is sent)
+        if(t == nextEcho && r->bytes < MODEL_BYTES - 100)
+        {
+            echoTime[echoNext & 0xFF] = t;
+            r->echoesReceived++;
+            if(!cfg->echoQueued)
+            {
+                if(txffst < SCI_FIFO_DEPTH)
+                {
+                    fifo[txffst++] = ECHO_FLAG | (echoNext & 0xFF); // Written straight to SCITXBUF
+                }
+                else
+                {
+                    r->echoesDropped++; // FIFO full, the character is lost
+                    echoExpected++;
+                }
+            }
+            else if(!RingBufferPut(&echoRing, echoNext & 0xFF))
+            {
+                r->echoesDropped++; // Counted in sciEchoDropCount
+                echoExpected++;
+            }
+            echoNext++;
+            nextEcho = NextEcho(cfg, t);
+        }
+
+        // TX FIFO interrupt: requested while TXFFST <= level, serviced after the latency
+        if(isrDue < 0 && txffst <= cfg->level)
+        {
+            isrDue = t + cfg->latency;
+        }
+        if(isrDue == t)
+        {
+            freeSlots = (cfg->policy == ISR_PER_BYTE) ? (txffst < SCI_FIFO_DEPTH) : SCI_FIFO_DEPTH - txffst;
+            while(freeSlots--)
+            {
+                if(cfg->echoQueued && RingBufferGet(&echoRing, &txChar))
+                {
+                    fifo[txffst++] = ECHO_FLAG | txChar; // Queued echoes go out before the message
+                }
+                else
+                {
+                    fifo[txffst++] = 'M';
+                }
+            }
+            r->isrs++;
+            isrDue = -1; // TXFFINTCLR; raised again on the next step if still at or below the level
+        }
+    }
+    r->bits = t;
+}
+
+static double IsrsPerKilobyte(const ModelResult *r)
+{
+    return r->isrs * 1024.0 / r->bytes;
+}
+
+static double Utilisation(const ModelResult *r)
+{
+    return 100.0 * r->busyBits / r->bits;
+}
+
+static void PrintRow(const char *name, const ModelConfig *cfg, const ModelResult *r)
+{
+    printf("  %-12s %5d %8d %10.1f %9.2f%%\n", name, cfg->level, cfg->latency, IsrsPerKilobyte(r), Utilisation(r));
+}
+
+static void TestInterruptRate(void)
+{
+    ModelConfig cfg = { ISR_PER_BYTE, 0, 5, 0, 0 };
+    ModelResult perByte, burst, late, tuned;
+    int level;
+
+    printf("TX interrupts per kB and line utilisation, message only:\n");
+    printf("  ISR          level  latency   ISRs/kB   line busy\n");
+    RunModel(&cfg, &perByte);
+    PrintRow("per byte", &cfg, &perByte);
+
+    cfg.policy = ISR_BURST_FILL;
+    for(level = 0; level < SCI_FIFO_DEPTH; level++)
+    {
+        cfg.level = level;
+        RunModel(&cfg, &burst);
+        PrintRow("burst fill", &cfg, &burst);
+    }
+    cfg.level = 0;
+    RunModel(&cfg, &burst);
+
+    cfg.latency = 15; // Longer than one character: level 0 underruns, level 1 does not
+    RunModel(&cfg, &late);
+    PrintRow("burst fill", &cfg, &late);
+    cfg.level = 1;
+    RunModel(&cfg, &tuned);
+    PrintRow("burst fill", &cfg, &tuned);
+
+    Check("burst fill, level 0: 4x fewer interrupts per kB", IsrsPerKilobyte(&burst) * 4.0 <= IsrsPerKilobyte(&perByte) * 1.01);
+    Check("burst fill, level 0, latency 5 bits: line saturated", Utilisation(&burst) > 99.9);
+    Check("latency 15 bits: level 0 underruns", Utilisation(&late) < 99.0);
+    Check("latency 15 bits: level 1 keeps the line saturated", Utilisation(&tuned) > 99.9);
+}
+
+static void TestEchoes(void)
+{
+    ModelConfig cfg = { ISR_BURST_FILL, 0, 5, 40, 0 }; // A character received every 40 bit times on average
+    ModelResult direct, queued;
+
+    RunModel(&cfg, &direct);
+    cfg.echoQueued = 1;
+    RunModel(&cfg, &queued);
+
+    printf("Echoes while the message streams (%ld received):\n", queued.echoesReceived);
+    printf("  written to SCITXBUF by scia_rx_isr: %ld lost\n", direct.echoesDropped);
+    printf("  queued for scia_tx_isr:             %ld lost, longest delay %.1f characters\n",
+           queued.echoesDropped, (double)queued.echoDelayMax / SCI_CHAR_BITS);
+    Check("direct echoes into a full FIFO are lost", direct.echoesDropped > 0);
+    Check("queued echoes: all sent once and in order",
+          queued.echoesDropped == 0 && queued.echoesOutOfOrder == 0 && queued.echoesSent == queued.echoesReceived);
+    Check("queued echoes: sent within the FIFO depth + 2 chars",
+          queued.echoDelayMax <= (SCI_FIFO_DEPTH + 2) * SCI_CHAR_BITS);
+}
+
+int main(void)
+{
+    TestInterruptRate();
+    TestEchoes();
+
+    printf(failures ? "%d check(s) failed\n" : "All checks passed\n", failures);
+    return failures != 0;
+}
@@ -0,0 +1,289 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Tests and benchmarks the UART_Logging logger (logger.c) on a Linux host, with logHostTimer standing in for
+ * CPU Timer 1.
+ *
+ * Entries written with Log0 to Log3 are drained by LogFlush through the shared frame writer into a TX ring, and the
+ * ring is fed to the UART_Telemetry decoder. Every entry must arrive once, in order, with its ID, timestamp and
+ * arguments, and no log record may exceed LOG_FRAME_PAYLOAD bytes. When the log ring is full the calls must return 0
+ * and count the drop, and the next flush must send a LOG_DROPPED entry with the drops since the last one. It then
+ * prints the host time of one Log0 to Log3 call, of LogFlush per entry, and of formatting the same message with
+ * snprintf, which is what a text logger would do at the call site. The exit status is 1 if any check fails.
+ *
+ * Build: gcc -O2 -I.. -I../../UART_Telemetry -I../../UART_Telemetry/host -I../../UART_Communication
+ *        -I../../../CRC/CRC_Engine -o log_bench log_bench.c ../logger.c ../../UART_Telemetry/telemetry.c
+ *        ../../UART_Telemetry/host/telemetry_decoder.c ../../../CRC/CRC_Engine/crc.c
+ */
+
+#include "logger.h"
+#include "telemetry_decoder.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define TX_RING_SIZE   512      // SCI_TX_BUFFER_SIZE of main.c
+#define TEST_ENTRIES   100000L
+#define BENCH_CALLS    20000000L
+#define BENCH_BATCH    16       // Calls between two releases of the log ring, 16 x 9 words fit in 256
+
+volatile Uint32 logHostTimer;   // CPU Timer 1 model, counts down like TIM
+
+static int failures;
+static volatile Uint32 sink;
+
+typedef struct
+{
+    long received;              // Entries decoded
+    long errors;                // Entries that differ from what was logged
+    long oversized;             // Records above LOG_FRAME_PAYLOAD
+    Uint32 dropsReported;       // Sum of the LOG_DROPPED arguments
+} LogChecker;
+
+static void Check(const char *name, int ok)
+{
+    printf("  %-52s %s\n", name, ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        failures++;
+    }
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Entry n of the test sequence: the ID cycles through the messages, the arguments and timestamp follow from n
+static Uint16 TestCount(long n)
+{
+    return (Uint16)(n % 4);
+}
+
+static Uint32 TestArgument(long n, Uint16 i)
+{
+    return (Uint32)(n * 2654435761UL) ^ ((Uint32)i << 28);
+}
+
+static Uint16 TestId(long n)
+{
+    return (Uint16)(LOG_BOOT + n % (LOG_MESSAGE_COUNT - LOG_BOOT));
+}
+
+static Uint16 LogTestEntry(long n)
+{
+    logHostTimer = ~(Uint32)(n * 1000); // Timestamp n * 1000 cycles
+    switch(TestCount(n))
+    {
+    case 0:  return Log0(TestId(n));
+    case 1:  return Log1(TestId(n), TestArgument(n, 0));
+    case 2:  return Log2(TestId(n), TestArgument(n, 0), TestArgument(n, 1));
+    default: return Log3(TestId(n), TestArgument(n, 0), TestArgument(n, 1), TestArgument(n, 2));
+    }
+}
+
+static void CheckRecord(const TelemetryFrame *frame, void *context)
+{
+    LogChecker *c = (LogChecker *)context;
+    const uint8_t *p = frame->payload;
+    size_t pos = 0;
+    Uint16 header, count, i;
+    Uint32 timestamp;
+    long n;
+
+    if(frame->type != TELEMETRY_LOG)
+    {
+        c->errors++;
+        return;
+    }
+    c->oversized += frame->length > LOG_FRAME_PAYLOAD;
+    while(pos + 6 <= frame->length)
+    {
+        header = TelemetryGetUint16(p + pos);
+        count = header >> 12;
+        timestamp = TelemetryGetUint32(p + pos + 2);
+        if(pos + LOG_ENTRY_WORDS(count) * 2 > frame->length)
+        {
+            break;
+        }
+        if((header & 0xFFF) == LOG_DROPPED)
+        {
+            c->dropsReported += TelemetryGetUint32(p + pos + 6);
+        }
+        else
+        {
+            n = c->received++;
+            c->errors += (header & 0xFFF) != TestId(n) || count != TestCount(n) || timestamp != (Uint32)(n * 1000);
+            for(i = 0; i < count; i++)
+            {
+                c->errors += TelemetryGetUint32(p + pos + 6 + 4 * i) != TestArgument(n, i);
+            }
+        }
+        pos += LOG_ENTRY_WORDS(count) * 2;
+    }
+    c->errors += pos != frame->length; // Whole entries only
+}
+
+// Flush everything in the log ring through the frame writer into the decoder
+static void Drain(Telemetry *tm, TelemetryDecoder *dec)
+{
+    uint8_t bytes[TX_RING_SIZE];
+    Uint16 byte;
+    size_t count;
+
+    do
+    {
+        count = 0;
+        while(RingBufferGet(tm->ring, &byte))
+        {
+            bytes[count++] = (uint8_t)byte;
+        }
+        TelemetryDecoderFeed(dec, bytes, count);
+    } while(LogFlush(tm) || RingBufferCount(tm->ring) != 0);
+}
+
+static void TestRoundTrip(void)
+{
+    static Uint16 txStorage[TX_RING_SIZE];
+    static RingBuffer txRing;
+    static Telemetry tm;
+    static TelemetryDecoder dec;
+    LogChecker c = { 0 };
+    long n, logged = 0;
+    Uint32 dropsBefore;
+
+    RingBufferInit(&txRing, txStorage, TX_RING_SIZE);
+    TelemetryInit(&tm, &txRing);
+    TelemetryDecoderInit(&dec, CheckRecord, &c);
+    LogInit();
+
+    for(n = 0; n < TEST_ENTRIES; n++)
+    {
+        logged += LogTestEntry(n);
+        if(rand() % 8 == 0 || RingBufferFree(&logRing) < LOG_ENTRY_WORDS(3))
+        {
+            Drain(&tm, &dec); // Drain at random points, so entries wrap the log ring at every offset
+        }
+    }
+    Drain(&tm, &dec);
+    Check("every entry sent once, in order, with its arguments",
+          logged == TEST_ENTRIES && c.received == TEST_ENTRIES && c.errors == 0);
+    Check("no CRC, format or sequence errors",
+          dec.crcErrors == 0 && dec.formatErrors == 0 && dec.lostFrames == 0 && dec.frames == tm.frames);
+    Check("no record above LOG_FRAME_PAYLOAD bytes", c.oversized == 0);
+
+    // Fill the log ring without draining it
+    dropsBefore = logDropCount;
+    for(n = 0; LogTestEntry(c.received + n); n++)
+    {
+    }
+    Check("full log ring: call returns 0 and counts the drop", logDropCount == dropsBefore + 1);
+    logDropCount += 4; // Four more lost entries, as if logged from an ISR
+    Drain(&tm, &dec);
+    for(n = 0; LogTestEntry(c.received + n); n++) // Once more, only the new drop is reported
+    {
+    }
+    Drain(&tm, &dec);
+    Check("flushes report new drops with LOG_DROPPED",
+          c.dropsReported == 6 && logDropReported == logDropCount && c.errors == 0);
+}
+
+static double BenchLog(Uint16 count)
+{
+    long n;
+    Uint16 i;
+    double start;
+
+    LogInit();
+    start = Now();
+    for(n = 0; n < BENCH_CALLS; n += BENCH_BATCH)
+    {
+        for(i = 0; i < BENCH_BATCH; i++)
+        {
+            switch(count)
+            {
+            case 0:  Log0(LOG_LOOP); break;
+            case 1:  Log1(LOG_LOOP, (Uint32)n); break;
+            case 2:  Log2(LOG_LOOP, (Uint32)n, i); break;
+            default: Log3(LOG_LOOP, (Uint32)n, i, 7); break;
+            }
+        }
+        logRing.tail = logRing.head; // Release the entries
+    }
+    sink += logRing.head + logDropCount;
+    return (Now() - start) * 1e9 / BENCH_CALLS;
+}
+
+static double BenchFlush(void)
+{
+    static Uint16 txStorage[TX_RING_SIZE];
+    static RingBuffer txRing;
+    static Telemetry tm;
+    long n;
+    double start, elapsed = 0;
+    Uint16 i;
+
+    RingBufferInit(&txRing, txStorage, TX_RING_SIZE);
+    TelemetryInit(&tm, &txRing);
+    LogInit();
+    for(n = 0; n < BENCH_CALLS / 10; n += BENCH_BATCH)
+    {
+        for(i = 0; i < BENCH_BATCH; i++)
+        {
+            Log2(LOG_LOOP, (Uint32)n, i);
+        }
+        start = Now();
+        while(LogFlush(&tm))
+        {
+            txRing.tail = txRing.head; // The line takes the frame
+        }
+        elapsed += Now() - start;
+    }
+    return elapsed * 1e9 / (BENCH_CALLS / 10);
+}
+
+static double BenchSnprintf(void)
+{
+    char text[64];
+    long n;
+    double start;
+
+    start = Now();
+    for(n = 0; n < BENCH_CALLS / 10; n++)
+    {
+        sink += snprintf(text, sizeof(text), "Main loop %u, timer tick %u", (unsigned)n, (unsigned)(n >> 3));
+    }
+    return (Now() - start) * 1e9 / (BENCH_CALLS / 10);
+}
+
+int main(void)
+{
+    double ns[4], flush, text;
+    Uint16 i;
+
+    srand(1);
+    TestRoundTrip();
+
+    for(i = 0; i < 4; i++)
+    {
+        ns[i] = BenchLog(i);
+    }
+    flush = BenchFlush();
+    text = BenchSnprintf();
+    printf("Host time per log call:\n");
+    printf("  Log0 %6.2f ns   Log1 %6.2f ns   Log2 %6.2f ns   Log3 %6.2f ns\n", ns[0], ns[1], ns[2], ns[3]);
+    printf("  LogFlush, per Log2 entry            %8.2f ns\n", flush);
+    printf("  snprintf of the same Log2 message   %8.2f ns (%.0fx a Log2 call)\n", text, text / ns[2]);
+    Check("Log2 call at least 5x cheaper than snprintf", ns[2] * 5 < text);
+
+    printf(failures ? "%d check(s) failed\n" : "All checks passed\n", failures);
+    return failures != 0;
+}
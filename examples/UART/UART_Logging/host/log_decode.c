@@ -0,0 +1,155 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Linux command line decoder for the UART_Logging stream. The log records are found with the UART_Telemetry
+ * frame decoder, and each entry is printed with the format string that log_messages.h gives for its ID.
+ *
+ *     log_decode [/dev/ttyACM0 | capture.bin | -]
+ *
+ * Rebuild this tool whenever log_messages.h changes, so that the IDs match the firmware.
+ *
+ * Build: gcc -O2 -I.. -I../../UART_Telemetry/host -I../../../CRC/CRC_Engine -o log_decode log_decode.c
+ *        ../../UART_Telemetry/host/telemetry_decoder.c ../../../CRC/CRC_Engine/crc.c
+ */
+
+#include "telemetry_decoder.h"
+#include "log_messages.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+#define LOG_CPU_HZ 60000000.0 // CPU Timer 1 counts SYSCLKOUT cycles
+
+// The string table, extracted from the same list the firmware uses for the IDs
+static const char *const logFormats[LOG_MESSAGE_COUNT] =
+{
+#define LOG_MESSAGE(id, format) format,
+    LOG_MESSAGES
+#undef LOG_MESSAGE
+};
+
+typedef struct
+{
+    int haveTime;
+    uint32_t lastTime;  // Last 32-bit timestamp
+    uint64_t wraps;     // Timestamp extended to 64 bits
+    uint32_t entries;
+    uint32_t badEntries;
+} LogDecoder;
+
+static void PrintLogEntry(LogDecoder *log, uint16_t id, uint32_t timestamp, const uint32_t *args)
+{
+    if(log->haveTime && timestamp < log->lastTime)
+    {
+        log->wraps += (uint64_t)1 << 32; // The timer wraps every 71.6 s at 60 MHz
+    }
+    log->haveTime = 1;
+    log->lastTime = timestamp;
+
+    printf("[%12.6f] ", (double)(log->wraps + timestamp) / LOG_CPU_HZ);
+    if(id < LOG_MESSAGE_COUNT)
+    {
+        printf(logFormats[id], args[0], args[1], args[2]);
+        printf("\n");
+    }
+    else
+    {
+        printf("unknown message %u: 0x%X 0x%X 0x%X\n", id, args[0], args[1], args[2]);
+    }
+    log->entries++;
+}
+
+static void DecodeFrame(const TelemetryFrame *frame, void *context)
+{
+    LogDecoder *log = (LogDecoder *)context;
+    const uint8_t *p = frame->payload;
+    const uint8_t *end = p + frame->length;
+
+    if(frame->type != TELEMETRY_LOG)
+    {
+        return;
+    }
+    while(end - p >= 6)
+    {
+        uint16_t header = TelemetryGetUint16(p);
+        unsigned count = header >> 12;
+        uint32_t args[3] = { 0, 0, 0 };
+        unsigned i;
+
+        if(count > 3 || (size_t)(end - p) < 6 + 4 * (size_t)count)
+        {
+            break;
+        }
+        for(i = 0; i < count; i++)
+        {
+            args[i] = TelemetryGetUint32(p + 6 + 4 * i);
+        }
+        PrintLogEntry(log, header & 0x0FFF, TelemetryGetUint32(p + 2), args);
+        p += 6 + 4 * count;
+    }
+    if(p != end)
+    {
+        log->badEntries++;
+    }
+}
+
+static int OpenInput(const char *path)
+{
+    struct termios tio;
+    int fd;
+
+    if(strcmp(path, "-") == 0)
+    {
+        return STDIN_FILENO;
+    }
+    fd = open(path, O_RDONLY | O_NOCTTY);
+    if(fd < 0)
+    {
+        perror(path);
+        return -1;
+    }
+    if(isatty(fd) && tcgetattr(fd, &tio) == 0)
+    {
+        cfmakeraw(&tio);
+        cfsetispeed(&tio, B115200);
+        cfsetospeed(&tio, B115200);
+        tio.c_cc[VMIN] = 1;
+        tio.c_cc[VTIME] = 0;
+        tcsetattr(fd, TCSANOW, &tio);
+    }
+    return fd;
+}
+
+int main(int argc, char **argv)
+{
+    static TelemetryDecoder dec;
+    LogDecoder log;
+    uint8_t buffer[4096];
+    ssize_t n;
+    int fd;
+
+    fd = OpenInput(argc > 1 ? argv[1] : "-");
+    if(fd < 0)
+    {
+        return 1;
+    }
+
+    memset(&log, 0, sizeof(log));
+    TelemetryDecoderInit(&dec, DecodeFrame, &log);
+    while((n = read(fd, buffer, sizeof(buffer))) > 0)
+    {
+        TelemetryDecoderFeed(&dec, buffer, (size_t)n);
+        fflush(stdout);
+    }
+
+    fprintf(stderr, "entries=%u badEntries=%u lostFrames=%u crcErrors=%u formatErrors=%u\n",
+            log.entries, log.badEntries, dec.lostFrames, dec.crcErrors, dec.formatErrors);
+    return 0;
+}
@@ -0,0 +1,33 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Log message table for the UART_Logging example. Each LOG_MESSAGE entry gives the message ID used at the
+ * call site and the printf format the host decoder applies to the arguments. The target only uses the IDs,
+ * so the strings take no flash. Arguments are 32-bit, so use %u, %d, %x or %X conversions only, with at most
+ * three per message. Add new messages at the end to keep the IDs of existing ones.
+ */
+
+#ifndef LOG_MESSAGES_H
+#define LOG_MESSAGES_H
+
+#define LOG_MESSAGES \
+    LOG_MESSAGE(LOG_DROPPED,     "%u log entries dropped") \
+    LOG_MESSAGE(LOG_BOOT,        "Boot, SYSCLKOUT %u MHz") \
+    LOG_MESSAGE(LOG_LOOP,        "Main loop %u, timer tick %u") \
+    LOG_MESSAGE(LOG_TIMER_TICK,  "Timer tick %u") \
+    LOG_MESSAGE(LOG_CALL_CYCLES, "Log call %u cycles, max %u") \
+    LOG_MESSAGE(LOG_SCI_STATS,   "SCI TX %u interrupts, %u bytes, %u frames dropped")
+
+typedef enum
+{
+#define LOG_MESSAGE(id, format) id,
+    LOG_MESSAGES
+#undef LOG_MESSAGE
+    LOG_MESSAGE_COUNT
+} LogMessageId;
+
+#endif // LOG_MESSAGES_H
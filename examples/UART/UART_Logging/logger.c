@@ -0,0 +1,73 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Log ring and background drain of the UART_Logging example. See logger.h.
+ */
+
+#include "logger.h"
+
+Uint16 logStorage[LOG_BUFFER_SIZE];
+RingBuffer logRing;
+volatile Uint32 logDropCount;
+Uint32 logDropReported;
+
+void LogInit(void)
+{
+    RingBufferInit(&logRing, logStorage, LOG_BUFFER_SIZE);
+    logDropCount = 0;
+    logDropReported = 0;
+}
+
+// Report dropped entries with a LOG_DROPPED entry once there is room for it
+void LogReportDrops(void)
+{
+    Uint32 drops = logDropCount;
+
+    if(drops != logDropReported && RingBufferFree(&logRing) >= LOG_ENTRY_WORDS(1) &&
+       Log1(LOG_DROPPED, drops - logDropReported))
+    {
+        logDropReported = drops;
+    }
+}
+
+/*
+ * Move whole log entries into one telemetry frame of up to LOG_FRAME_PAYLOAD bytes.
+ * Runs in the main loop only. Returns 0 when there is nothing to send or the TX ring is full.
+ */
+Uint16 LogFlush(Telemetry *tm)
+{
+    Uint16 tail = logRing.tail;
+    Uint16 head = logRing.head;
+    Uint16 end = tail;
+    Uint16 bytes = 0;
+    Uint16 words;
+    Uint16 sent = 0;
+
+    while(end != head)
+    {
+        words = LOG_ENTRY_WORDS(logRing.data[end & logRing.mask] >> 12);
+        if(bytes + 2 * words > LOG_FRAME_PAYLOAD)
+        {
+            break;
+        }
+        bytes += 2 * words;
+        end += words;
+    }
+    if(bytes != 0 && TelemetryBegin(tm, TELEMETRY_LOG, bytes))
+    {
+        while(tail != end)
+        {
+            TelemetryPutUint16(tm, logRing.data[tail++ & logRing.mask]);
+        }
+        TelemetryEnd(tm);
+        RING_BARRIER(); // Entries are copied before their slots are released
+        logRing.tail = end;
+        sent = 1;
+    }
+    LogReportDrops();
+    return sent;
+}
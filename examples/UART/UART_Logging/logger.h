@@ -0,0 +1,145 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Deferred binary logger of the UART_Logging example. Log0 to Log3 store a message ID, a 32-bit timestamp and up
+ * to three 32-bit arguments in a RAM ring without formatting anything, and LogFlush sends the entries as
+ * TELEMETRY_LOG records with the frame writer of the UART_Telemetry example (telemetry.c, telemetry.h).
+ *
+ * The only peripheral access is the timestamp read from CPU Timer 1. Host builds read logHostTimer instead, which
+ * host/log_bench.c uses to benchmark a log call and to decode the entries it sends.
+ */
+
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include "telemetry.h"    // examples/UART/UART_Telemetry
+#include "log_messages.h"
+
+#ifndef LOG_BUFFER_SIZE
+#define LOG_BUFFER_SIZE    256 // Log ring size in 16-bit words (power of two)
+#endif
+#ifndef LOG_FRAME_PAYLOAD
+#define LOG_FRAME_PAYLOAD  96  // Largest log record payload in bytes, several entries per frame
+#endif
+
+#if (LOG_BUFFER_SIZE & (LOG_BUFFER_SIZE - 1)) != 0
+#error "LOG_BUFFER_SIZE must be a power of two"
+#endif
+
+/*
+ * Log entry in the log ring, in 16-bit words:
+ *     [argument count << 12 | message ID] [timestamp low] [timestamp high] [argument low] [argument high] ...
+ * An entry is written with interrupts disabled and published by a single head update,
+ * so the drain only ever sees complete entries.
+ */
+#define LOG_ENTRY_WORDS(count) (3 + 2 * (count))
+
+#ifdef __TMS320C2000__
+#define LOG_TIMESTAMP()        (~CpuTimer1Regs.TIM.all) // CPU cycles, counting up
+#else
+extern volatile Uint32 logHostTimer; // Stands in for CpuTimer1Regs.TIM, defined by the host program
+#define LOG_TIMESTAMP()        (~logHostTimer)
+#define __disable_interrupts()       0
+#define __restore_interrupts(state)  ((void)(state))
+#endif
+
+extern RingBuffer logRing;             // Producers in main and in ISRs write it with interrupts disabled
+extern volatile Uint32 logDropCount;   // Log entries lost because the log ring was full
+extern Uint32 logDropReported;         // Drops already reported with LOG_DROPPED
+
+void LogInit(void);
+void LogReportDrops(void);
+Uint16 LogFlush(Telemetry *tm);
+
+// Reserve and start an entry; returns 0 and counts a drop if the log ring is full
+static inline Uint16 LogBegin(Uint16 id, Uint16 count, Uint16 *head)
+{
+    Uint16 pos = logRing.head;
+    Uint32 now;
+
+    if((Uint16)(pos - logRing.tail) > logRing.mask + 1 - LOG_ENTRY_WORDS(count))
+    {
+        logDropCount++;
+        return 0;
+    }
+    now = LOG_TIMESTAMP();
+    logRing.data[pos & logRing.mask] = (count << 12) | id;
+    logRing.data[(pos + 1) & logRing.mask] = (Uint16)now;
+    logRing.data[(pos + 2) & logRing.mask] = (Uint16)(now >> 16);
+    *head = pos;
+    return 1;
+}
+
+static inline void LogPut(Uint16 pos, Uint32 value)
+{
+    logRing.data[pos & logRing.mask] = (Uint16)value;
+    logRing.data[(pos + 1) & logRing.mask] = (Uint16)(value >> 16);
+}
+
+static inline Uint16 Log0(Uint16 id)
+{
+    Uint16 state = __disable_interrupts();
+    Uint16 head;
+    Uint16 logged = LogBegin(id, 0, &head);
+
+    if(logged)
+    {
+        logRing.head = head + LOG_ENTRY_WORDS(0);
+    }
+    __restore_interrupts(state);
+    return logged;
+}
+
+static inline Uint16 Log1(Uint16 id, Uint32 a)
+{
+    Uint16 state = __disable_interrupts();
+    Uint16 head;
+    Uint16 logged = LogBegin(id, 1, &head);
+
+    if(logged)
+    {
+        LogPut(head + 3, a);
+        logRing.head = head + LOG_ENTRY_WORDS(1);
+    }
+    __restore_interrupts(state);
+    return logged;
+}
+
+static inline Uint16 Log2(Uint16 id, Uint32 a, Uint32 b)
+{
+    Uint16 state = __disable_interrupts();
+    Uint16 head;
+    Uint16 logged = LogBegin(id, 2, &head);
+
+    if(logged)
+    {
+        LogPut(head + 3, a);
+        LogPut(head + 5, b);
+        logRing.head = head + LOG_ENTRY_WORDS(2);
+    }
+    __restore_interrupts(state);
+    return logged;
+}
+
+static inline Uint16 Log3(Uint16 id, Uint32 a, Uint32 b, Uint32 c)
+{
+    Uint16 state = __disable_interrupts();
+    Uint16 head;
+    Uint16 logged = LogBegin(id, 3, &head);
+
+    if(logged)
+    {
+        LogPut(head + 3, a);
+        LogPut(head + 5, b);
+        LogPut(head + 7, c);
+        logRing.head = head + LOG_ENTRY_WORDS(3);
+    }
+    __restore_interrupts(state);
+    return logged;
+}
+
+#endif // LOGGER_H
@@ -0,0 +1,201 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.3
+ *
+ * Description:
+ * This code demonstrates deferred binary logging over the UART (SCI-A) on the Texas Instruments C2000 Piccolo
+ * LaunchPad Evaluation Kit (LAUNCHHXL-F28027F). The UART is configured to communicate at about 115200 baud.
+ *
+ * A log call does not format any text. It stores a message ID, a 32-bit CPU Timer 1 timestamp and up to three
+ * 32-bit arguments in a RAM ring, which takes a few dozen cycles and is safe to call from an ISR. The main loop
+ * drains the ring in the background and sends the entries as COBS framed telemetry records (see UART_Telemetry).
+ * The messages are listed once in log_messages.h; the format strings are only used by the host decoder, so they
+ * take no flash on the target.
+ *
+ * The log ring and its drain are in logger.c and logger.h. The frame writer comes from telemetry.c and telemetry.h of
+ * the UART_Telemetry example; add them from that folder to the project, together with crc.c and crc.h from
+ * examples/CRC/CRC_Engine and ring.h from the UART_Communication example.
+ *
+ * This example is intended to help users add diagnostics without disturbing the timing of the F28027F microcontroller.
+ */
+
+#include "F2802x_Device.h"
+#include "f2802x_examples.h"
+#include "logger.h"
+
+#define SCI_TX_BUFFER_SIZE 512 // Transmit ring size (power of two), holds several frames
+#define SCI_FIFO_DEPTH     4   // SCI-A TX FIFO depth
+#define SCI_TX_FIFO_LEVEL  0   // TX FIFO interrupt when TXFFST <= level
+#define SCI_BRR            15  // LSPCLK 15 MHz / ((15 + 1) * 8) = 117187 baud, 1.7% above 115200
+
+#if (SCI_TX_BUFFER_SIZE & (SCI_TX_BUFFER_SIZE - 1)) != 0
+#error "SCI_TX_BUFFER_SIZE must be a power of two"
+#endif
+
+__interrupt void scia_tx_isr(void);
+__interrupt void cpu_timer0_isr(void);
+
+Uint16 sciTxStorage[SCI_TX_BUFFER_SIZE];
+RingBuffer sciTxRing;
+Telemetry telemetry;
+Uint32 logCallCycles;           // Cycles of the last timed Log2 call
+Uint32 logCallCyclesMax;        // Worst case seen
+Uint32 timerTicks;
+volatile Uint32 sciTxIsrCount;  // Number of TX interrupts serviced
+volatile Uint32 sciTxByteCount; // Number of bytes written to the TX FIFO
+
+void InitGpio()
+{
+    EALLOW;
+    GpioCtrlRegs.GPAPUD.bit.GPIO28 = 0;   // Enable pull-up on GPIO28 (SCIRXDA)
+    GpioCtrlRegs.GPAPUD.bit.GPIO29 = 0;   // Enable pull-up on GPIO29 (SCITXDA)
+    GpioCtrlRegs.GPAQSEL2.bit.GPIO28 = 3; // Asynchronous input GPIO28 (SCIRXDA)
+    GpioCtrlRegs.GPAMUX2.bit.GPIO28 = 1;  // Configure GPIO28 as SCIRXDA
+    GpioCtrlRegs.GPAMUX2.bit.GPIO29 = 1;  // Configure GPIO29 as SCITXDA
+    EDIS;
+}
+
+void InitScia()
+{
+    RingBufferInit(&sciTxRing, sciTxStorage, SCI_TX_BUFFER_SIZE);
+    TelemetryInit(&telemetry, &sciTxRing);
+
+    EALLOW;
+    SysCtrlRegs.PCLKCR0.bit.SCIAENCLK = 1; // Enable SCI-A clock
+    SciaRegs.SCICCR.all = 0x0007;         // 1 stop bit, No loopback, No parity, 8 char bits, async mode, idle-line protocol
+    SciaRegs.SCICTL1.all = 0x0003;        // Enable TX, RX, internal SCICLK
+    SciaRegs.SCICTL2.all = 0x0001;        // Enable TX interrupt
+    SciaRegs.SCICTL1.all = 0x0023;        // Relinquish SCI from Reset
+    SciaRegs.SCIHBAUD = SCI_BRR >> 8;     // Set baud rate to about 115200
+    SciaRegs.SCILBAUD = SCI_BRR & 0xFF;
+    SciaRegs.SCIFFTX.all = 0xC000 | SCI_TX_FIFO_LEVEL; // Enable FIFO enhancements, TX FIFO interrupt enabled when data is queued
+    SciaRegs.SCIFFCT.all = 0x0;
+    SciaRegs.SCIFFTX.bit.TXFIFOXRESET = 1; // Release TX FIFO from reset
+    EDIS;
+}
+
+// Let scia_tx_isr drain any published frames
+void SciaStartTx()
+{
+    SciaRegs.SCIFFTX.bit.TXFFIENA = 1;
+}
+
+void InitCpuTimer1()
+{
+    EALLOW;
+    CpuTimer1Regs.PRD.all = 0xFFFFFFFF; // Maximum period
+    CpuTimer1Regs.TPR.all = 0;          // Count every SYSCLKOUT cycle
+    CpuTimer1Regs.TPRH.all = 0;
+    CpuTimer1Regs.TCR.bit.TSS = 1;    // Stop the timer
+    CpuTimer1Regs.TCR.bit.TRB = 1;    // Reload the timer
+    CpuTimer1Regs.TCR.bit.TIE = 0;    // No timer interrupt
+    CpuTimer1Regs.TCR.bit.TSS = 0;    // Start the timer
+    EDIS;
+}
+
+void InitTimer()
+{
+    InitCpuTimers();
+    ConfigCpuTimer(&CpuTimer0, 60, 1000); // Configure CPU-Timer 0 to interrupt every 1 ms
+
+    EALLOW;
+    PieVectTable.TINT0 = &cpu_timer0_isr; // Map ISR to the PIE vector table
+    EDIS;
+
+    IER |= M_INT1; // Enable CPU INT1
+    PieCtrlRegs.PIEIER1.bit.INTx7 = 1; // Enable PIE Group 1 interrupt 7 (TINT0)
+
+    CpuTimer0Regs.TCR.all = 0x4000; // Start CPU-Timer 0
+}
+
+void main(void)
+{
+    Uint32 start;
+    Uint32 loops = 0;
+
+    InitSysCtrl(); // Initialize the CPU and configure the clock
+    DINT;          // Disable CPU interrupts
+
+    InitGpio();    // Initialize the GPIO
+    InitScia();    // Initialize the UART
+    LogInit();     // Empty log ring
+
+    InitPieCtrl(); // Initialize the PIE control registers
+    InitPieVectTable(); // Initialize the PIE vector table
+
+    EALLOW;
+    PieVectTable.SCITXINTA = &scia_tx_isr; // Map TX ISR to the PIE vector table
+    EDIS;
+
+    IER |= M_INT9; // Enable CPU INT9
+    PieCtrlRegs.PIEIER9.bit.INTx2 = 1; // Enable PIE Group 9 interrupt 2 (TX)
+
+    InitTimer();   // Start the 1 ms tick
+    InitCpuTimer1(); // Log timestamps; after InitTimer, whose InitCpuTimers call stops CPU Timer 1
+
+    EINT;  // Enable Global interrupt INTM
+    ERTM;  // Enable Global realtime interrupt DBGM
+
+    Log1(LOG_BOOT, 60);
+
+    while(1)
+    {
+        // Time one log call
+        start = CpuTimer1Regs.TIM.all;
+        Log2(LOG_LOOP, loops, timerTicks);
+        logCallCycles = start - CpuTimer1Regs.TIM.all; // Timer counts down
+        if(logCallCycles > logCallCyclesMax)
+        {
+            logCallCyclesMax = logCallCycles;
+        }
+        if((loops & 0x3FF) == 0)
+        {
+            Log2(LOG_CALL_CYCLES, logCallCycles, logCallCyclesMax);
+            Log3(LOG_SCI_STATS, sciTxIsrCount, sciTxByteCount, telemetry.drops);
+        }
+        loops++;
+
+        // Drain in the background
+        while(LogFlush(&telemetry))
+        {
+            SciaStartTx();
+        }
+
+        DELAY_US(10000); // 100 loop entries per second
+    }
+}
+
+__interrupt void cpu_timer0_isr(void)
+{
+    timerTicks++;
+    if((timerTicks % 250) == 0)
+    {
+        Log1(LOG_TIMER_TICK, timerTicks); // Safe inside an ISR, nothing is formatted here
+    }
+
+    CpuTimer0Regs.TCR.bit.TIF = 1; // Clear Timer interrupt flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP1; // Acknowledge interrupt
+}
+
+__interrupt void scia_tx_isr(void)
+{
+    Uint16 freeSlots = SCI_FIFO_DEPTH - SciaRegs.SCIFFTX.bit.TXFFST; // Fill every free FIFO slot
+    Uint16 txByte;
+
+    while(freeSlots--)
+    {
+        if(!RingBufferGet(&sciTxRing, &txByte))
+        {
+            SciaRegs.SCIFFTX.bit.TXFFIENA = 0; // Ring empty, stop TX interrupts until more frames are published
+            break;
+        }
+        SciaRegs.SCITXBUF = txByte; // Send next byte
+        sciTxByteCount++;
+    }
+    sciTxIsrCount++;
+
+    SciaRegs.SCIFFTX.bit.TXFFINTCLR = 1; // Clear TX interrupt flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP9; // Acknowledge interrupt
+}
@@ -0,0 +1,388 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Models SCI-A of the UART_Receive_Echo example on a Linux host, one bit time per step: a sender that streams
+ * characters (10 bits each) with injected framing errors, parity errors and breaks, the 4-deep RX FIFO with its
+ * overflow flag, the RX interrupt (level 1, receive errors) and the TX FIFO interrupt serviced a given latency after
+ * they are requested, and the transmitter that shifts the echoes out. RxIsr and TxIsr take the same steps as
+ * scia_rx_isr and scia_tx_isr in main.c on the model registers, with the echo ring of ring.h.
+ *
+ * It checks that every character read is either echoed or counted (framing, parity or echo ring full), so
+ * sciRxCount = echoed + dropped; that the echoes are the good characters in order; that the error counters match the
+ * injected errors; that characters lost to an RX FIFO overflow while the RX interrupt was late are counted once per
+ * overflow in sciRxOverrunCount; and that no RX interrupt reads more than SCI_FIFO_DEPTH characters.
+ * The exit status is 1 if any check fails.
+ *
+ * Build: gcc -O2 -I../../UART_Communication -o rx_echo_model rx_echo_model.c
+ */
+
+#include "ring.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+typedef uint32_t Uint32;
+
+#define SCI_ECHO_BUFFER_SIZE 64    // Echo ring size of main.c
+#define SCI_FIFO_DEPTH       4     // SCI-A TX/RX FIFO depth
+#define SCI_CHAR_BITS        10    // Start bit, 8 data bits, stop bit
+#define SCI_RXBUF_SCIFFFE    0x8000 // Framing error flag of the character in SCIRXBUF
+#define SCI_RXBUF_SCIFFPE    0x4000 // Parity error flag of the character in SCIRXBUF
+#define MODEL_CHARS          20000L // Characters sent per scenario
+#define MODEL_LOG            (MODEL_CHARS + 16)
+
+static int failures;
+
+typedef struct
+{
+    int framingPerMille; // Characters sent with a framing error
+    int parityPerMille;  // Characters sent with a parity error
+    int breakPerMille;   // Breaks sent instead of a character
+    int maxGap;          // Idle bit times between characters, 0 to maxGap
+    int rxLatency;       // Bit times from the RX interrupt request to scia_rx_isr
+    int rxLateEvery;     // Every n-th RX interrupt is serviced rxLateLatency bit times late, 0 for never
+    int rxLateLatency;
+    int txLatency;       // Bit times from the TX interrupt request to scia_tx_isr
+    long txHeldUntil;    // TX interrupt not serviced before this bit time
+} ModelConfig;
+
+typedef struct
+{
+    // SCI-A registers
+    Uint16 rxFifo[SCI_FIFO_DEPTH]; // SCIRXBUF entries, oldest first, with SCIFFFE/SCIFFPE
+    int rxffst;                    // SCIFFRX.RXFFST
+    int rxffovf;                   // SCIFFRX.RXFFOVF
+    int rxerror;                   // SCIRXST.RXERROR
+    int brkdt;                     // SCIRXST.BRKDT
+    int oe;                        // SCIRXST.OE, never set with the FIFO enabled
+    Uint16 txFifo[SCI_FIFO_DEPTH];
+    int txffst;                    // SCIFFTX.TXFFST
+    int txffiena;                  // SCIFFTX.TXFFIENA
+    // Counters of main.c
+    Uint32 sciRxCount, sciRxOverrunCount, sciRxFramingCount, sciRxParityCount, sciRxBreakCount, sciEchoDropCount;
+    Uint16 echoStorage[SCI_ECHO_BUFFER_SIZE];
+    RingBuffer echoRing;
+    // Model bookkeeping
+    int maxPerIsr;                 // Most characters read by one RX interrupt
+} Sci;
+
+typedef struct
+{
+    long sent, framing, parity, breaks; // Injected by the sender
+    long lost;                 // Characters that found the RX FIFO full
+    long overflows;            // Times RXFFOVF went from 0 to 1
+    Uint16 good[MODEL_LOG];    // Good characters stored in the RX FIFO, in order
+    long goodCount;
+    Uint16 echoed[MODEL_LOG];  // Characters shifted out by the transmitter
+    long echoedCount;
+} ModelLog;
+
+static Sci sci;
+static ModelLog model;
+
+static void Check(const char *name, int ok)
+{
+    printf("  %-52s %s\n", name, ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        failures++;
+    }
+}
+
+// SCIRXBUF read: the oldest FIFO entry with its error flags
+static Uint16 SciRead(void)
+{
+    Uint16 rxChar = sci.rxFifo[0];
+    int i;
+
+    for(i = 1; i < sci.rxffst; i++)
+    {
+        sci.rxFifo[i - 1] = sci.rxFifo[i];
+    }
+    sci.rxffst--;
+    return rxChar;
+}
+
+// Same steps as scia_rx_isr in main.c
+static void RxIsr(void)
+{
+    Uint16 pending = sci.rxffst; // Drain the whole RX FIFO
+    Uint16 rxChar;
+    Uint16 queued = 0;
+
+    if(pending > sci.maxPerIsr)
+    {
+        sci.maxPerIsr = pending;
+    }
+    while(pending--)
+    {
+        rxChar = SciRead();
+        sci.sciRxCount++;
+        if(rxChar & SCI_RXBUF_SCIFFFE)
+        {
+            sci.sciRxFramingCount++;
+        }
+        else if(rxChar & SCI_RXBUF_SCIFFPE)
+        {
+            sci.sciRxParityCount++;
+        }
+        else if(RingBufferPut(&sci.echoRing, rxChar & 0xFF))
+        {
+            queued = 1;
+        }
+        else
+        {
+            sci.sciEchoDropCount++;
+        }
+    }
+
+    if(sci.rxffovf)
+    {
+        sci.sciRxOverrunCount++;
+        sci.rxffovf = 0; // RXFFOVRCLR
+    }
+    if(sci.rxerror)
+    {
+        if(sci.oe)
+        {
+            sci.sciRxOverrunCount++;
+        }
+        if(sci.brkdt)
+        {
+            sci.sciRxBreakCount++;
+        }
+        sci.rxerror = sci.brkdt = sci.oe = 0; // SWRESET
+    }
+
+    if(queued)
+    {
+        sci.txffiena = 1;
+    }
+}
+
+// Same steps as scia_tx_isr in main.c
+static void TxIsr(void)
+{
+    Uint16 freeSlots = SCI_FIFO_DEPTH - sci.txffst; // Fill every free FIFO slot
+    Uint16 txChar;
+
+    while(freeSlots--)
+    {
+        if(!RingBufferGet(&sci.echoRing, &txChar))
+        {
+            sci.txffiena = 0;
+            break;
+        }
+        sci.txFifo[sci.txffst++] = txChar;
+    }
+}
+
+// A character or break has been shifted in completely
+static void Receive(const ModelConfig *cfg, Uint16 value)
+{
+    int r = rand() % 1000;
+    Uint16 flags = 0;
+
+    if(r < cfg->breakPerMille)
+    {
+        model.breaks++;
+        sci.brkdt = 1;
+        sci.rxerror = 1;
+        return;
+    }
+    model.sent++;
+    r -= cfg->breakPerMille;
+    if(r < cfg->framingPerMille)
+    {
+        flags = SCI_RXBUF_SCIFFFE;
+        model.framing++;
+    }
+    else if(r < cfg->framingPerMille + cfg->parityPerMille)
+    {
+        flags = SCI_RXBUF_SCIFFPE;
+        model.parity++;
+    }
+
+    if(sci.rxffst == SCI_FIFO_DEPTH)
+    {
+        model.overflows += !sci.rxffovf;
+        sci.rxffovf = 1;
+        model.lost++;
+        return;
+    }
+    sci.rxFifo[sci.rxffst++] = flags | value;
+    if(flags == 0)
+    {
+        model.good[model.goodCount++] = value;
+    }
+}
+
+static void RunModel(const ModelConfig *cfg)
+{
+    long t;
+    long nextChar = SCI_CHAR_BITS;  // Bit time the next character is complete
+    long rxIsrDue = -1, txIsrDue = -1;
+    long rxIsrs = 0;
+    long idle = 0;
+    int shifting = 0;               // Bits left in the TX shift register
+    Uint16 value = 0;
+    int i;
+
+    sci = (Sci){ 0 };
+    model = (ModelLog){ 0 };
+    RingBufferInit(&sci.echoRing, sci.echoStorage, SCI_ECHO_BUFFER_SIZE);
+    srand(1);
+
+    for(t = 0; idle < 100; t++)
+    {
+        // Sender
+        if(t == nextChar && model.sent + model.breaks < MODEL_CHARS)
+        {
+            Receive(cfg, value++ & 0xFF);
+            nextChar = t + SCI_CHAR_BITS + (cfg->maxGap ? rand() % (cfg->maxGap + 1) : 0);
+        }
+
+        // RX interrupt: RXFFST >= 1 or a receive error
+        if(rxIsrDue < 0 && (sci.rxffst > 0 || sci.rxerror))
+        {
+            rxIsrs++;
+            rxIsrDue = t + ((cfg->rxLateEvery && rxIsrs % cfg->rxLateEvery == 0) ? cfg->rxLateLatency : cfg->rxLatency);
+        }
+        if(rxIsrDue == t)
+        {
+            RxIsr();
+            rxIsrDue = -1;
+        }
+
+        // Transmitter
+        if(shifting == 0 && sci.txffst > 0)
+        {
+            model.echoed[model.echoedCount++] = sci.txFifo[0];
+            for(i = 1; i < sci.txffst; i++)
+            {
+                sci.txFifo[i - 1] = sci.txFifo[i];
+            }
+            sci.txffst--;
+            shifting = SCI_CHAR_BITS;
+        }
+        if(shifting > 0)
+        {
+            shifting--;
+        }
+
+        // TX interrupt: TXFFST <= 0 while enabled
+        if(txIsrDue < 0 && sci.txffiena && sci.txffst == 0)
+        {
+            txIsrDue = t + cfg->txLatency;
+        }
+        if(txIsrDue >= 0 && t >= txIsrDue && t >= cfg->txHeldUntil)
+        {
+            TxIsr();
+            txIsrDue = -1;
+        }
+
+        idle = (model.sent + model.breaks >= MODEL_CHARS && rxIsrDue < 0 && txIsrDue < 0 && shifting == 0 &&
+                sci.txffst == 0 && sci.rxffst == 0 && !sci.rxerror) ? idle + 1 : 0;
+    }
+}
+
+// Echoes equal the good characters (exact), or are them in order with some left out (echo ring full)
+static int EchoesMatch(int exact)
+{
+    long g = 0, e;
+
+    if(exact && model.echoedCount != model.goodCount)
+    {
+        return 0;
+    }
+    for(e = 0; e < model.echoedCount; e++)
+    {
+        while(g < model.goodCount && model.good[g] != model.echoed[e])
+        {
+            if(exact)
+            {
+                return 0;
+            }
+            g++;
+        }
+        if(g == model.goodCount)
+        {
+            return 0;
+        }
+        g++;
+    }
+    return 1;
+}
+
+static int Accounted(void)
+{
+    return sci.sciRxCount == model.echoedCount + sci.sciRxFramingCount + sci.sciRxParityCount + sci.sciEchoDropCount;
+}
+
+static void PrintCounters(const char *name)
+{
+    printf("  %s: %lu read, %ld echoed, %lu framing, %lu parity, %lu breaks, %lu overruns (%ld lost), %lu ring full\n",
+           name, (unsigned long)sci.sciRxCount, model.echoedCount, (unsigned long)sci.sciRxFramingCount,
+           (unsigned long)sci.sciRxParityCount, (unsigned long)sci.sciRxBreakCount,
+           (unsigned long)sci.sciRxOverrunCount, model.lost, (unsigned long)sci.sciEchoDropCount);
+}
+
+static void TestClean(void)
+{
+    ModelConfig cfg = { 0, 0, 0, 0, 5, 0, 0, 5, 0 }; // Back-to-back characters
+
+    RunModel(&cfg);
+    PrintCounters("clean");
+    Check("clean stream: every character echoed in order", sci.sciRxCount == MODEL_CHARS && EchoesMatch(1));
+    Check("clean stream: no error counted", sci.sciRxOverrunCount == 0 && sci.sciRxFramingCount == 0 &&
+          sci.sciRxParityCount == 0 && sci.sciRxBreakCount == 0 && sci.sciEchoDropCount == 0);
+}
+
+static void TestErrors(void)
+{
+    ModelConfig cfg = { 20, 10, 5, 15, 5, 0, 0, 5, 0 }; // 2% framing, 1% parity, 0.5% breaks
+
+    RunModel(&cfg);
+    PrintCounters("errors");
+    Check("errors: received = echoed + dropped", Accounted() && sci.sciRxCount == model.sent);
+    Check("errors: framing and parity errors counted, not echoed",
+          sci.sciRxFramingCount == model.framing && sci.sciRxParityCount == model.parity && EchoesMatch(1));
+    Check("errors: every break counted", sci.sciRxBreakCount == model.breaks && model.breaks > 0);
+}
+
+static void TestOverflow(void)
+{
+    ModelConfig cfg = { 20, 0, 0, 0, 5, 50, 65, 5, 0 }; // Every 50th RX interrupt 6.5 characters late
+
+    RunModel(&cfg);
+    PrintCounters("late RX");
+    Check("late RX interrupt: lost characters in sciRxOverrunCount",
+          model.lost > 0 && sci.sciRxOverrunCount == model.overflows && sci.sciRxCount + model.lost == model.sent);
+    Check("late RX interrupt: received = echoed + dropped", Accounted() && EchoesMatch(1));
+    Check("no RX interrupt reads more than the FIFO depth", sci.maxPerIsr <= SCI_FIFO_DEPTH);
+}
+
+static void TestRingFull(void)
+{
+    ModelConfig cfg = { 20, 10, 0, 0, 5, 0, 0, 5, 2000 }; // TX interrupt held off for 200 characters
+
+    RunModel(&cfg);
+    PrintCounters("TX held");
+    Check("TX held off: echoes dropped when the ring is full", sci.sciEchoDropCount > 0);
+    Check("TX held off: received = echoed + dropped", Accounted() && EchoesMatch(0));
+}
+
+int main(void)
+{
+    TestClean();
+    TestErrors();
+    TestOverflow();
+    TestRingFull();
+
+    printf(failures ? "%d check(s) failed\n" : "All checks passed\n", failures);
+    return failures != 0;
+}
@@ -2,21 +2,51 @@
  * Author: Kiran Jojare
  * Email: kijo7257@colorado.edu
  * Date: Feb 28, 2024
- * Version: 1.0
+ * Version: 1.2
  *
  * Description:
  * This code demonstrates how to use the UART (Universal Asynchronous Receiver/Transmitter) module to receive data and echo it back on the Texas Instruments C2000 Piccolo LaunchPad Evaluation Kit (LAUNCHHXL-F28027F).
  * The UART is configured to communicate at a baud rate of 9600.
  *
- * The code initializes the system control and GPIO settings, configures the UART module, and handles data reception and transmission in an interrupt service routine (ISR).
+ * The code initializes the system control and GPIO settings, configures the UART module, and handles data reception and transmission in interrupt service routines (ISRs).
+ * The receive ISR drains the whole 4-deep RX FIFO and queues the echoes in a ring buffer for the transmit ISR, so neither ISR ever waits for the line.
+ * Receive errors and dropped echoes are counted, and the worst-case duration of each ISR is measured with CPU Timer 1.
+ * The ring buffer comes from ring.h of the UART_Communication example; add it from that folder to the project.
  *
  * This example is intended to help users get started with basic UART receive and echo operations on the F28027F microcontroller.
  */
 
 #include "F2802x_Device.h"
 #include "f2802x_examples.h"
+#include "ring.h"
+
+#define SCI_ECHO_BUFFER_SIZE 64 // Echo ring size (power of two)
+#define SCI_FIFO_DEPTH       4  // SCI-A TX/RX FIFO depth
+#define SCI_TX_FIFO_LEVEL    0  // TX FIFO interrupt when TXFFST <= level
+
+#define SCI_RXBUF_SCIFFFE    0x8000 // Framing error flag of the character in SCIRXBUF
+#define SCI_RXBUF_SCIFFPE    0x4000 // Parity error flag of the character in SCIRXBUF
+
+#if (SCI_ECHO_BUFFER_SIZE & (SCI_ECHO_BUFFER_SIZE - 1)) != 0
+#error "SCI_ECHO_BUFFER_SIZE must be a power of two"
+#endif
 
 __interrupt void scia_rx_isr(void);
+__interrupt void scia_tx_isr(void);
+
+Uint16 sciEchoStorage[SCI_ECHO_BUFFER_SIZE];
+RingBuffer sciEchoRing; // scia_rx_isr is the producer and scia_tx_isr is the consumer
+
+volatile Uint32 sciRxCount;         // Characters received
+volatile Uint32 sciRxOverrunCount;  // RX FIFO overflows and receiver overruns
+volatile Uint32 sciRxFramingCount;  // Characters with a framing error (not echoed)
+volatile Uint32 sciRxParityCount;   // Characters with a parity error (not echoed)
+volatile Uint32 sciRxBreakCount;    // Break conditions detected
+volatile Uint32 sciEchoDropCount;   // Echoes lost because the echo ring was full
+volatile Uint32 sciRxIsrCycles;     // Duration of the last scia_rx_isr
+volatile Uint32 sciRxIsrCyclesMax;  // Worst case seen
+volatile Uint32 sciTxIsrCycles;     // Duration of the last scia_tx_isr
+volatile Uint32 sciTxIsrCyclesMax;  // Worst case seen
 
 void InitGpio()
 {
@@ -31,14 +61,34 @@ void InitGpio()
 
 void InitScia()
 {
+    RingBufferInit(&sciEchoRing, sciEchoStorage, SCI_ECHO_BUFFER_SIZE);
+
     EALLOW;
     SysCtrlRegs.PCLKCR0.bit.SCIAENCLK = 1; // Enable SCI-A clock
     SciaRegs.SCICCR.all = 0x0007;         // 1 stop bit, No loopback, No parity, 8 char bits, async mode, idle-line protocol
     SciaRegs.SCICTL1.all = 0x0003;        // Enable TX, RX, internal SCICLK
     SciaRegs.SCICTL2.all = 0x0003;        // Enable TX, RX interrupts
-    SciaRegs.SCICTL1.all = 0x0023;        // Relinquish SCI from Reset
+    SciaRegs.SCICTL1.all = 0x0063;        // Relinquish SCI from Reset, RX errors raise the RX interrupt
     SciaRegs.SCIHBAUD = 0x0001;           // Set baud rate to 9600
     SciaRegs.SCILBAUD = 0x00E7;
+    SciaRegs.SCIFFTX.all = 0xC000 | SCI_TX_FIFO_LEVEL; // Enable FIFO enhancements, TX FIFO interrupt enabled when echoes are queued
+    SciaRegs.SCIFFRX.all = 0x0021;        // Enable RX FIFO interrupt, set RX FIFO level to 1
+    SciaRegs.SCIFFCT.all = 0x0;
+    SciaRegs.SCIFFTX.bit.TXFIFOXRESET = 1; // Release TX FIFO from reset
+    SciaRegs.SCIFFRX.bit.RXFIFORESET = 1;  // Release RX FIFO from reset
+    EDIS;
+}
+
+void InitCpuTimer1()
+{
+    EALLOW;
+    CpuTimer1Regs.PRD.all = 0xFFFFFFFF; // Maximum period
+    CpuTimer1Regs.TPR.all = 0;          // Count every SYSCLKOUT cycle
+    CpuTimer1Regs.TPRH.all = 0;
+    CpuTimer1Regs.TCR.bit.TSS = 1;    // Stop the timer
+    CpuTimer1Regs.TCR.bit.TRB = 1;    // Reload the timer
+    CpuTimer1Regs.TCR.bit.TIE = 0;    // No timer interrupt
+    CpuTimer1Regs.TCR.bit.TSS = 0;    // Start the timer
     EDIS;
 }
 
@@ -49,16 +99,19 @@ void main(void)
 
     InitGpio();    // Initialize the GPIO
     InitScia();    // Initialize the UART
+    InitCpuTimer1(); // Cycle counter for the ISR durations
 
     InitPieCtrl(); // Initialize the PIE control registers
     InitPieVectTable(); // Initialize the PIE vector table
 
     EALLOW;
-    PieVectTable.SCIRXINTA = &scia_rx_isr; // Map ISR to the PIE vector table
+    PieVectTable.SCIRXINTA = &scia_rx_isr; // Map RX ISR to the PIE vector table
+    PieVectTable.SCITXINTA = &scia_tx_isr; // Map TX ISR to the PIE vector table
     EDIS;
 
     IER |= M_INT9; // Enable CPU INT9
-    PieCtrlRegs.PIEIER9.bit.INTx1 = 1; // Enable PIE Group 9 interrupt 1
+    PieCtrlRegs.PIEIER9.bit.INTx1 = 1; // Enable PIE Group 9 interrupt 1 (RX)
+    PieCtrlRegs.PIEIER9.bit.INTx2 = 1; // Enable PIE Group 9 interrupt 2 (TX)
 
     EINT;  // Enable Global interrupt INTM
     ERTM;  // Enable Global realtime interrupt DBGM
@@ -66,14 +119,99 @@ void main(void)
     while(1) { }
 }
 
+/*
+ * Reads at most SCI_FIFO_DEPTH characters and never waits, so the ISR duration is bounded.
+ * The worst case is a full FIFO with an overflow, measured in sciRxIsrCyclesMax.
+ */
 __interrupt void scia_rx_isr(void)
 {
-    Uint16 receivedChar;
+    Uint32 start = CpuTimer1Regs.TIM.all;
+    Uint16 pending = SciaRegs.SCIFFRX.bit.RXFFST; // Drain the whole RX FIFO
+    Uint16 rxChar;
+    Uint16 queued = 0;
+    Uint32 cycles;
+
+    while(pending--)
+    {
+        rxChar = SciaRegs.SCIRXBUF.all; // Read received character and its error flags
+        sciRxCount++;
+        if(rxChar & SCI_RXBUF_SCIFFFE)
+        {
+            sciRxFramingCount++;
+        }
+        else if(rxChar & SCI_RXBUF_SCIFFPE)
+        {
+            sciRxParityCount++;
+        }
+        else if(RingBufferPut(&sciEchoRing, rxChar & 0xFF))
+        {
+            queued = 1;
+        }
+        else
+        {
+            sciEchoDropCount++; // Echo ring full
+        }
+    }
+
+    if(SciaRegs.SCIFFRX.bit.RXFFOVF)
+    {
+        sciRxOverrunCount++; // Characters were lost before this interrupt ran
+        SciaRegs.SCIFFRX.bit.RXFFOVRCLR = 1;
+    }
+    if(SciaRegs.SCIRXST.bit.RXERROR)
+    {
+        if(SciaRegs.SCIRXST.bit.OE)
+        {
+            sciRxOverrunCount++;
+        }
+        if(SciaRegs.SCIRXST.bit.BRKDT)
+        {
+            sciRxBreakCount++;
+        }
+        SciaRegs.SCICTL1.bit.SWRESET = 0; // Error flags are cleared only by a software reset
+        SciaRegs.SCICTL1.bit.SWRESET = 1;
+    }
 
-    receivedChar = SciaRegs.SCIRXBUF.all; // Read received character
-    while(SciaRegs.SCIFFTX.bit.TXFFST != 0); // Wait until TX FIFO is empty
-    SciaRegs.SCITXBUF = receivedChar; // Echo received character
+    if(queued)
+    {
+        SciaRegs.SCIFFTX.bit.TXFFIENA = 1; // Let scia_tx_isr send the echoes
+    }
 
-    SciaRegs.SCIFFRX.bit.RXFFINTCLR = 1; // Clear interrupt flag
+    SciaRegs.SCIFFRX.bit.RXFFINTCLR = 1; // Clear RX interrupt flag
     PieCtrlRegs.PIEACK.all = PIEACK_GROUP9; // Acknowledge interrupt
+
+    cycles = start - CpuTimer1Regs.TIM.all; // Timer counts down
+    sciRxIsrCycles = cycles;
+    if(cycles > sciRxIsrCyclesMax)
+    {
+        sciRxIsrCyclesMax = cycles;
+    }
+}
+
+__interrupt void scia_tx_isr(void)
+{
+    Uint32 start = CpuTimer1Regs.TIM.all;
+    Uint16 freeSlots = SCI_FIFO_DEPTH - SciaRegs.SCIFFTX.bit.TXFFST; // Fill every free FIFO slot
+    Uint16 txChar;
+    Uint32 cycles;
+
+    while(freeSlots--)
+    {
+        if(!RingBufferGet(&sciEchoRing, &txChar))
+        {
+            SciaRegs.SCIFFTX.bit.TXFFIENA = 0; // Ring empty, stop TX interrupts until more echoes are queued
+            break;
+        }
+        SciaRegs.SCITXBUF = txChar; // Echo received character
+    }
+
+    SciaRegs.SCIFFTX.bit.TXFFINTCLR = 1; // Clear TX interrupt flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP9; // Acknowledge interrupt
+
+    cycles = start - CpuTimer1Regs.TIM.all; // Timer counts down
+    sciTxIsrCycles = cycles;
+    if(cycles > sciTxIsrCyclesMax)
+    {
+        sciTxIsrCyclesMax = cycles;
+    }
 }
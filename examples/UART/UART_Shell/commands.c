@@ -0,0 +1,197 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.1
+ *
+ * Description:
+ * Commands and tunable variables of the UART_Shell example.
+ *
+ * To add a command, write its handler, run host/shell_sim -s to get a seed and slots without collisions,
+ * update SHELL_HASH_SEED in shell.h if it changed, and put every command in its slot below. ShellCheckTable
+ * reports any command in the wrong slot at startup.
+ */
+
+#include "shell.h"
+
+typedef struct
+{
+    const char *name;
+    int32 *value;
+    int32 min;
+    int32 max;
+} ShellVariable;
+
+// Tunables, read by the control code in the main loop
+int32 controlKp = 2048;       // Proportional gain, Q12
+int32 controlKi = 64;         // Integral gain, Q12
+int32 controlSetpoint = 2048; // ADC counts
+
+const ShellVariable shellVariables[] =
+{
+    { "kp",       &controlKp,       0, 32767 },
+    { "ki",       &controlKi,       0, 32767 },
+    { "setpoint", &controlSetpoint, 0, 4095 },
+};
+
+#define SHELL_NUM_VARIABLES (sizeof(shellVariables) / sizeof(shellVariables[0]))
+
+// Counters owned by the SCI driver in main.c
+extern volatile Uint32 sciRxDropCount;
+extern volatile Uint32 sciTxDropCount;
+extern volatile Uint32 sciTxIsrCount;
+extern volatile Uint32 sciTxByteCount;
+
+static const ShellVariable *FindVariable(Shell *shell, const char *name)
+{
+    Uint16 i;
+
+    for(i = 0; i < SHELL_NUM_VARIABLES; i++)
+    {
+        if(ShellStringEqual(shellVariables[i].name, name))
+        {
+            return &shellVariables[i];
+        }
+    }
+    shell->errors++;
+    ShellWrite(shell, "Unknown variable: ");
+    ShellWrite(shell, name);
+    ShellWrite(shell, "\r\n");
+    return 0;
+}
+
+static void WriteVariable(Shell *shell, const ShellVariable *var)
+{
+    ShellWrite(shell, var->name);
+    ShellWrite(shell, " = ");
+    ShellWriteInt32(shell, *var->value);
+    ShellWrite(shell, "\r\n");
+}
+
+static void WriteCounter(Shell *shell, const char *name, Uint32 value)
+{
+    ShellWrite(shell, name);
+    ShellWriteUint32(shell, value);
+    ShellWrite(shell, "\r\n");
+}
+
+static void CommandHelp(Shell *shell, Uint16 argc, char **argv)
+{
+    Uint16 slot;
+
+    (void)argc;
+    (void)argv;
+    for(slot = 0; slot < SHELL_HASH_SIZE; slot++)
+    {
+        if(shellCommands[slot].name != 0)
+        {
+            ShellWrite(shell, shellCommands[slot].help);
+            ShellWrite(shell, "\r\n");
+        }
+    }
+}
+
+static void CommandGet(Shell *shell, Uint16 argc, char **argv)
+{
+    const ShellVariable *var;
+
+    if(argc != 2)
+    {
+        shell->errors++;
+        ShellWrite(shell, "Usage: get <name>\r\n");
+        return;
+    }
+    var = FindVariable(shell, argv[1]);
+    if(var != 0)
+    {
+        WriteVariable(shell, var);
+    }
+}
+
+static void CommandSet(Shell *shell, Uint16 argc, char **argv)
+{
+    const ShellVariable *var;
+    int32 value;
+
+    if(argc != 3)
+    {
+        shell->errors++;
+        ShellWrite(shell, "Usage: set <name> <value>\r\n");
+        return;
+    }
+    var = FindVariable(shell, argv[1]);
+    if(var == 0)
+    {
+        return;
+    }
+    if(!ShellParseInt32(argv[2], &value) || value < var->min || value > var->max)
+    {
+        shell->errors++;
+        ShellWrite(shell, "Value must be ");
+        ShellWriteInt32(shell, var->min);
+        ShellWrite(shell, " to ");
+        ShellWriteInt32(shell, var->max);
+        ShellWrite(shell, "\r\n");
+        return;
+    }
+    *var->value = value; // A single 32-bit store, so the control code never sees half a value
+    WriteVariable(shell, var);
+}
+
+static void CommandVars(Shell *shell, Uint16 argc, char **argv)
+{
+    Uint16 i;
+
+    (void)argc;
+    (void)argv;
+    for(i = 0; i < SHELL_NUM_VARIABLES; i++)
+    {
+        WriteVariable(shell, &shellVariables[i]);
+    }
+}
+
+static void CommandCounters(Shell *shell, Uint16 argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    WriteCounter(shell, "rx dropped    ", sciRxDropCount);
+    WriteCounter(shell, "tx dropped    ", sciTxDropCount);
+    WriteCounter(shell, "tx interrupts ", sciTxIsrCount);
+    WriteCounter(shell, "tx bytes      ", sciTxByteCount);
+    WriteCounter(shell, "commands      ", shell->commands);
+    WriteCounter(shell, "errors        ", shell->errors);
+}
+
+static void CommandReset(Shell *shell, Uint16 argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    sciRxDropCount = 0;
+    sciTxDropCount = 0;
+    sciTxIsrCount = 0;
+    sciTxByteCount = 0;
+    shell->commands = 0;
+    shell->errors = 0;
+    ShellWrite(shell, "Counters cleared\r\n");
+}
+
+// Each command sits in slot ShellHash(name) for SHELL_HASH_SEED 1
+const ShellCommand shellCommands[SHELL_HASH_SIZE] =
+{
+    { "reset",    CommandReset,    "reset            Clear the counters" },    // 0
+    { 0, 0, 0 },                                                                // 1
+    { 0, 0, 0 },                                                                // 2
+    { "vars",     CommandVars,     "vars             List all variables" },     // 3
+    { "help",     CommandHelp,     "help             List the commands" },      // 4
+    { 0, 0, 0 },                                                                // 5
+    { 0, 0, 0 },                                                                // 6
+    { 0, 0, 0 },                                                                // 7
+    { 0, 0, 0 },                                                                // 8
+    { 0, 0, 0 },                                                                // 9
+    { "get",      CommandGet,      "get <name>       Show a variable" },        // 10
+    { 0, 0, 0 },                                                                // 11
+    { "counters", CommandCounters, "counters         Show the SCI and shell counters" }, // 12
+    { 0, 0, 0 },                                                                // 13
+    { "set",      CommandSet,      "set <name> <v>   Change a variable" },      // 14
+    { 0, 0, 0 },                                                                // 15
+};
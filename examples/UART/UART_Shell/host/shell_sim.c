@@ -0,0 +1,131 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Runs the UART_Shell command shell on a Linux host. Standard input plays the part of the SCI receiver:
+ * it is moved into a receive ring up to four bytes at a time, like scia_rx_isr, and the main loop feeds
+ * the ring to ShellInput exactly as on the target. Shell output goes to standard output.
+ *
+ *     printf 'set kp 100\nget kp\n' | ./shell_sim
+ *     ./shell_sim -s     Find the smallest SHELL_HASH_SEED that gives every command its own slot
+ *
+ * Build: gcc -O2 -I.. -o shell_sim shell_sim.c ../shell.c ../commands.c
+ */
+
+#include "shell.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#define SIM_RX_BUFFER_SIZE 64 // Same as SCI_RX_BUFFER_SIZE in main.c
+#define SIM_FIFO_DEPTH     4
+
+// Counters normally owned by the SCI driver in main.c
+volatile Uint32 sciRxDropCount;
+volatile Uint32 sciTxDropCount;
+volatile Uint32 sciTxIsrCount;
+volatile Uint32 sciTxByteCount;
+
+static unsigned char rxRing[SIM_RX_BUFFER_SIZE];
+static unsigned rxHead, rxTail;
+
+static void SimWrite(const char *text, Uint16 length)
+{
+    fwrite(text, 1, length, stdout);
+    sciTxIsrCount += (length + SIM_FIFO_DEPTH - 1) / SIM_FIFO_DEPTH;
+    sciTxByteCount += length;
+}
+
+// Hash with an arbitrary seed, the same function as ShellHash
+static unsigned HashWithSeed(const char *name, unsigned seed)
+{
+    unsigned h = seed & 0xFFFF;
+
+    while(*name != '\0')
+    {
+        h = ((h * 33) ^ (unsigned char)*name++) & 0xFFFF;
+    }
+    return (h ^ (h >> 5)) & (SHELL_HASH_SIZE - 1);
+}
+
+static int SearchSeed(void)
+{
+    unsigned seed, slot, used, bit;
+
+    for(seed = 1; seed <= 0xFFFF; seed++)
+    {
+        used = 0;
+        for(slot = 0; slot < SHELL_HASH_SIZE; slot++)
+        {
+            if(shellCommands[slot].name == 0)
+            {
+                continue;
+            }
+            bit = 1U << HashWithSeed(shellCommands[slot].name, seed);
+            if(used & bit)
+            {
+                break;
+            }
+            used |= bit;
+        }
+        if(slot == SHELL_HASH_SIZE)
+        {
+            printf("SHELL_HASH_SEED %u\n", seed);
+            for(slot = 0; slot < SHELL_HASH_SIZE; slot++)
+            {
+                if(shellCommands[slot].name != 0)
+                {
+                    printf("  %-12s slot %u\n", shellCommands[slot].name, HashWithSeed(shellCommands[slot].name, seed));
+                }
+            }
+            return 0;
+        }
+    }
+    printf("No seed found, increase SHELL_HASH_SIZE\n");
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    static Shell shell;
+    unsigned char input[SIM_FIFO_DEPTH];
+    ssize_t n, i;
+
+    if(argc > 1 && strcmp(argv[1], "-s") == 0)
+    {
+        return SearchSeed();
+    }
+    if(ShellCheckTable() != 0)
+    {
+        fprintf(stderr, "Command table does not match SHELL_HASH_SEED, run shell_sim -s\n");
+        return 1;
+    }
+
+    ShellInit(&shell, SimWrite);
+    while((n = read(STDIN_FILENO, input, sizeof(input))) > 0)
+    {
+        // Receive interrupt: move the FIFO contents into the ring
+        for(i = 0; i < n; i++)
+        {
+            if(rxHead - rxTail < SIM_RX_BUFFER_SIZE)
+            {
+                rxRing[rxHead++ % SIM_RX_BUFFER_SIZE] = input[i];
+            }
+            else
+            {
+                sciRxDropCount++;
+            }
+        }
+        // Main loop
+        while(rxTail != rxHead)
+        {
+            ShellInput(&shell, rxRing[rxTail++ % SIM_RX_BUFFER_SIZE]);
+        }
+    }
+    printf("\n");
+    return shell.errors != 0;
+}
@@ -0,0 +1,177 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.2
+ *
+ * Description:
+ * This code demonstrates a command shell on the UART (SCI-A) of the Texas Instruments C2000 Piccolo LaunchPad
+ * Evaluation Kit (LAUNCHHXL-F28027F), for tuning gains and reading counters on a running system without reflashing.
+ * The UART is configured to communicate at a baud rate of 9600.
+ *
+ * The SCI driver is the ring-buffered driver from the UART_Communication example. The shell (shell.c) runs only from
+ * the main loop: the interrupts just move bytes between the FIFOs and the rings, so the shell adds no ISR latency.
+ * Commands are found through a perfect hash table (commands.c), and arguments are split in place without heap.
+ * Add shell.c, shell.h and commands.c from this folder to the project.
+ * The ring buffer comes from ring.h of the UART_Communication example; add it from that folder to the project.
+ *
+ * This example is intended to help users interact with a running F28027F microcontroller from a terminal.
+ */
+
+#include "F2802x_Device.h"
+#include "f2802x_examples.h"
+#include "ring.h"
+#include "shell.h"
+
+#define SCI_TX_BUFFER_SIZE 512 // Transmit ring size (power of two), holds the longest command output
+#define SCI_RX_BUFFER_SIZE 64  // Receive ring size (power of two)
+#define SCI_FIFO_DEPTH     4   // SCI-A TX/RX FIFO depth
+#define SCI_TX_FIFO_LEVEL  0   // TX FIFO interrupt when TXFFST <= level
+
+#if ((SCI_TX_BUFFER_SIZE & (SCI_TX_BUFFER_SIZE - 1)) != 0) || ((SCI_RX_BUFFER_SIZE & (SCI_RX_BUFFER_SIZE - 1)) != 0)
+#error "SCI buffer sizes must be powers of two"
+#endif
+
+__interrupt void scia_rx_isr(void);
+__interrupt void scia_tx_isr(void);
+
+Uint16 sciTxStorage[SCI_TX_BUFFER_SIZE];
+Uint16 sciRxStorage[SCI_RX_BUFFER_SIZE];
+RingBuffer sciTxRing;
+RingBuffer sciRxRing;
+Shell shell;
+Uint16 shellTableErrors; // Commands in the wrong hash slot, should be 0
+const char shellTableMessage[] = "\r\nCommand table does not match SHELL_HASH_SEED, run host/shell_sim -s";
+volatile Uint32 sciRxDropCount; // Received bytes lost because the RX ring was full
+volatile Uint32 sciTxDropCount; // Shell output lost because the TX ring was full
+volatile Uint32 sciTxIsrCount;  // Number of TX interrupts serviced
+volatile Uint32 sciTxByteCount; // Number of characters written to the TX FIFO
+
+void InitGpio()
+{
+    EALLOW;
+    GpioCtrlRegs.GPAPUD.bit.GPIO28 = 0;   // Enable pull-up on GPIO28 (SCIRXDA)
+    GpioCtrlRegs.GPAPUD.bit.GPIO29 = 0;   // Enable pull-up on GPIO29 (SCITXDA)
+    GpioCtrlRegs.GPAQSEL2.bit.GPIO28 = 3; // Asynchronous input GPIO28 (SCIRXDA)
+    GpioCtrlRegs.GPAMUX2.bit.GPIO28 = 1;  // Configure GPIO28 as SCIRXDA
+    GpioCtrlRegs.GPAMUX2.bit.GPIO29 = 1;  // Configure GPIO29 as SCITXDA
+    EDIS;
+}
+
+void InitScia()
+{
+    RingBufferInit(&sciTxRing, sciTxStorage, SCI_TX_BUFFER_SIZE);
+    RingBufferInit(&sciRxRing, sciRxStorage, SCI_RX_BUFFER_SIZE);
+
+    EALLOW;
+    SysCtrlRegs.PCLKCR0.bit.SCIAENCLK = 1; // Enable SCI-A clock
+    SciaRegs.SCICCR.all = 0x0007;         // 1 stop bit, No loopback, No parity, 8 char bits, async mode, idle-line protocol
+    SciaRegs.SCICTL1.all = 0x0003;        // Enable TX, RX, internal SCICLK
+    SciaRegs.SCICTL2.all = 0x0003;        // Enable TX, RX interrupts
+    SciaRegs.SCICTL1.all = 0x0023;        // Relinquish SCI from Reset
+    SciaRegs.SCIHBAUD = 0x0001;           // Set baud rate to 9600
+    SciaRegs.SCILBAUD = 0x00E7;
+    SciaRegs.SCIFFTX.all = 0xC000 | SCI_TX_FIFO_LEVEL; // Enable FIFO enhancements, TX FIFO interrupt enabled when data is queued
+    SciaRegs.SCIFFRX.all = 0x0021;        // Enable RX FIFO interrupt, set RX FIFO level to 1
+    SciaRegs.SCIFFCT.all = 0x0;
+    SciaRegs.SCIFFTX.bit.TXFIFOXRESET = 1; // Release TX FIFO from reset
+    SciaRegs.SCIFFRX.bit.RXFIFORESET = 1;  // Release RX FIFO from reset
+    EDIS;
+}
+
+// Shell output: queue without waiting, count what does not fit
+void SciaShellWrite(const char *text, Uint16 length)
+{
+    Uint16 i;
+
+    for(i = 0; i < length; i++)
+    {
+        if(!RingBufferPut(&sciTxRing, (Uint16)text[i] & 0xFF))
+        {
+            sciTxDropCount += length - i;
+            break;
+        }
+    }
+    SciaRegs.SCIFFTX.bit.TXFFIENA = 1; // Let scia_tx_isr drain the ring
+}
+
+void main(void)
+{
+    Uint16 rxChar;
+
+    InitSysCtrl(); // Initialize the CPU and configure the clock
+    DINT;          // Disable CPU interrupts
+
+    InitGpio();    // Initialize the GPIO
+    InitScia();    // Initialize the UART
+
+    InitPieCtrl(); // Initialize the PIE control registers
+    InitPieVectTable(); // Initialize the PIE vector table
+
+    EALLOW;
+    PieVectTable.SCIRXINTA = &scia_rx_isr; // Map RX ISR to the PIE vector table
+    PieVectTable.SCITXINTA = &scia_tx_isr; // Map TX ISR to the PIE vector table
+    EDIS;
+
+    IER |= M_INT9; // Enable CPU INT9
+    PieCtrlRegs.PIEIER9.bit.INTx1 = 1; // Enable PIE Group 9 interrupt 1 (RX)
+    PieCtrlRegs.PIEIER9.bit.INTx2 = 1; // Enable PIE Group 9 interrupt 2 (TX)
+
+    EINT;  // Enable Global interrupt INTM
+    ERTM;  // Enable Global realtime interrupt DBGM
+
+    shellTableErrors = ShellCheckTable();
+    if(shellTableErrors != 0)
+    {
+        // Misplaced commands answer "Unknown command", so say why on the terminal before the first prompt
+        SciaShellWrite(shellTableMessage, sizeof(shellTableMessage) - 1);
+    }
+    ShellInit(&shell, SciaShellWrite);
+
+    while(1)
+    {
+        while(RingBufferGet(&sciRxRing, &rxChar))
+        {
+            ShellInput(&shell, rxChar); // Commands run here, never in an ISR
+        }
+
+        // Control code runs here and reads controlKp, controlKi and controlSetpoint
+    }
+}
+
+__interrupt void scia_rx_isr(void)
+{
+    Uint16 pending = SciaRegs.SCIFFRX.bit.RXFFST; // Drain the whole RX FIFO
+
+    while(pending--)
+    {
+        if(!RingBufferPut(&sciRxRing, SciaRegs.SCIRXBUF.all & 0xFF)) // Read received character
+        {
+            sciRxDropCount++; // RX ring full
+        }
+    }
+
+    SciaRegs.SCIFFRX.bit.RXFFINTCLR = 1; // Clear RX interrupt flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP9; // Acknowledge interrupt
+}
+
+__interrupt void scia_tx_isr(void)
+{
+    Uint16 freeSlots = SCI_FIFO_DEPTH - SciaRegs.SCIFFTX.bit.TXFFST; // Fill every free FIFO slot
+    Uint16 txChar;
+
+    while(freeSlots--)
+    {
+        if(!RingBufferGet(&sciTxRing, &txChar))
+        {
+            SciaRegs.SCIFFTX.bit.TXFFIENA = 0; // Ring empty, stop TX interrupts until more data is queued
+            break;
+        }
+        SciaRegs.SCITXBUF = txChar; // Send next character
+        sciTxByteCount++;
+    }
+    sciTxIsrCount++;
+
+    SciaRegs.SCIFFTX.bit.TXFFINTCLR = 1; // Clear TX interrupt flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP9; // Acknowledge interrupt
+}
@@ -0,0 +1,264 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Line editing, argument splitting, perfect hash dispatch and number conversion for the UART_Shell example.
+ */
+
+#include "shell.h"
+
+#define SHELL_PROMPT "> "
+
+/*
+ * djb2-style string hash folded to SHELL_HASH_SIZE slots. All arithmetic is done modulo 2^16,
+ * so the C28x (16-bit int) and a host give the same slot.
+ */
+Uint16 ShellHash(const char *name)
+{
+    Uint16 h = SHELL_HASH_SEED;
+
+    while(*name != '\0')
+    {
+        h = ((h * 33) ^ (*name++ & 0xFF)) & 0xFFFF;
+    }
+    return (h ^ (h >> 5)) & (SHELL_HASH_SIZE - 1);
+}
+
+// Returns the number of commands that are not in the slot their name hashes to (0 when the table is correct)
+Uint16 ShellCheckTable(void)
+{
+    Uint16 slot;
+    Uint16 misplaced = 0;
+
+    for(slot = 0; slot < SHELL_HASH_SIZE; slot++)
+    {
+        if(shellCommands[slot].name != 0 && ShellHash(shellCommands[slot].name) != slot)
+        {
+            misplaced++;
+        }
+    }
+    return misplaced;
+}
+
+Uint16 ShellStringEqual(const char *a, const char *b)
+{
+    while(*a != '\0' && *a == *b)
+    {
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+void ShellWrite(Shell *shell, const char *text)
+{
+    Uint16 length = 0;
+
+    while(text[length] != '\0')
+    {
+        length++;
+    }
+    shell->write(text, length);
+}
+
+void ShellWriteUint32(Shell *shell, Uint32 value)
+{
+    char digits[11];
+    Uint16 pos = sizeof(digits);
+
+    do
+    {
+        digits[--pos] = '0' + (char)(value % 10);
+        value /= 10;
+    } while(value != 0);
+    shell->write(&digits[pos], sizeof(digits) - pos);
+}
+
+void ShellWriteInt32(Shell *shell, int32 value)
+{
+    if(value < 0)
+    {
+        shell->write("-", 1);
+        ShellWriteUint32(shell, (Uint32)0 - (Uint32)value);
+    }
+    else
+    {
+        ShellWriteUint32(shell, (Uint32)value);
+    }
+}
+
+// Parse a decimal number with an optional sign, or a hex number with a 0x prefix; returns 0 if the text is not a number
+Uint16 ShellParseInt32(const char *text, int32 *value)
+{
+    Uint32 result = 0;
+    Uint32 limit = 0x7FFFFFFFUL;
+    Uint16 negative = 0;
+    Uint16 base = 10;
+    Uint16 digit;
+
+    if(*text == '-' || *text == '+')
+    {
+        negative = (*text == '-');
+        limit += negative; // -2^31 is allowed
+        text++;
+    }
+    if(text[0] == '0' && (text[1] == 'x' || text[1] == 'X'))
+    {
+        base = 16;
+        limit = 0xFFFFFFFFUL; // Hex gives the raw 32-bit pattern
+        text += 2;
+    }
+    if(*text == '\0')
+    {
+        return 0;
+    }
+    while(*text != '\0')
+    {
+        if(*text >= '0' && *text <= '9')
+        {
+            digit = *text - '0';
+        }
+        else if(base == 16 && (*text | 0x20) >= 'a' && (*text | 0x20) <= 'f')
+        {
+            digit = (*text | 0x20) - 'a' + 10;
+        }
+        else
+        {
+            return 0;
+        }
+        if(result > (limit - digit) / base)
+        {
+            return 0; // Out of range
+        }
+        result = result * base + digit;
+        text++;
+    }
+    *value = negative ? (int32)((Uint32)0 - result) : (int32)result;
+    return 1;
+}
+
+// Split a line into arguments in place at spaces and tabs; returns the number of arguments
+Uint16 ShellSplit(char *line, char **argv, Uint16 maxArgs)
+{
+    Uint16 argc = 0;
+
+    while(*line != '\0')
+    {
+        while(*line == ' ' || *line == '\t')
+        {
+            *line++ = '\0';
+        }
+        if(*line == '\0')
+        {
+            break;
+        }
+        if(argc == maxArgs)
+        {
+            return maxArgs + 1; // Too many arguments
+        }
+        argv[argc++] = line;
+        while(*line != '\0' && *line != ' ' && *line != '\t')
+        {
+            line++;
+        }
+    }
+    return argc;
+}
+
+// Look up argv[0] with one hash and one compare and run it; returns 0 for an unknown command
+Uint16 ShellExecute(Shell *shell, Uint16 argc, char **argv)
+{
+    const ShellCommand *command = &shellCommands[ShellHash(argv[0])];
+
+    if(command->name == 0 || !ShellStringEqual(command->name, argv[0]))
+    {
+        shell->errors++;
+        ShellWrite(shell, "Unknown command: ");
+        ShellWrite(shell, argv[0]);
+        ShellWrite(shell, "\r\n");
+        return 0;
+    }
+    shell->commands++;
+    command->handler(shell, argc, argv);
+    return 1;
+}
+
+void ShellInit(Shell *shell, ShellWriteFn write)
+{
+    shell->length = 0;
+    shell->overflow = 0;
+    shell->write = write;
+    shell->commands = 0;
+    shell->errors = 0;
+    ShellWrite(shell, "\r\n" SHELL_PROMPT);
+}
+
+static void ShellEndLine(Shell *shell)
+{
+    char *argv[SHELL_MAX_ARGS];
+    Uint16 argc;
+
+    ShellWrite(shell, "\r\n");
+    shell->line[shell->length] = '\0';
+    if(shell->overflow)
+    {
+        shell->errors++;
+        ShellWrite(shell, "Line too long\r\n");
+    }
+    else
+    {
+        argc = ShellSplit(shell->line, argv, SHELL_MAX_ARGS);
+        if(argc > SHELL_MAX_ARGS)
+        {
+            shell->errors++;
+            ShellWrite(shell, "Too many arguments\r\n");
+        }
+        else if(argc != 0)
+        {
+            ShellExecute(shell, argc, argv);
+        }
+    }
+    shell->length = 0;
+    shell->overflow = 0;
+    ShellWrite(shell, SHELL_PROMPT);
+}
+
+// Feed one received character: echo it, handle backspace, and run the line on CR or LF
+void ShellInput(Shell *shell, Uint16 c)
+{
+    char ch = (char)(c & 0xFF);
+
+    if(ch == '\r' || ch == '\n')
+    {
+        if(shell->length != 0 || shell->overflow || ch == '\r')
+        {
+            ShellEndLine(shell);
+        }
+        return; // LF after CR is ignored
+    }
+    if(ch == '\b' || ch == 0x7F)
+    {
+        if(shell->length != 0)
+        {
+            shell->length--;
+            shell->write("\b \b", 3);
+        }
+        return;
+    }
+    if(ch < ' ' || ch > '~')
+    {
+        return; // Ignore other control characters
+    }
+    if(shell->length < SHELL_LINE_LENGTH - 1)
+    {
+        shell->line[shell->length++] = ch;
+        shell->write(&ch, 1);
+    }
+    else
+    {
+        shell->overflow = 1;
+    }
+}
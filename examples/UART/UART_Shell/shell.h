@@ -0,0 +1,69 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Line-oriented command shell for the UART_Shell example. Characters are fed in one at a time from the main loop,
+ * and a complete line is split into arguments in place and dispatched through a perfect hash table, so a command
+ * is found with one hash and one string compare. No heap is used. The shell does not touch peripheral registers,
+ * so it builds unchanged on the C28x and on a host (see host/shell_sim.c).
+ */
+
+#ifndef SHELL_H
+#define SHELL_H
+
+#ifdef __TMS320C2000__
+#include "F2802x_Device.h"
+#else
+#include <stdint.h>
+typedef uint16_t Uint16;
+typedef uint32_t Uint32;
+typedef int32_t int32;
+#endif
+
+#define SHELL_LINE_LENGTH 64  // Longest command line, including the terminator
+#define SHELL_MAX_ARGS    8   // Most arguments per line, including the command name
+#define SHELL_HASH_SIZE   16  // Command table slots (power of two)
+#define SHELL_HASH_SEED   1   // Chosen with host/shell_sim -s so that no two commands share a slot
+
+typedef struct Shell Shell;
+
+typedef void (*ShellWriteFn)(const char *text, Uint16 length);
+typedef void (*ShellHandler)(Shell *shell, Uint16 argc, char **argv);
+
+typedef struct
+{
+    const char *name;      // Command name, 0 for an empty slot
+    ShellHandler handler;
+    const char *help;      // One-line description for the help command
+} ShellCommand;
+
+struct Shell
+{
+    char line[SHELL_LINE_LENGTH]; // Line being typed
+    Uint16 length;                // Characters in line
+    Uint16 overflow;              // Line was too long, discard it at the end
+    ShellWriteFn write;           // Output, must not block in an ISR-sensitive system
+    Uint32 commands;              // Commands executed
+    Uint32 errors;                // Unknown commands, bad arguments and overlong lines
+};
+
+// Command table, indexed by ShellHash(name); defined by the application
+extern const ShellCommand shellCommands[SHELL_HASH_SIZE];
+
+void ShellInit(Shell *shell, ShellWriteFn write);
+void ShellInput(Shell *shell, Uint16 c);
+Uint16 ShellHash(const char *name);
+Uint16 ShellCheckTable(void);
+Uint16 ShellSplit(char *line, char **argv, Uint16 maxArgs);
+Uint16 ShellExecute(Shell *shell, Uint16 argc, char **argv);
+Uint16 ShellStringEqual(const char *a, const char *b);
+Uint16 ShellParseInt32(const char *text, int32 *value);
+
+void ShellWrite(Shell *shell, const char *text);
+void ShellWriteInt32(Shell *shell, int32 value);
+void ShellWriteUint32(Shell *shell, Uint32 value);
+
+#endif // SHELL_H
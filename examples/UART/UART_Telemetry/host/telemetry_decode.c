@@ -0,0 +1,144 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.1
+ *
+ * Description:
+ * Linux command line decoder for the UART_Telemetry stream.
+ *
+ *     telemetry_decode [-q] [/dev/ttyACM0 | capture.bin | -]
+ *
+ * A serial device is set to raw 115200 baud. Each good frame is printed as one line,
+ * and a summary with the error counters is printed at the end of the input.
+ * -q prints only the summary.
+ *
+ * Build: gcc -O2 -I../../../CRC/CRC_Engine -o telemetry_decode telemetry_decode.c telemetry_decoder.c ../../../CRC/CRC_Engine/crc.c
+ */
+
+#include "telemetry_decoder.h"
+
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <termios.h>
+#include <unistd.h>
+
+static int quiet;
+
+static void PrintFrame(const TelemetryFrame *frame, void *context)
+{
+    const uint8_t *p = frame->payload;
+    size_t i, count;
+
+    (void)context;
+    if(quiet)
+    {
+        return;
+    }
+
+    switch(frame->type)
+    {
+    case TELEMETRY_ADC_BLOCK:
+        if(frame->length < 6)
+        {
+            break;
+        }
+        count = TelemetryGetUint16(p + 4);
+        if(frame->length != 6 + 2 * count)
+        {
+            break;
+        }
+        printf("%3u adc t=%u n=%u", frame->seq, (unsigned)TelemetryGetUint32(p), (unsigned)count);
+        for(i = 0; i < count; i++)
+        {
+            printf(" %u", TelemetryGetUint16(p + 6 + 2 * i));
+        }
+        printf("\n");
+        return;
+
+    case TELEMETRY_ENCODER:
+        if(frame->length != 12)
+        {
+            break;
+        }
+        printf("%3u encoder t=%u position=%d velocity=%d\n", frame->seq, (unsigned)TelemetryGetUint32(p),
+               (int32_t)TelemetryGetUint32(p + 4), (int32_t)TelemetryGetUint32(p + 8));
+        return;
+
+    case TELEMETRY_COUNTERS:
+        if(frame->length != 16)
+        {
+            break;
+        }
+        printf("%3u counters frames=%u drops=%u txIsr=%u txBytes=%u\n", frame->seq,
+               (unsigned)TelemetryGetUint32(p), (unsigned)TelemetryGetUint32(p + 4),
+               (unsigned)TelemetryGetUint32(p + 8), (unsigned)TelemetryGetUint32(p + 12));
+        return;
+    }
+    printf("%3u type=0x%02X length=%u\n", frame->seq, frame->type, (unsigned)frame->length);
+}
+
+static int OpenInput(const char *path)
+{
+    struct termios tio;
+    int fd;
+
+    if(strcmp(path, "-") == 0)
+    {
+        return STDIN_FILENO;
+    }
+    fd = open(path, O_RDONLY | O_NOCTTY);
+    if(fd < 0)
+    {
+        perror(path);
+        return -1;
+    }
+    if(isatty(fd) && tcgetattr(fd, &tio) == 0)
+    {
+        cfmakeraw(&tio);
+        cfsetispeed(&tio, B115200);
+        cfsetospeed(&tio, B115200);
+        tio.c_cc[VMIN] = 1;
+        tio.c_cc[VTIME] = 0;
+        tcsetattr(fd, TCSANOW, &tio);
+    }
+    return fd;
+}
+
+int main(int argc, char **argv)
+{
+    static TelemetryDecoder dec;
+    uint8_t buffer[4096];
+    const char *path = "-";
+    ssize_t n;
+    int fd, i;
+
+    for(i = 1; i < argc; i++)
+    {
+        if(strcmp(argv[i], "-q") == 0)
+        {
+            quiet = 1;
+        }
+        else
+        {
+            path = argv[i];
+        }
+    }
+
+    fd = OpenInput(path);
+    if(fd < 0)
+    {
+        return 1;
+    }
+
+    TelemetryDecoderInit(&dec, PrintFrame, NULL);
+    while((n = read(fd, buffer, sizeof(buffer))) > 0)
+    {
+        TelemetryDecoderFeed(&dec, buffer, (size_t)n);
+    }
+
+    fprintf(stderr, "bytes=%llu frames=%u lost=%u crcErrors=%u formatErrors=%u\n",
+            (unsigned long long)dec.bytes, dec.frames, dec.lostFrames, dec.crcErrors, dec.formatErrors);
+    return 0;
+}
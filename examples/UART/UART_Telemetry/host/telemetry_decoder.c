@@ -0,0 +1,128 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.1
+ *
+ * Description:
+ * COBS frame decoder, CRC-16/CCITT-FALSE check and sequence tracking for the UART_Telemetry stream.
+ */
+
+#include "telemetry_decoder.h"
+
+#include <string.h>
+
+// Decode one COBS frame without its delimiter; returns the decoded length, or 0 if the coding is invalid
+size_t CobsDecode(const uint8_t *in, size_t length, uint8_t *out)
+{
+    size_t read = 0;
+    size_t written = 0;
+
+    while(read < length)
+    {
+        uint8_t code = in[read++];
+        uint8_t i;
+
+        if(code == 0 || read + code - 1 > length)
+        {
+            return 0; // Zero inside a frame or block runs past the end
+        }
+        for(i = 1; i < code; i++)
+        {
+            out[written++] = in[read++];
+        }
+        if(code != 0xFF && read < length)
+        {
+            out[written++] = 0; // Implied zero between blocks
+        }
+    }
+    return written;
+}
+
+void TelemetryDecoderInit(TelemetryDecoder *dec, TelemetryHandler handler, void *context)
+{
+    memset(dec, 0, sizeof(*dec));
+    CrcSlice8Init();
+    dec->handler = handler;
+    dec->context = context;
+}
+
+static void TelemetryDecoderFrame(TelemetryDecoder *dec)
+{
+    TelemetryFrame frame;
+    size_t length = CobsDecode(dec->encoded, dec->count, dec->decoded);
+    uint16_t crc;
+
+    if(length < 4)
+    {
+        dec->formatErrors++;
+        return;
+    }
+    crc = (uint16_t)(dec->decoded[length - 2] | (dec->decoded[length - 1] << 8));
+    if(Crc16Slice8(CRC16_INIT, dec->decoded, length - 2) != crc)
+    {
+        dec->crcErrors++;
+        return;
+    }
+
+    frame.seq = dec->decoded[0];
+    frame.type = dec->decoded[1];
+    frame.payload = &dec->decoded[2];
+    frame.length = length - 4;
+
+    if(dec->haveSeq)
+    {
+        dec->lostFrames += (uint8_t)(frame.seq - dec->nextSeq);
+    }
+    dec->haveSeq = 1;
+    dec->nextSeq = (uint8_t)(frame.seq + 1);
+    dec->frames++;
+
+    if(dec->handler)
+    {
+        dec->handler(&frame, dec->context);
+    }
+}
+
+void TelemetryDecoderFeed(TelemetryDecoder *dec, const uint8_t *data, size_t length)
+{
+    size_t i;
+
+    dec->bytes += length;
+    for(i = 0; i < length; i++)
+    {
+        uint8_t byte = data[i];
+
+        if(byte == 0)
+        {
+            if(dec->overflow)
+            {
+                dec->formatErrors++;
+            }
+            else if(dec->count != 0)
+            {
+                TelemetryDecoderFrame(dec);
+            }
+            dec->count = 0;
+            dec->overflow = 0;
+        }
+        else if(dec->count < TELEMETRY_MAX_FRAME)
+        {
+            dec->encoded[dec->count++] = byte;
+        }
+        else
+        {
+            dec->overflow = 1; // Lost delimiter, skip to the next one
+        }
+    }
+}
+
+uint16_t TelemetryGetUint16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+uint32_t TelemetryGetUint32(const uint8_t *p)
+{
+    return (uint32_t)TelemetryGetUint16(p) | ((uint32_t)TelemetryGetUint16(p + 2) << 16);
+}
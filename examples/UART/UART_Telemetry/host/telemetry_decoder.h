@@ -0,0 +1,64 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.3
+ *
+ * Description:
+ * Host-side decoder for the COBS framed telemetry stream sent by the UART_Telemetry example.
+ * Bytes are fed in as they arrive. Every 0x00 ends a frame, so after corrupted or missing
+ * bytes the decoder drops at most one frame and resynchronizes on the next delimiter.
+ */
+
+#ifndef TELEMETRY_DECODER_H
+#define TELEMETRY_DECODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "crc.h" // examples/CRC/CRC_Engine
+
+#define TELEMETRY_ADC_BLOCK  0x01 // Record types, must match telemetry.h
+#define TELEMETRY_ENCODER    0x02
+#define TELEMETRY_COUNTERS   0x03
+#define TELEMETRY_LOG        0x04 // UART_Logging entries
+
+#define TELEMETRY_MAX_FRAME  1024 // Largest encoded frame accepted
+
+typedef struct
+{
+    uint8_t seq;            // Sequence number
+    uint8_t type;           // Record type
+    const uint8_t *payload; // Payload bytes, valid only during the callback
+    size_t length;          // Payload length
+} TelemetryFrame;
+
+typedef void (*TelemetryHandler)(const TelemetryFrame *frame, void *context);
+
+typedef struct
+{
+    uint8_t encoded[TELEMETRY_MAX_FRAME]; // Bytes received since the last delimiter
+    uint8_t decoded[TELEMETRY_MAX_FRAME];
+    size_t count;             // Bytes in encoded
+    int overflow;             // Discarding until the next delimiter
+    int haveSeq;              // A previous sequence number is known
+    uint8_t nextSeq;          // Expected next sequence number
+    TelemetryHandler handler;
+    void *context;
+
+    uint32_t frames;          // Good frames delivered
+    uint32_t crcErrors;       // Frames with a bad CRC
+    uint32_t formatErrors;    // Frames with bad COBS coding, too short or too long
+    uint32_t lostFrames;      // Frames missing according to the sequence numbers
+    uint64_t bytes;           // Bytes fed in
+} TelemetryDecoder;
+
+size_t CobsDecode(const uint8_t *in, size_t length, uint8_t *out);
+
+void TelemetryDecoderInit(TelemetryDecoder *dec, TelemetryHandler handler, void *context);
+void TelemetryDecoderFeed(TelemetryDecoder *dec, const uint8_t *data, size_t length);
+
+uint16_t TelemetryGetUint16(const uint8_t *p);
+uint32_t TelemetryGetUint32(const uint8_t *p);
+
+#endif // TELEMETRY_DECODER_H
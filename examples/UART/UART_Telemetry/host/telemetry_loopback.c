@@ -0,0 +1,308 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * Loopback test of the UART_Telemetry frame writer (telemetry.c) against the host decoder on a Linux host.
+ *
+ * The main loop of main.c runs against the 512-byte TX ring, and the ring is drained one character per character
+ * time of the 117187 baud line, as scia_tx_isr keeps the TX FIFO full. Every byte sent is fed to the decoder.
+ * Every frame must decode with no CRC, format or sequence errors and with the record contents the main loop sent,
+ * the main loop must not drop any record, the line must be busy for every character time, and the framing must
+ * cost exactly 6 bytes per frame (sequence, type, CRC, COBS code byte and delimiter). It prints the payload
+ * throughput against the line rate. With single bit errors injected on the line, no damaged frame may be delivered
+ * and each error may cost at most two frames. It then prints the host time to encode and to decode a 32-sample ADC
+ * block. The exit status is 1 if any check fails.
+ *
+ * Build: gcc -O2 -I.. -I../../UART_Communication -I../../../CRC/CRC_Engine -o telemetry_loopback telemetry_loopback.c
+ *        telemetry_decoder.c ../telemetry.c ../../../CRC/CRC_Engine/crc.c
+ */
+
+#include "telemetry.h"
+#include "telemetry_decoder.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define LOOPBACK_RING_SIZE    512     // SCI_TX_BUFFER_SIZE of main.c
+#define LOOPBACK_ADC_SAMPLES  32      // TELEMETRY_ADC_SAMPLES of main.c
+#define LOOPBACK_GROUP_BYTES  (TELEMETRY_FRAME_BYTES(6 + 2 * LOOPBACK_ADC_SAMPLES) + TELEMETRY_FRAME_BYTES(12) + \
+                               TELEMETRY_FRAME_BYTES(16)) // TELEMETRY_GROUP_BYTES of main.c
+#define LOOPBACK_CHAR_TIMES   1000000L // Characters on the line per run, about 85 s at 117187 baud
+#define LOOPBACK_CHUNK        64      // Bytes per decoder feed, like a serial read
+#define LINE_CHARS_PER_SECOND (117187.0 / 10) // Start bit, 8 data bits, stop bit
+#define BENCH_FRAMES          200000L
+
+static int failures;
+
+typedef struct
+{
+    uint32_t frames;        // Frames delivered by the decoder
+    uint32_t bad;           // Delivered frames whose contents differ from what was sent
+    uint32_t lastTimestamp; // Timestamp of the last ADC block, to check the order
+    int haveTimestamp;
+    uint64_t payloadBytes;  // Payload bytes delivered
+    uint32_t adcBlocks;
+    uint32_t encoders;
+} Checker;
+
+typedef struct
+{
+    Uint16 storage[LOOPBACK_RING_SIZE];
+    RingBuffer ring;
+    Telemetry tm;
+    Uint32 timestamp;       // State of the main loop
+    int32 position;
+    Uint32 txBytes;         // sciTxByteCount
+} Target;
+
+static void Check(const char *name, int ok)
+{
+    printf("  %-52s %s\n", name, ok ? "ok" : "FAIL");
+    if(!ok)
+    {
+        failures++;
+    }
+}
+
+static double Now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Synthetic sawtooth of main.c
+static Uint16 Sample(Uint32 timestamp, Uint16 i)
+{
+    return (Uint16)((timestamp + i) << 6) & 0x0FFF;
+}
+
+// Compare each delivered record with what the main loop sent
+static void CheckFrame(const TelemetryFrame *frame, void *context)
+{
+    Checker *c = (Checker *)context;
+    const uint8_t *p = frame->payload;
+    uint32_t timestamp;
+    int ok = 0;
+    Uint16 i;
+
+    c->frames++;
+    c->payloadBytes += frame->length;
+    switch(frame->type)
+    {
+    case TELEMETRY_ADC_BLOCK:
+        if(frame->length != 6 + 2 * LOOPBACK_ADC_SAMPLES || TelemetryGetUint16(p + 4) != LOOPBACK_ADC_SAMPLES)
+        {
+            break;
+        }
+        timestamp = TelemetryGetUint32(p);
+        ok = !c->haveTimestamp || timestamp > c->lastTimestamp;
+        for(i = 0; i < LOOPBACK_ADC_SAMPLES; i++)
+        {
+            ok &= (TelemetryGetUint16(p + 6 + 2 * i) == Sample(timestamp, i));
+        }
+        c->lastTimestamp = timestamp;
+        c->haveTimestamp = 1;
+        c->adcBlocks++;
+        break;
+
+    case TELEMETRY_ENCODER:
+        timestamp = TelemetryGetUint32(p);
+        ok = frame->length == 12 && (int32_t)TelemetryGetUint32(p + 4) == 3 * (int32_t)(timestamp + 1)
+             && (int32_t)TelemetryGetUint32(p + 8) == 3;
+        c->encoders++;
+        break;
+
+    case TELEMETRY_COUNTERS:
+        ok = frame->length == 16 && (TelemetryGetUint32(p) & 0xFF) == frame->seq; // Frames sent before this one
+        break;
+    }
+    c->bad += !ok;
+}
+
+static void TargetInit(Target *t)
+{
+    RingBufferInit(&t->ring, t->storage, LOOPBACK_RING_SIZE);
+    TelemetryInit(&t->tm, &t->ring);
+    t->timestamp = 0;
+    t->position = 0;
+    t->txBytes = 0;
+}
+
+// One pass of the while(1) loop of main.c
+static void MainLoop(Target *t)
+{
+    Uint16 samples[LOOPBACK_ADC_SAMPLES];
+    Uint16 i;
+
+    for(i = 0; i < LOOPBACK_ADC_SAMPLES; i++)
+    {
+        samples[i] = Sample(t->timestamp, i);
+    }
+    if(RingBufferFree(&t->ring) >= LOOPBACK_GROUP_BYTES)
+    {
+        TelemetrySendAdcBlock(&t->tm, t->timestamp, samples, LOOPBACK_ADC_SAMPLES);
+        t->position += 3;
+        TelemetrySendEncoder(&t->tm, t->timestamp, t->position, 3);
+        if((t->timestamp & 0x3F) == 0)
+        {
+            TelemetrySendCounters(&t->tm, t->txBytes / 4, t->txBytes); // One TX interrupt per 4 bytes
+        }
+        t->timestamp++;
+    }
+}
+
+/*
+ * Runs the main loop once per character time and sends one character per character time.
+ * A bit is flipped in a random character every errorInterval characters on average (0 for none),
+ * except near the end so the last frames always arrive. Returns the number of errors injected.
+ */
+static long RunLine(Target *t, TelemetryDecoder *dec, long errorInterval, long *busy)
+{
+    uint8_t chunk[LOOPBACK_CHUNK];
+    size_t count = 0;
+    Uint16 byte;
+    long n, errors = 0;
+
+    *busy = 0;
+    for(n = 0; n < LOOPBACK_CHAR_TIMES; n++)
+    {
+        MainLoop(t);
+        if(RingBufferGet(&t->ring, &byte))
+        {
+            if(errorInterval && n < LOOPBACK_CHAR_TIMES - 1000 && rand() % errorInterval == 0)
+            {
+                byte ^= 1 << (rand() % 8);
+                errors++;
+            }
+            chunk[count++] = (uint8_t)byte;
+            t->txBytes++;
+            (*busy)++;
+        }
+        if(count == LOOPBACK_CHUNK)
+        {
+            TelemetryDecoderFeed(dec, chunk, count);
+            count = 0;
+        }
+    }
+    while(RingBufferGet(&t->ring, &byte)) // Let the line finish the frames already published
+    {
+        chunk[count++] = (uint8_t)byte;
+        t->txBytes++;
+        if(count == LOOPBACK_CHUNK)
+        {
+            TelemetryDecoderFeed(dec, chunk, count);
+            count = 0;
+        }
+    }
+    TelemetryDecoderFeed(dec, chunk, count);
+    return errors;
+}
+
+static void TestLoopback(void)
+{
+    static Target t;
+    static TelemetryDecoder dec;
+    Checker c = { 0 };
+    double seconds, payloadRate;
+    long busy;
+
+    TargetInit(&t);
+    TelemetryDecoderInit(&dec, CheckFrame, &c);
+    RunLine(&t, &dec, 0, &busy);
+
+    seconds = LOOPBACK_CHAR_TIMES / LINE_CHARS_PER_SECOND;
+    payloadRate = c.payloadBytes / seconds;
+    printf("Loopback, %ld characters (%.1f s at 117187 baud):\n", LOOPBACK_CHAR_TIMES, seconds);
+    printf("    %u frames, %u ADC blocks (%.0f samples/s), payload %.0f B/s = %.1f%% of the line rate\n",
+           (unsigned)c.frames, (unsigned)c.adcBlocks, c.adcBlocks * LOOPBACK_ADC_SAMPLES / seconds, payloadRate,
+           100.0 * payloadRate / LINE_CHARS_PER_SECOND);
+    Check("every frame decoded, no CRC or format errors",
+          dec.frames == t.tm.frames && dec.crcErrors == 0 && dec.formatErrors == 0);
+    Check("no sequence gaps, every record as sent", dec.lostFrames == 0 && c.bad == 0);
+    Check("no record dropped by the main loop", t.tm.drops == 0 && c.encoders == c.adcBlocks);
+    Check("line busy for every character time", busy == LOOPBACK_CHAR_TIMES);
+    Check("framing costs exactly 6 bytes per frame", c.payloadBytes + TELEMETRY_FRAME_BYTES(0) * (uint64_t)c.frames == dec.bytes);
+    Check("payload above 85% of the line rate", payloadRate >= 0.85 * LINE_CHARS_PER_SECOND);
+}
+
+static void TestLineErrors(void)
+{
+    static Target t;
+    static TelemetryDecoder dec;
+    Checker c = { 0 };
+    long errors, busy;
+
+    srand(1);
+    TargetInit(&t);
+    TelemetryDecoderInit(&dec, CheckFrame, &c);
+    errors = RunLine(&t, &dec, 2000, &busy);
+
+    printf("Loopback with %ld single bit errors:\n", errors);
+    printf("    %u frames sent, %u delivered, %u CRC errors, %u format errors, %u lost\n", (unsigned)t.tm.frames,
+           (unsigned)dec.frames, (unsigned)dec.crcErrors, (unsigned)dec.formatErrors, (unsigned)dec.lostFrames);
+    Check("bit errors: no damaged frame delivered", c.bad == 0 && c.frames == dec.frames);
+    Check("bit errors: every frame delivered or counted lost", dec.frames + dec.lostFrames == t.tm.frames);
+    Check("bit errors: at most 2 frames lost per error", errors > 0 && dec.lostFrames <= 2 * (uint32_t)errors);
+}
+
+static void Bench(void)
+{
+    static Target t;
+    static TelemetryDecoder dec;
+    static uint8_t line[1000 * 80];
+    Uint16 samples[LOOPBACK_ADC_SAMPLES];
+    Uint16 byte, i;
+    long n, length = 0;
+    double start, encode = 0, decode = 0;
+
+    TargetInit(&t);
+    TelemetryDecoderInit(&dec, NULL, NULL);
+    for(i = 0; i < LOOPBACK_ADC_SAMPLES; i++)
+    {
+        samples[i] = Sample(0, i);
+    }
+
+    for(n = 0; n < BENCH_FRAMES; n += 1000) // 1000 frames at a time
+    {
+        long k;
+
+        start = Now();
+        for(k = 0; k < 1000; k++)
+        {
+            TelemetrySendAdcBlock(&t.tm, (Uint32)(n + k), samples, LOOPBACK_ADC_SAMPLES);
+            while(RingBufferGet(&t.ring, &byte)) // Keep the ring empty, as the line would
+            {
+                line[length++] = (uint8_t)byte;
+            }
+        }
+        encode += Now() - start;
+
+        start = Now();
+        TelemetryDecoderFeed(&dec, line, (size_t)length);
+        decode += Now() - start;
+        length = 0;
+    }
+
+    printf("Host time per 32-sample ADC block (76 bytes on the line, %.2f ms at 117187 baud):\n",
+           76 * 1e3 / LINE_CHARS_PER_SECOND);
+    printf("  encode into the ring and drain  %8.1f ns\n", encode * 1e9 / BENCH_FRAMES);
+    printf("  decode, CRC check and deliver   %8.1f ns (%.0f MB/s)\n", decode * 1e9 / BENCH_FRAMES,
+           dec.bytes / decode * 1e-6);
+    Check("benchmark frames all decoded", dec.frames == BENCH_FRAMES && dec.crcErrors == 0);
+}
+
+int main(void)
+{
+    TestLoopback();
+    TestLineErrors();
+    Bench();
+
+    printf(failures ? "%d check(s) failed\n" : "All checks passed\n", failures);
+    return failures != 0;
+}
@@ -0,0 +1,156 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.3
+ *
+ * Description:
+ * This code demonstrates how to stream binary telemetry over the UART (SCI-A) on the Texas Instruments C2000 Piccolo
+ * LaunchPad Evaluation Kit (LAUNCHHXL-F28027F). The UART is configured to communicate at about 115200 baud.
+ *
+ * Each record (ADC block, encoder position, counters) is framed as
+ *     [seq] [type] [payload ...] [CRC-16 low] [CRC-16 high]
+ * and COBS (Consistent Overhead Byte Stuffing) encoded, so the only 0x00 on the line is the frame delimiter.
+ * A receiver that sees corrupted data simply waits for the next 0x00 and carries on.
+ *
+ * Record fields are encoded straight into the TX ring buffer storage as they are added, with no intermediate frame
+ * buffer. A frame is published to the TX interrupt only once it is complete, so the ISR never sends half a frame.
+ * Multi-byte fields are sent little-endian. The frame writer is in telemetry.c and telemetry.h, which the UART_Logging
+ * example uses as well. The host-side decoder and a loopback throughput test are in the host folder.
+ * The CRC comes from the shared CRC module; add crc.c and crc.h from examples/CRC/CRC_Engine to the project.
+ * The ring buffer comes from ring.h of the UART_Communication example; add it from that folder to the project.
+ *
+ * This example is intended to help users stream sensor data off the F28027F microcontroller.
+ */
+
+#include "F2802x_Device.h"
+#include "f2802x_examples.h"
+#include "telemetry.h"
+
+#define SCI_TX_BUFFER_SIZE 512 // Transmit ring size (power of two), holds several frames
+#define SCI_FIFO_DEPTH     4   // SCI-A TX FIFO depth
+#define SCI_TX_FIFO_LEVEL  0   // TX FIFO interrupt when TXFFST <= level
+#define SCI_BRR            15  // LSPCLK 15 MHz / ((15 + 1) * 8) = 117187 baud, 1.7% above 115200
+
+#define TELEMETRY_ADC_SAMPLES 32 // Samples per ADC block record
+#define TELEMETRY_GROUP_BYTES (TELEMETRY_FRAME_BYTES(6 + 2 * TELEMETRY_ADC_SAMPLES) + TELEMETRY_FRAME_BYTES(12) + \
+                               TELEMETRY_FRAME_BYTES(16)) // ADC block, encoder and counters records
+
+#if (SCI_TX_BUFFER_SIZE & (SCI_TX_BUFFER_SIZE - 1)) != 0
+#error "SCI_TX_BUFFER_SIZE must be a power of two"
+#endif
+
+__interrupt void scia_tx_isr(void);
+
+Uint16 sciTxStorage[SCI_TX_BUFFER_SIZE];
+RingBuffer sciTxRing;
+Telemetry telemetry;
+volatile Uint32 sciTxIsrCount;  // Number of TX interrupts serviced
+volatile Uint32 sciTxByteCount; // Number of bytes written to the TX FIFO
+
+void InitGpio()
+{
+    EALLOW;
+    GpioCtrlRegs.GPAPUD.bit.GPIO28 = 0;   // Enable pull-up on GPIO28 (SCIRXDA)
+    GpioCtrlRegs.GPAPUD.bit.GPIO29 = 0;   // Enable pull-up on GPIO29 (SCITXDA)
+    GpioCtrlRegs.GPAQSEL2.bit.GPIO28 = 3; // Asynchronous input GPIO28 (SCIRXDA)
+    GpioCtrlRegs.GPAMUX2.bit.GPIO28 = 1;  // Configure GPIO28 as SCIRXDA
+    GpioCtrlRegs.GPAMUX2.bit.GPIO29 = 1;  // Configure GPIO29 as SCITXDA
+    EDIS;
+}
+
+void InitScia()
+{
+    RingBufferInit(&sciTxRing, sciTxStorage, SCI_TX_BUFFER_SIZE);
+    TelemetryInit(&telemetry, &sciTxRing);
+
+    EALLOW;
+    SysCtrlRegs.PCLKCR0.bit.SCIAENCLK = 1; // Enable SCI-A clock
+    SciaRegs.SCICCR.all = 0x0007;         // 1 stop bit, No loopback, No parity, 8 char bits, async mode, idle-line protocol
+    SciaRegs.SCICTL1.all = 0x0003;        // Enable TX, RX, internal SCICLK
+    SciaRegs.SCICTL2.all = 0x0001;        // Enable TX interrupt
+    SciaRegs.SCICTL1.all = 0x0023;        // Relinquish SCI from Reset
+    SciaRegs.SCIHBAUD = SCI_BRR >> 8;     // Set baud rate to about 115200
+    SciaRegs.SCILBAUD = SCI_BRR & 0xFF;
+    SciaRegs.SCIFFTX.all = 0xC000 | SCI_TX_FIFO_LEVEL; // Enable FIFO enhancements, TX FIFO interrupt enabled when data is queued
+    SciaRegs.SCIFFCT.all = 0x0;
+    SciaRegs.SCIFFTX.bit.TXFIFOXRESET = 1; // Release TX FIFO from reset
+    EDIS;
+}
+
+// Let scia_tx_isr drain any published frames
+void SciaStartTx()
+{
+    SciaRegs.SCIFFTX.bit.TXFFIENA = 1;
+}
+
+void main(void)
+{
+    Uint16 samples[TELEMETRY_ADC_SAMPLES];
+    Uint32 timestamp = 0;
+    int32 position = 0;
+    Uint16 i;
+
+    InitSysCtrl(); // Initialize the CPU and configure the clock
+    DINT;          // Disable CPU interrupts
+
+    InitGpio();    // Initialize the GPIO
+    InitScia();    // Initialize the UART
+
+    InitPieCtrl(); // Initialize the PIE control registers
+    InitPieVectTable(); // Initialize the PIE vector table
+
+    EALLOW;
+    PieVectTable.SCITXINTA = &scia_tx_isr; // Map TX ISR to the PIE vector table
+    EDIS;
+
+    IER |= M_INT9; // Enable CPU INT9
+    PieCtrlRegs.PIEIER9.bit.INTx2 = 1; // Enable PIE Group 9 interrupt 2 (TX)
+
+    EINT;  // Enable Global interrupt INTM
+    ERTM;  // Enable Global realtime interrupt DBGM
+
+    while(1)
+    {
+        // Synthetic sawtooth; replace with a block from the ADC_Interrupt capture
+        for(i = 0; i < TELEMETRY_ADC_SAMPLES; i++)
+        {
+            samples[i] = (Uint16)((timestamp + i) << 6) & 0x0FFF;
+        }
+
+        // Send as soon as the whole group fits, which keeps the line busy without dropping the smaller records
+        if(RingBufferFree(&sciTxRing) >= TELEMETRY_GROUP_BYTES)
+        {
+            TelemetrySendAdcBlock(&telemetry, timestamp, samples, TELEMETRY_ADC_SAMPLES);
+            position += 3;
+            TelemetrySendEncoder(&telemetry, timestamp, position, 3);
+            if((timestamp & 0x3F) == 0)
+            {
+                TelemetrySendCounters(&telemetry, sciTxIsrCount, sciTxByteCount);
+            }
+            timestamp++;
+            SciaStartTx();
+        }
+    }
+}
+
+__interrupt void scia_tx_isr(void)
+{
+    Uint16 freeSlots = SCI_FIFO_DEPTH - SciaRegs.SCIFFTX.bit.TXFFST; // Fill every free FIFO slot
+    Uint16 txByte;
+
+    while(freeSlots--)
+    {
+        if(!RingBufferGet(&sciTxRing, &txByte))
+        {
+            SciaRegs.SCIFFTX.bit.TXFFIENA = 0; // Ring empty, stop TX interrupts until more frames are published
+            break;
+        }
+        SciaRegs.SCITXBUF = txByte; // Send next byte
+        sciTxByteCount++;
+    }
+    sciTxIsrCount++;
+
+    SciaRegs.SCIFFTX.bit.TXFFINTCLR = 1; // Clear TX interrupt flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP9; // Acknowledge interrupt
+}
@@ -0,0 +1,108 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * COBS framed telemetry writer shared by the UART_Telemetry and UART_Logging examples. See telemetry.h.
+ */
+
+#include "telemetry.h"
+
+void TelemetryInit(Telemetry *tm, RingBuffer *ring)
+{
+    tm->ring = ring;
+    tm->seq = 0;
+    tm->frames = 0;
+    tm->drops = 0;
+}
+
+/*
+ * Start a frame with payloadLength bytes of payload. Space for the worst-case encoded
+ * frame is checked up front, so the Put functions never have to test for a full ring.
+ * Returns 0 and counts a drop if the frame does not fit.
+ */
+Uint16 TelemetryBegin(Telemetry *tm, Uint16 type, Uint16 payloadLength)
+{
+    Uint16 length = payloadLength + 4; // seq + type + payload + CRC
+    Uint16 encoded = length + length / 254 + 2; // COBS overhead + delimiter
+
+    if(RingBufferFree(tm->ring) < encoded)
+    {
+        tm->drops++;
+        return 0;
+    }
+    tm->codePos = tm->ring->head;
+    tm->pos = tm->codePos + 1;
+    tm->code = 1;
+    tm->crc = CRC16_INIT;
+    TelemetryPutByte(tm, tm->seq);
+    TelemetryPutByte(tm, type);
+    return 1;
+}
+
+// Append the CRC, close the last COBS block and publish the whole frame
+void TelemetryEnd(Telemetry *tm)
+{
+    Uint16 crc = tm->crc;
+    RingBuffer *rb = tm->ring;
+
+    TelemetryStuff(tm, crc & 0xFF);
+    TelemetryStuff(tm, crc >> 8);
+    rb->data[tm->codePos & rb->mask] = tm->code;
+    rb->data[tm->pos++ & rb->mask] = 0x00; // Frame delimiter
+    RING_BARRIER();
+    rb->head = tm->pos;
+    tm->seq = (tm->seq + 1) & 0xFF;
+    tm->frames++;
+}
+
+Uint16 TelemetrySendAdcBlock(Telemetry *tm, Uint32 timestamp, const Uint16 *samples, Uint16 count)
+{
+    Uint16 i;
+
+    if(!TelemetryBegin(tm, TELEMETRY_ADC_BLOCK, 6 + 2 * count))
+    {
+        return 0;
+    }
+    TelemetryPutUint32(tm, timestamp);
+    TelemetryPutUint16(tm, count);
+    for(i = 0; i < count; i++)
+    {
+        TelemetryPutUint16(tm, samples[i]);
+    }
+    TelemetryEnd(tm);
+    return 1;
+}
+
+Uint16 TelemetrySendEncoder(Telemetry *tm, Uint32 timestamp, int32 position, int32 velocity)
+{
+    if(!TelemetryBegin(tm, TELEMETRY_ENCODER, 12))
+    {
+        return 0;
+    }
+    TelemetryPutUint32(tm, timestamp);
+    TelemetryPutUint32(tm, (Uint32)position);
+    TelemetryPutUint32(tm, (Uint32)velocity);
+    TelemetryEnd(tm);
+    return 1;
+}
+
+// The TX interrupt counters are passed in, as they belong to the caller's SCI driver
+Uint16 TelemetrySendCounters(Telemetry *tm, Uint32 txIsrCount, Uint32 txByteCount)
+{
+    Uint32 frames = tm->frames;
+    Uint32 drops = tm->drops;
+
+    if(!TelemetryBegin(tm, TELEMETRY_COUNTERS, 16))
+    {
+        return 0;
+    }
+    TelemetryPutUint32(tm, frames);
+    TelemetryPutUint32(tm, drops);
+    TelemetryPutUint32(tm, txIsrCount);
+    TelemetryPutUint32(tm, txByteCount);
+    TelemetryEnd(tm);
+    return 1;
+}
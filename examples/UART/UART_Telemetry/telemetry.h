@@ -0,0 +1,102 @@
+/*
+ * Author: Kiran Jojare
+ * Email: kijo7257@colorado.edu
+ * Date: Oct 17, 2026
+ * Version: 1.0
+ *
+ * Description:
+ * COBS framed telemetry writer shared by the UART_Telemetry and UART_Logging examples.
+ *
+ * Each record is framed as
+ *     [seq] [type] [payload ...] [CRC-16 low] [CRC-16 high]
+ * and COBS encoded straight into the storage of a TX ring (ring.h) past head, with no intermediate frame buffer.
+ * TelemetryEnd publishes the whole frame with a single head update, so the TX interrupt never sends half a frame.
+ * Multi-byte fields are sent little-endian.
+ *
+ * The functions do not touch peripheral registers. host/telemetry_loopback.c feeds the frames into the host decoder.
+ */
+
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+#include "ring.h" // examples/UART/UART_Communication
+#include "crc.h"  // examples/CRC/CRC_Engine
+
+#ifndef __TMS320C2000__
+typedef int32_t int32;
+#endif
+
+#define TELEMETRY_ADC_BLOCK  0x01 // Uint32 timestamp, Uint16 count, count x Uint16 samples
+#define TELEMETRY_ENCODER    0x02 // Uint32 timestamp, int32 position, int32 velocity
+#define TELEMETRY_COUNTERS   0x03 // Uint32 frames, Uint32 drops, Uint32 TX interrupts, Uint32 TX bytes
+#define TELEMETRY_LOG        0x04 // Log entries: Uint16 header, Uint32 timestamp, n x Uint32 arguments (UART_Logging)
+
+// Bytes on the line for a payload of up to 250 bytes: seq, type, CRC, one COBS code byte and the delimiter
+#define TELEMETRY_FRAME_BYTES(payloadLength) ((payloadLength) + 6)
+
+/*
+ * Frame writer. codePos is the slot reserved for the current COBS code byte,
+ * which is filled in once the length of the block is known.
+ */
+typedef struct
+{
+    RingBuffer *ring;  // Destination ring
+    Uint16 pos;        // Next unpublished write position
+    Uint16 codePos;    // Position of the pending COBS code byte
+    Uint16 code;       // Length of the current COBS block + 1
+    Uint16 crc;        // Running CRC-16 over seq, type and payload
+    Uint16 seq;        // Sequence number of the next frame (8-bit)
+    Uint32 frames;     // Frames published
+    Uint32 drops;      // Frames dropped because the ring was full
+} Telemetry;
+
+void TelemetryInit(Telemetry *tm, RingBuffer *ring);
+Uint16 TelemetryBegin(Telemetry *tm, Uint16 type, Uint16 payloadLength);
+void TelemetryEnd(Telemetry *tm);
+
+Uint16 TelemetrySendAdcBlock(Telemetry *tm, Uint32 timestamp, const Uint16 *samples, Uint16 count);
+Uint16 TelemetrySendEncoder(Telemetry *tm, Uint32 timestamp, int32 position, int32 velocity);
+Uint16 TelemetrySendCounters(Telemetry *tm, Uint32 txIsrCount, Uint32 txByteCount);
+
+// COBS encode one byte into the ring; the frame is not visible to the consumer yet
+static inline void TelemetryStuff(Telemetry *tm, Uint16 byte)
+{
+    RingBuffer *rb = tm->ring;
+
+    if(byte == 0)
+    {
+        rb->data[tm->codePos & rb->mask] = tm->code; // Close the block, the zero is implied
+        tm->codePos = tm->pos++;
+        tm->code = 1;
+        return;
+    }
+    rb->data[tm->pos++ & rb->mask] = byte;
+    if(++tm->code == 0xFF)
+    {
+        rb->data[tm->codePos & rb->mask] = 0xFF; // Full 254-byte block, no implied zero
+        tm->codePos = tm->pos++;
+        tm->code = 1;
+    }
+}
+
+// Payload fields, only between a successful TelemetryBegin and TelemetryEnd
+static inline void TelemetryPutByte(Telemetry *tm, Uint16 byte)
+{
+    byte &= 0xFF;
+    tm->crc = Crc16Byte(tm->crc, byte);
+    TelemetryStuff(tm, byte);
+}
+
+static inline void TelemetryPutUint16(Telemetry *tm, Uint16 value)
+{
+    TelemetryPutByte(tm, value);
+    TelemetryPutByte(tm, value >> 8);
+}
+
+static inline void TelemetryPutUint32(Telemetry *tm, Uint32 value)
+{
+    TelemetryPutUint16(tm, (Uint16)value);
+    TelemetryPutUint16(tm, (Uint16)(value >> 16));
+}
+
+#endif // TELEMETRY_H
@@ -2,7 +2,7 @@
  * Author: Kiran Jojare
  * Email: kijo7257@colorado.edu
  * Date: Feb 28, 2024
- * Version: 1.0
+ * Version: 1.2
  *
  * Description:
  * This code demonstrates how to use the UART (Universal Asynchronous Receiver/Transmitter) module to send and receive data using interrupts
@@ -10,17 +10,37 @@
  *
  * The code initializes the system control and GPIO settings, configures the UART module, and handles data transmission and reception in interrupt service routines (ISRs).
  *
+ * The transmit interrupt fires when the 4-deep TX FIFO has drained to SCI_TX_FIFO_LEVEL and refills every free slot,
+ * so one interrupt moves up to four characters instead of one. Received characters are queued in an echo ring and sent
+ * by the transmit interrupt ahead of the message, so no echo is written into a full FIFO. Echoes that do not fit in the
+ * ring are counted in sciEchoDropCount. The ring comes from ring.h of the UART_Communication example; add it from that
+ * folder to the project.
+ *
  * This example is intended to help users get started with using UART interrupts for both transmitting and receiving data on the F28027F microcontroller.
  */
 
 #include "F2802x_Device.h"
 #include "f2802x_examples.h"
+#include "ring.h"
 
 __interrupt void scia_rx_isr(void);
 __interrupt void scia_tx_isr(void);
 
+#define SCI_FIFO_DEPTH     4 // SCI-A TX FIFO depth
+#define SCI_TX_FIFO_LEVEL  0 // TX FIFO interrupt when TXFFST <= level; 0 refills while the last character is still shifting out
+#define SCI_ECHO_BUFFER_SIZE 16 // Echo queue size (power of two)
+
+#if (SCI_ECHO_BUFFER_SIZE & (SCI_ECHO_BUFFER_SIZE - 1)) != 0
+#error "SCI_ECHO_BUFFER_SIZE must be a power of two"
+#endif
+
 char txBuffer[] = "Hello, UART Interrupt!";
 int txIndex = 0;
+volatile Uint32 sciTxIsrCount;  // Number of TX interrupts serviced
+volatile Uint32 sciTxByteCount; // Number of characters written to the TX FIFO
+Uint16 sciEchoStorage[SCI_ECHO_BUFFER_SIZE];
+RingBuffer sciEchoRing;         // scia_rx_isr is the producer and scia_tx_isr is the consumer
+volatile Uint32 sciEchoDropCount; // Echoes lost because the echo ring was full
 
 void InitGpio()
 {
@@ -35,6 +55,8 @@ void InitGpio()
 
 void InitScia()
 {
+    RingBufferInit(&sciEchoRing, sciEchoStorage, SCI_ECHO_BUFFER_SIZE);
+
     EALLOW;
     SysCtrlRegs.PCLKCR0.bit.SCIAENCLK = 1; // Enable SCI-A clock
     SciaRegs.SCICCR.all = 0x0007;         // 1 stop bit, No loopback, No parity, 8 char bits, async mode, idle-line protocol
@@ -43,9 +65,11 @@ void InitScia()
     SciaRegs.SCICTL1.all = 0x0023;        // Relinquish SCI from Reset
     SciaRegs.SCIHBAUD = 0x0001;           // Set baud rate to 9600
     SciaRegs.SCILBAUD = 0x00E7;
-    SciaRegs.SCIFFTX.all = 0xC022;        // Enable FIFO enhancements, clear TX FIFO, set TX FIFO level to 2
-    SciaRegs.SCIFFRX.all = 0x0022;        // Enable RX FIFO, clear RX FIFO, set RX FIFO level to 2
+    SciaRegs.SCIFFTX.all = 0xC020 | SCI_TX_FIFO_LEVEL; // Enable FIFO enhancements and TX FIFO interrupt, TX FIFO held in reset
+    SciaRegs.SCIFFRX.all = 0x0022;        // Enable RX FIFO interrupt, set RX FIFO level to 2, RX FIFO held in reset
     SciaRegs.SCIFFCT.all = 0x0;
+    SciaRegs.SCIFFTX.bit.TXFIFOXRESET = 1; // Release TX FIFO from reset
+    SciaRegs.SCIFFRX.bit.RXFIFORESET = 1;  // Release RX FIFO from reset
     EDIS;
 }
 
@@ -80,10 +104,15 @@ void main(void)
 
 __interrupt void scia_rx_isr(void)
 {
-    Uint16 receivedChar;
+    Uint16 pending = SciaRegs.SCIFFRX.bit.RXFFST; // Drain the whole RX FIFO
 
-    receivedChar = SciaRegs.SCIRXBUF.all; // Read received character
-    SciaRegs.SCITXBUF = receivedChar; // Echo received character
+    while(pending--)
+    {
+        if(!RingBufferPut(&sciEchoRing, SciaRegs.SCIRXBUF.all & 0xFF)) // Queue the echo for scia_tx_isr
+        {
+            sciEchoDropCount++; // Echo ring full
+        }
+    }
 
     SciaRegs.SCIFFRX.bit.RXFFINTCLR = 1; // Clear RX interrupt flag
     PieCtrlRegs.PIEACK.all = PIEACK_GROUP9; // Acknowledge interrupt
@@ -91,10 +120,24 @@ __interrupt void scia_rx_isr(void)
 
 __interrupt void scia_tx_isr(void)
 {
-    if(txBuffer[txIndex] != '\0')
+    Uint16 freeSlots = SCI_FIFO_DEPTH - SciaRegs.SCIFFTX.bit.TXFFST; // Fill every free FIFO slot
+    Uint16 txChar;
+
+    while(freeSlots--)
     {
-        SciaRegs.SCITXBUF = txBuffer[txIndex++]; // Send next character
+        if(!RingBufferGet(&sciEchoRing, &txChar)) // Queued echoes go out before the message
+        {
+            if(txBuffer[txIndex] == '\0')
+            {
+                txIndex = 0; // Restart the message when the end is reached
+            }
+            txChar = txBuffer[txIndex++];
+        }
+        SciaRegs.SCITXBUF = txChar; // Send next character
+        sciTxByteCount++;
     }
-    else
-    {
-        txIndex = 0; // 
+    sciTxIsrCount++;
+
+    SciaRegs.SCIFFTX.bit.TXFFINTCLR = 1; // Clear TX interrupt flag
+    PieCtrlRegs.PIEACK.all = PIEACK_GROUP9; // Acknowledge interrupt
+}